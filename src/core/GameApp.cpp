@@ -11,8 +11,16 @@
 #include "manager/StateManager.hpp"
 
 #include "WindowsMessageHandler.hpp"
+#include "GameUtils.hpp"
 
 #include "../utils/Timer.hpp"
+#include "../utils/FrameJobSystem.hpp"
+#include "../utils/FrameProfiler.hpp"
+#include "../utils/StartupProfiler.hpp"
+#include "../utils/TimerScheduler.hpp"
+#include "../texture/RenderRecorder.hpp"
+#include "../resource/AssetPack.hpp"
+#include "../resource/AssetLoader.hpp"
 
 //#include <SDL3/SDL_main.h>
 #include <SDL3/SDL_image.h>
@@ -25,11 +33,18 @@
 
 #include <stdexcept>
 #include <format>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
 #include "../network/NetworkController.hpp"
+#include "../network/link/LinkMonitor.hpp"
 #include "../utils/Logger.hpp"
 
 GameApp& GameApp::GetInstance() 
 {
+    // Release(Ҹ ) ΰŸ ϹǷ ΰŸ  Ͽ ߿ Ҹǵ Ѵ.
+    Logger::GetInstance();
+
     static GameApp instance;
     return instance;
 }
@@ -42,14 +57,67 @@ GameApp::~GameApp()
 
 bool GameApp::Initialize() 
 {
+    STARTUP_SCOPE("GameApp::Initialize", "app");
+
     try 
     {
+        //  α״ ׶ 忡 /ַܼ 
+        {
+            STARTUP_SCOPE("Logger::Initialize", "app");
+            LOGGER.Initialize();
+        }
+
+        //   ó  Ͽ ε
+        {
+            STARTUP_SCOPE("AssetPack::Open", "app");
+            if (!ASSET_PACK.Open())
+            {
+                LOG_RESOURCE(Info, "Loading assets from loose files");
+            }
+        }
+
+        if (headless_)
+        {
+            GameUtils::Random::SetSeed(headless_->GetOptions().seed);
+        }
+
         InitializeSDL();
 
+        if (replay_)
+        {
+            //   Ŵ/    
+            if (!replay_->Initialize(renderer_.get()))
+            {
+                throw std::runtime_error("Failed to initialize render replay");
+            }
+
+            is_running_ = true;
+            return true;
+        }
+
+        //  ʱȭ(InitializeManagers) ٷ ؽó ûϹǷ   Ŀ غ
+        {
+            STARTUP_SCOPE("AssetLoader::Initialize", "app");
+            ASSET_LOADER.Initialize();
+        }
+
         InitializeManagers();
 
-        windowMessageHandler_ = std::make_unique<WindowsMessageHandler>();
-        windowMessageHandler_->SetupWindowsMessageHook();
+        if (headless_)
+        {
+            //   帮 Ŀ   ۾  
+            if (!headless_->Initialize())
+            {
+                throw std::runtime_error("Failed to initialize headless runner");
+            }
+        }
+        else
+        {
+            FRAME_JOBS.Initialize();
+
+            windowMessageHandler_ = std::make_unique<WindowsMessageHandler>();
+            windowMessageHandler_->SetupWindowsMessageHook();
+        }
 
         // Ÿ̸ ʱȭ
         timer_ = std::make_unique<Timer>();
@@ -67,12 +135,25 @@ bool GameApp::Initialize()
 
 bool GameApp::InitializeSDL()
 {
+    STARTUP_SCOPE("GameApp::InitializeSDL", "app");
+
     SDL_SetHint(SDL_HINT_APP_NAME, "PuyoPuyo");
-    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, render_driver_.c_str());
     
     SDL_SetAppMetadata("PuyoPuyo", "1.0", "com.weight.puyopuyo");
 
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) == false)
+    SDL_InitFlags init_flags = SDL_INIT_VIDEO | SDL_INIT_AUDIO;
+    SDL_WindowFlags window_flags = SDL_WINDOW_ALWAYS_ON_TOP;
+
+    if (headless_)
+    {
+        // ÷̰  ȯ濡 â/   ֵ offscreen ̹ 
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        init_flags = SDL_INIT_VIDEO;
+        window_flags = SDL_WINDOW_HIDDEN;
+    }
+
+    if (SDL_Init(init_flags) == false)
     {
         throw std::runtime_error(std::format("SDL ʱȭ : {}", SDL_GetError()));
     }   
@@ -85,7 +166,7 @@ bool GameApp::InitializeSDL()
         "PuyoPuyo",
         window_width_,
         window_height_,
-        SDL_WINDOW_ALWAYS_ON_TOP,
+        window_flags,
         &window,
         &renderer))
     {
@@ -128,6 +209,8 @@ bool GameApp::InitializeSDL()
 
 void GameApp::InitializeManagers()
 {
+    STARTUP_SCOPE("GameApp::InitializeManagers", "app");
+
     managers_ = std::make_unique<Managers>();
 
     managers_->CreateManagers();
@@ -147,25 +230,76 @@ void GameApp::InitializeManagers()
         throw std::runtime_error("Failed to initialize one or more managers");
     }
 
+    if (resource_budget_ > 0)
+    {
+        resource_manager_->SetMemoryBudget(resource_budget_);
+    }
+
     if (!managers_->Initialize())
     {
         throw std::runtime_error(std::format("Failed to initialize manager"));
     }
 }
 
+MapManager& GameApp::GetMapManager() const
+{
+    if (!map_manager_) throw std::runtime_error("MapManager not initialized");
+    managers_->EnsureInitialized(*map_manager_);
+    return *map_manager_;
+}
+
+ParticleManager& GameApp::GetParticleManager() const
+{
+    if (!particle_manager_) throw std::runtime_error("ParticleManager not initialized");
+    managers_->EnsureInitialized(*particle_manager_);
+    return *particle_manager_;
+}
+
 void GameApp::MainLoop() 
 {
     //while (is_running_) 
     {
-        elapsed_time_ = timer_->GetElapsedTime();
-        accumulated_time_ += elapsed_time_;
+        if (replay_)
+        {
+            replay_->RenderFrame(renderer_.get());
+
+            if (replay_->IsFinished())
+            {
+                is_running_ = false;
+            }
+            return;
+        }
+
+        if (headless_)
+        {
+            headless_->BeginFrame();
+        }
+
+        FRAME_PROFILER.BeginFrame();
 
         //HandleEvents();
         Update();
         Render();
+
+        FRAME_PROFILER.EndFrame();
+
+        if (headless_ && headless_->IsFinished())
+        {
+            is_running_ = false;
+        }
     }
 }
 
+void GameApp::EnableHeadless(HeadlessOptions options)
+{
+    headless_ = std::make_unique<HeadlessRunner>(std::move(options));
+}
+
+void GameApp::EnableRenderReplay(RenderReplayOptions options)
+{
+    replay_ = std::make_unique<RenderReplay>(std::move(options));
+}
+
 void GameApp::HandleEvents(const SDL_Event& event)
 {
     /*SDL_Event event;
@@ -181,6 +315,18 @@ void GameApp::HandleEvents(const SDL_Event& event)
             {
                 SetFullscreen(!is_full_screen_);
             }
+            else if (event.key.key == SDLK_F10 && !event.key.repeat)
+            {
+                RENDER_RECORDER.StartCapture(RenderRecorder::DEFAULT_CAPTURE_FRAMES, "render_capture.prc");
+            }
+            else if (event.key.key == SDLK_F3 && !event.key.repeat)
+            {
+                FRAME_PROFILER.ToggleOverlay();
+            }
+            else if (event.key.key == SDLK_F9 && !event.key.repeat)
+            {
+                FRAME_PROFILER.StartTraceCapture(FrameProfiler::DEFAULT_TRACE_FRAMES, FrameProfiler::DEFAULT_TRACE_FILE);
+            }
             break;
         case SDL_EVENT_USER:
             if (event.user.code == Constants::Network::NETWORK_EVENT_CODE) 
@@ -194,7 +340,10 @@ void GameApp::HandleEvents(const SDL_Event& event)
             break;
         }
 
-        managers_->HandleEvents(event);
+        if (managers_)
+        {
+            managers_->HandleEvents(event);
+        }
     }
 }
 
@@ -202,15 +351,107 @@ void GameApp::Update()
 {
     if (NETWORK.IsRunning())
     {
+        PROFILE_SCOPE(ProfileZone::NetworkUpdate);
         NETWORK.Update();
     }
 
+    // ̸ ε    ڵ   Ӵ  ȿ ؽó ε
+    {
+        PROFILE_SCOPE(ProfileZone::AssetUpload);
+        ASSET_LOADER.ProcessUploads();
+    }
+
+    if (headless_)
+    {
+        // 帮 ð ϰ Ӵ   ŭ ϰ    ״ 
+        for (int step = headless_->GetStepsPerFrame(); step > 0; --step)
+        {
+            StepSimulation();
+        }
+
+        interpolation_alpha_ = 1.0f;
+        return;
+    }
+
+    step_accumulator_ += std::min(timer_->GetElapsedTime(), Constants::Time::MAX_FRAME_TIME);
+
+    int steps = 0;
+    while (step_accumulator_ >= Constants::Time::FIXED_STEP && steps < Constants::Time::MAX_STEPS_PER_FRAME)
+    {
+        StepSimulation();
+        step_accumulator_ -= Constants::Time::FIXED_STEP;
+        ++steps;
+    }
+
+    if (step_accumulator_ >= Constants::Time::FIXED_STEP)
+    {
+        //   ѱ ð       θ Ǽȯ ´
+        const double dropped = step_accumulator_ - std::fmod(step_accumulator_, static_cast<double>(Constants::Time::FIXED_STEP));
+        step_accumulator_ -= dropped;
+        LOGGER.Warning("Simulation fell behind, dropped {:.1f} ms", dropped * 1000.0);
+    }
+
+    interpolation_alpha_ = static_cast<float>(step_accumulator_ / Constants::Time::FIXED_STEP);
+}
+
+void GameApp::StepSimulation()
+{
+    ++simulation_step_;
+
+    elapsed_time_ = Constants::Time::FIXED_STEP;
+    accumulated_time_ += elapsed_time_;
+
+    //  Ÿ̸Ӵ     (° Leave  ڽ Ÿ̸Ӹ )
+    TIMER_SCHEDULER.Advance(elapsed_time_);
+
     managers_->Update(elapsed_time_);
+
+    //     ϵ ùķ̼ ۾(ƼŬ//źȯ)  óϰ  ()  շ
+    PROFILE_SCOPE(ProfileZone::FrameJobs);
+    FRAME_JOBS.Execute();
 }
 
 void GameApp::Render() 
 {
-    managers_->RenderAll(renderer_.get());
+    RENDER_RECORDER.BeginFrame(renderer_.get());
+
+    if (!headless_)
+    {
+        managers_->RenderFrame(renderer_.get());
+        RENDER_RECORDER.EndFrame();
+
+        // ̴ ȭ  ƴϹǷ EndFrame Ŀ ׸
+        FRAME_PROFILER.RenderOverlay(renderer_.get());
+        if (FRAME_PROFILER.IsOverlayVisible())
+        {
+            LINK_MONITOR.RenderOverlay(renderer_.get(), FrameProfiler::GetOverlayHeight());
+        }
+
+        {
+            PROFILE_SCOPE(ProfileZone::Present);
+            SDL_RenderPresent(renderer_.get());
+        }
+
+        if (!STARTUP_PROFILER.IsFirstFrameMarked())
+        {
+            STARTUP_PROFILER.MarkFirstFrame();
+        }
+        return;
+    }
+
+    //  ð ȼ б/ؽ   ʴ´.
+    const auto start = std::chrono::steady_clock::now();
+    managers_->RenderFrame(renderer_.get());
+    const double render_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    RENDER_RECORDER.EndFrame();
+
+    headless_->CaptureFrame(renderer_.get(), render_ms);
+    SDL_RenderPresent(renderer_.get());
+
+    if (!STARTUP_PROFILER.IsFirstFrameMarked())
+    {
+        STARTUP_PROFILER.MarkFirstFrame();
+    }
 }
 
 bool GameApp::SetFullscreen(bool enable) 
@@ -233,6 +474,18 @@ bool GameApp::SetFullscreen(bool enable)
 
 void GameApp::Release() 
 { 
+    FRAME_JOBS.Release();
+    ASSET_LOADER.Release();
+
+    if (headless_)
+    {
+        headless_->Release();
+    }
+
+    if (replay_)
+    {
+        replay_->Release();
+    }
 
     //  Ŵ 
     if (managers_)
@@ -250,4 +503,11 @@ void GameApp::Release()
     timer_.reset();
     renderer_.reset();
     window_.reset();
+
+    // ù    ʱȭ  Ͽ ٽ 
+    STARTUP_PROFILER.Flush();
+    FRAME_PROFILER.Release();
+
+    ASSET_PACK.Close();
+    LOGGER.Shutdown();
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include <format>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <unordered_map>
 #include <atomic>
@@ -18,6 +19,8 @@
 #include "./common/constants/Constants.hpp"
 #include "manager/IManager.hpp"
 #include "manager/Managers.hpp"
+#include "HeadlessRunner.hpp"
+#include "../texture/RenderReplay.hpp"
 
 
 class IManager;
@@ -57,7 +60,26 @@ public:
     [[nodiscard]] float GetAccumulatedTime() const noexcept { return accumulated_time_; }
     [[nodiscard]] float GetElapsedTime() const noexcept { return elapsed_time_; }
 
+    //      ð  [0, 1),   /  ġ  
+    [[nodiscard]] float GetInterpolationAlpha() const noexcept { return interpolation_alpha_; }
+    // ݱ ( )    ȣ
+    [[nodiscard]] uint64_t GetSimulationStep() const noexcept { return simulation_step_; }
+
     void SetGameRunning(bool running){ is_running_ = running; }
+
+    // Initialize  ȣؾ ϸ, â  offscreen ̹ ũƮ Է Ѵ.
+    void EnableHeadless(HeadlessOptions options);
+    [[nodiscard]] bool IsHeadless() const noexcept { return headless_ != nullptr; }
+
+    // Initialize  ȣؾ ϸ,      Ŀǵ带 Ѵ.
+    void EnableRenderReplay(RenderReplayOptions options);
+    [[nodiscard]] bool IsRenderReplay() const noexcept { return replay_ != nullptr; }
+
+    // Initialize  ȣ (SDL_HINT_RENDER_DRIVER, ⺻ "software")
+    void SetRenderDriver(std::string driver) { render_driver_ = std::move(driver); }
+
+    // Initialize  ȣ (ResourceManager  ޸ , 0 ̸ ⺻)
+    void SetResourceBudget(size_t bytes) { resource_budget_ = bytes; }
     
     template<std::derived_from<IManager> T>
     [[nodiscard]] T* GetManager(std::string_view name) const
@@ -93,11 +115,8 @@ public:
         return *font_manager_;
     }
 
-    [[nodiscard]] MapManager& GetMapManager() const 
-    {
-        if (!map_manager_) throw std::runtime_error("MapManager not initialized");
-        return *map_manager_;
-    }
+    // /ƼŬ Ŵ  ʱȭ ̹Ƿ ó ȸ  ʱȭ
+    [[nodiscard]] MapManager& GetMapManager() const;
 
     [[nodiscard]] PlayerManager& GetPlayerManager() const 
     {
@@ -105,11 +124,7 @@ public:
         return *player_manager_;
     }
 
-    [[nodiscard]] ParticleManager& GetParticleManager() const 
-    {
-        if (!particle_manager_) throw std::runtime_error("ParticleManager not initialized");
-        return *particle_manager_;
-    }
+    [[nodiscard]] ParticleManager& GetParticleManager() const;
     [[nodiscard]] const HWND& GetWindowHandle() const { return hwnd_; }
 
 
@@ -120,6 +135,7 @@ private:
     bool InitializeSDL();
     void InitializeManagers();    
     void Update();
+    void StepSimulation();
     void Render();
     bool SetFullscreen(bool enable);
 
@@ -140,6 +156,10 @@ private:
     std::unique_ptr<SDL_Renderer, SDLDeleter> renderer_;
     std::unique_ptr<Timer> timer_;
     std::unique_ptr<WindowsMessageHandler> windowMessageHandler_;
+    std::unique_ptr<HeadlessRunner> headless_;
+    std::unique_ptr<RenderReplay> replay_;
+    std::string render_driver_{ "software" };
+    size_t resource_budget_{ 0 };
 
     std::atomic<bool> is_running_{ false };
     std::atomic<bool> is_full_screen_{ false };
@@ -148,7 +168,11 @@ private:
     float accumulated_time_{ 0.0f };
     float elapsed_time_{ 0.0f };    
 
-    HWND hwnd_;
+    double step_accumulator_{ 0.0 };
+    float interpolation_alpha_{ 1.0f };
+    uint64_t simulation_step_{ 0 };
+
+    HWND hwnd_{};
 
     ResourceManager* resource_manager_{ nullptr };
     StateManager* state_manager_{ nullptr };
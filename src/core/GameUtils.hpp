@@ -10,6 +10,7 @@
 
 #include "../core/common/constants/Constants.hpp"
 
+#include <atomic>
 #include <concepts>
 #include <random>
 #include <type_traits>
@@ -32,13 +33,30 @@ namespace GameUtils
 {
     namespace Random
     {
+        // 0 ̸ random_device  õ带 ϰ,  ܿ  õ  (帮 )
+        inline std::atomic<uint32_t>& GetFixedSeed()
+        {
+            static std::atomic<uint32_t> seed{ 0 };
+            return seed;
+        }
+
+        //   Ŀ ȣǹǷ 帶   
         inline std::mt19937& GetRandomEngine() 
         {
-            static std::random_device rd;
-            static std::mt19937 engine(rd());
+            thread_local std::mt19937 engine([]()
+                {
+                    const uint32_t seed = GetFixedSeed().load();
+                    return seed != 0 ? seed : std::random_device{}();
+                }());
             return engine;
         }
 
+        inline void SetSeed(uint32_t seed)
+        {
+            GetFixedSeed().store(seed);
+            GetRandomEngine().seed(seed);
+        }
+
         template<typename T>
         inline T Range(T min, T max) 
         {
@@ -0,0 +1,446 @@
+#include "HeadlessRunner.hpp"
+#include "GameApp.hpp"
+#include "manager/StateManager.hpp"
+#include "../utils/Logger.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <numeric>
+#include <sstream>
+#include <string_view>
+
+
+namespace
+{
+    std::optional<StateManager::StateID> ParseStateName(std::string_view name)
+    {
+        if (name == "Login") return StateManager::StateID::Login;
+        if (name == "Room") return StateManager::StateID::Room;
+        if (name == "CharSelect") return StateManager::StateID::CharSelect;
+        if (name == "Game") return StateManager::StateID::Game;
+        return std::nullopt;
+    }
+
+    std::string_view GetStateName(StateManager::StateID id)
+    {
+        switch (id)
+        {
+        case StateManager::StateID::Login: return "Login";
+        case StateManager::StateID::Room: return "Room";
+        case StateManager::StateID::CharSelect: return "CharSelect";
+        case StateManager::StateID::Game: return "Game";
+        default: return "None";
+        }
+    }
+
+    template<typename T>
+    bool ParseNumber(std::string_view text, T& value)
+    {
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return ec == std::errc() && ptr == text.data() + text.size();
+    }
+}
+
+HeadlessRunner::HeadlessRunner(HeadlessOptions options)
+    : options_(std::move(options))
+{
+}
+
+HeadlessRunner::~HeadlessRunner()
+{
+    Release();
+}
+
+std::optional<HeadlessOptions> HeadlessRunner::ParseCommandLine(int argc, char* argv[])
+{
+    HeadlessOptions options;
+    bool is_headless = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        const bool has_value = i + 1 < argc;
+
+        if (arg == "--headless")
+        {
+            is_headless = true;
+        }
+        else if (arg == "--script" && has_value)
+        {
+            options.script_path = argv[++i];
+        }
+        else if (arg == "--out" && has_value)
+        {
+            options.output_dir = argv[++i];
+        }
+        else if (arg == "--frames" && has_value)
+        {
+            if (!ParseNumber(std::string_view(argv[++i]), options.max_frames))
+            {
+                LOGGER.Warning("Invalid --frames value: {}", argv[i]);
+            }
+        }
+        else if (arg == "--seed" && has_value)
+        {
+            if (!ParseNumber(std::string_view(argv[++i]), options.seed))
+            {
+                LOGGER.Warning("Invalid --seed value: {}", argv[i]);
+            }
+        }
+        else if (arg == "--dump-frames")
+        {
+            options.dump_frames = true;
+        }
+        else if (arg == "--time-scale" && has_value)
+        {
+            if (!ParseNumber(std::string_view(argv[++i]), options.time_scale) || options.time_scale <= 0.0f)
+            {
+                LOGGER.Warning("Invalid --time-scale value: {}", argv[i]);
+                options.time_scale = 1.0f;
+            }
+        }
+    }
+
+    if (!is_headless)
+    {
+        return std::nullopt;
+    }
+
+    return options;
+}
+
+bool HeadlessRunner::Initialize()
+{
+    try
+    {
+        std::filesystem::create_directories(options_.output_dir);
+
+        if (!options_.script_path.empty() && !LoadScript())
+        {
+            return false;
+        }
+
+        frame_log_.open(options_.output_dir / "frames.csv", std::ios::out | std::ios::trunc);
+        if (!frame_log_)
+        {
+            LOGGER.Error("Failed to open headless frame log in {}", options_.output_dir.string());
+            return false;
+        }
+
+        frame_log_ << "frame,state,render_ms,hash\n";
+        render_times_.reserve(static_cast<size_t>(std::max(options_.max_frames, 0)));
+
+        LOGGER.Info("Headless mode: script={} frames={} out={} dump={} steps/frame={}",
+            options_.script_path.string(), options_.max_frames, options_.output_dir.string(), options_.dump_frames, GetStepsPerFrame());
+
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOGGER.Error("Headless initialization failed: {}", e.what());
+        return false;
+    }
+}
+
+void HeadlessRunner::Release()
+{
+    if (!frame_log_.is_open())
+    {
+        return;
+    }
+
+    frame_log_.close();
+
+    if (render_times_.empty())
+    {
+        return;
+    }
+
+    auto sorted = render_times_;
+    std::sort(sorted.begin(), sorted.end());
+
+    const double total = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+    const auto percentile = [&sorted](double p)
+        {
+            const size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+            return sorted[index];
+        };
+
+    const auto summary = std::format("frames={} avg={:.3f}ms p50={:.3f}ms p99={:.3f}ms max={:.3f}ms",
+        sorted.size(), total / static_cast<double>(sorted.size()), percentile(0.5), percentile(0.99), sorted.back());
+
+    LOGGER.Info("[Headless] {}", summary);
+
+    std::ofstream summary_file(options_.output_dir / "summary.txt", std::ios::out | std::ios::trunc);
+    summary_file << summary << '\n';
+}
+
+bool HeadlessRunner::LoadScript()
+{
+    std::ifstream file(options_.script_path);
+    if (!file)
+    {
+        LOGGER.Error("Failed to open headless script: {}", options_.script_path.string());
+        return false;
+    }
+
+    std::string line;
+    int line_number = 0;
+
+    while (std::getline(file, line))
+    {
+        ++line_number;
+
+        if (auto comment = line.find('#'); comment != std::string::npos)
+        {
+            line.erase(comment);
+        }
+
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+        {
+            continue;
+        }
+
+        if (!ParseLine(line, line_number))
+        {
+            return false;
+        }
+    }
+
+    //    ũƮ  
+    std::stable_sort(commands_.begin(), commands_.end(),
+        [](const ScriptCommand& lhs, const ScriptCommand& rhs)
+        {
+            return lhs.frame < rhs.frame;
+        });
+
+    return true;
+}
+
+bool HeadlessRunner::ParseLine(const std::string& line, int lineNumber)
+{
+    std::istringstream stream(line);
+    ScriptCommand command;
+    std::string verb;
+
+    if (!(stream >> command.frame >> verb))
+    {
+        LOGGER.Error("Headless script line {}: expected '<frame> <command>'", lineNumber);
+        return false;
+    }
+
+    if (verb == "state")
+    {
+        stream >> command.text;
+        if (!ParseStateName(command.text))
+        {
+            LOGGER.Error("Headless script line {}: unknown state '{}'", lineNumber, command.text);
+            return false;
+        }
+        command.type = CommandType::State;
+    }
+    else if (verb == "key" || verb == "keydown" || verb == "keyup")
+    {
+        std::string name;
+        stream >> name;
+        command.key = SDL_GetKeyFromName(name.c_str());
+        if (command.key == SDLK_UNKNOWN)
+        {
+            LOGGER.Error("Headless script line {}: unknown key '{}'", lineNumber, name);
+            return false;
+        }
+        command.type = verb == "key" ? CommandType::KeyPress :
+            (verb == "keydown" ? CommandType::KeyDown : CommandType::KeyUp);
+    }
+    else if (verb == "text")
+    {
+        std::getline(stream >> std::ws, command.text);
+        command.type = CommandType::Text;
+    }
+    else if (verb == "mouse" || verb == "click")
+    {
+        if (!(stream >> command.x >> command.y))
+        {
+            LOGGER.Error("Headless script line {}: expected '<x> <y>'", lineNumber);
+            return false;
+        }
+        command.type = verb == "mouse" ? CommandType::MouseMove : CommandType::Click;
+    }
+    else if (verb == "quit")
+    {
+        command.type = CommandType::Quit;
+    }
+    else
+    {
+        LOGGER.Error("Headless script line {}: unknown command '{}'", lineNumber, verb);
+        return false;
+    }
+
+    commands_.push_back(std::move(command));
+    return true;
+}
+
+int HeadlessRunner::GetStepsPerFrame() const
+{
+    const float steps = Constants::Time::FRAME_TIME * options_.time_scale / Constants::Time::FIXED_STEP;
+    return std::max(1, static_cast<int>(std::lround(steps)));
+}
+
+void HeadlessRunner::BeginFrame()
+{
+    while (next_command_ < commands_.size() && commands_[next_command_].frame <= frame_index_)
+    {
+        Dispatch(commands_[next_command_]);
+        ++next_command_;
+    }
+}
+
+void HeadlessRunner::Dispatch(const ScriptCommand& command)
+{
+    switch (command.type)
+    {
+    case CommandType::State:
+        if (auto state = ParseStateName(command.text))
+        {
+            GAME_APP.GetStateManager().RequestStateChange(*state);
+        }
+        break;
+
+    case CommandType::KeyDown:
+        PushKeyEvent(SDL_EVENT_KEY_DOWN, command.key);
+        break;
+
+    case CommandType::KeyUp:
+        PushKeyEvent(SDL_EVENT_KEY_UP, command.key);
+        break;
+
+    case CommandType::KeyPress:
+        PushKeyEvent(SDL_EVENT_KEY_DOWN, command.key);
+        PushKeyEvent(SDL_EVENT_KEY_UP, command.key);
+        break;
+
+    case CommandType::Text:
+    {
+        // text ʹ commands_  ִ  ȿϹǷ ̺Ʈ ó  
+        SDL_Event event{};
+        event.type = SDL_EVENT_TEXT_INPUT;
+        event.text.windowID = SDL_GetWindowID(GAME_APP.GetWindow());
+        event.text.text = command.text.c_str();
+        SDL_PushEvent(&event);
+        break;
+    }
+
+    case CommandType::MouseMove:
+        PushMouseEvent(SDL_EVENT_MOUSE_MOTION, command.x, command.y);
+        break;
+
+    case CommandType::Click:
+        PushMouseEvent(SDL_EVENT_MOUSE_MOTION, command.x, command.y);
+        PushMouseEvent(SDL_EVENT_MOUSE_BUTTON_DOWN, command.x, command.y);
+        PushMouseEvent(SDL_EVENT_MOUSE_BUTTON_UP, command.x, command.y);
+        break;
+
+    case CommandType::Quit:
+        is_finished_ = true;
+        break;
+    }
+}
+
+void HeadlessRunner::PushKeyEvent(SDL_EventType type, SDL_Keycode key)
+{
+    SDL_Event event{};
+    event.type = type;
+    event.key.windowID = SDL_GetWindowID(GAME_APP.GetWindow());
+    event.key.key = key;
+    event.key.scancode = SDL_GetScancodeFromKey(key, nullptr);
+    event.key.down = (type == SDL_EVENT_KEY_DOWN);
+    SDL_PushEvent(&event);
+}
+
+void HeadlessRunner::PushMouseEvent(SDL_EventType type, float x, float y)
+{
+    SDL_Event event{};
+    event.type = type;
+
+    if (type == SDL_EVENT_MOUSE_MOTION)
+    {
+        event.motion.windowID = SDL_GetWindowID(GAME_APP.GetWindow());
+        event.motion.x = x;
+        event.motion.y = y;
+    }
+    else
+    {
+        event.button.windowID = SDL_GetWindowID(GAME_APP.GetWindow());
+        event.button.button = SDL_BUTTON_LEFT;
+        event.button.down = (type == SDL_EVENT_MOUSE_BUTTON_DOWN);
+        event.button.clicks = 1;
+        event.button.x = x;
+        event.button.y = y;
+    }
+
+    SDL_PushEvent(&event);
+}
+
+void HeadlessRunner::CaptureFrame(SDL_Renderer* renderer, double render_ms)
+{
+    uint64_t hash = 0;
+
+    if (SDL_Surface* surface = SDL_RenderReadPixels(renderer, nullptr))
+    {
+        hash = HashSurface(surface);
+
+        if (options_.dump_frames)
+        {
+            const auto path = options_.output_dir / std::format("frame_{:05d}.bmp", frame_index_);
+            if (!SDL_SaveBMP(surface, path.string().c_str()))
+            {
+                LOGGER.Warning("Failed to dump frame {}: {}", frame_index_, SDL_GetError());
+            }
+        }
+
+        SDL_DestroySurface(surface);
+    }
+    else
+    {
+        LOGGER.Warning("Failed to read frame {} pixels: {}", frame_index_, SDL_GetError());
+    }
+
+    render_times_.push_back(render_ms);
+
+    if (frame_log_)
+    {
+        frame_log_ << std::format("{},{},{:.3f},{:016x}\n",
+            frame_index_, GetStateName(GAME_APP.GetStateManager().GetCurrentStateID()), render_ms, hash);
+    }
+
+    ++frame_index_;
+    if (options_.max_frames > 0 && frame_index_ >= options_.max_frames)
+    {
+        is_finished_ = true;
+    }
+}
+
+uint64_t HeadlessRunner::HashSurface(const SDL_Surface* surface)
+{
+    // FNV-1a 64,   óϿ pitch е 
+    constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+    constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+    uint64_t hash = FNV_OFFSET;
+    const size_t row_bytes = static_cast<size_t>(surface->w) * SDL_BYTESPERPIXEL(surface->format);
+    const auto* pixels = static_cast<const uint8_t*>(surface->pixels);
+
+    for (int y = 0; y < surface->h; ++y)
+    {
+        const uint8_t* row = pixels + static_cast<size_t>(y) * surface->pitch;
+        for (size_t i = 0; i < row_bytes; ++i)
+        {
+            hash ^= row[i];
+            hash *= FNV_PRIME;
+        }
+    }
+
+    return hash;
+}
@@ -0,0 +1,112 @@
+#pragma once
+/**
+ *
+ * : â (offscreen  ̹ + software )  ϴ 帮 
+ * 1. ũƮ  Ӻ Է(Ű/ؽƮ/콺/ ȯ) SDL ̺Ʈ 
+ * 2.     ؽ(FNV-1a 64)  ð CSV , ɼǿ  BMP 
+ * 3.  Ÿ Ÿ +  õ Ͽ  ̹ 񱳿    
+ * 4. ð ϰ Ӵ FRAME_TIME * time_scale ŭ   (--time-scale  ǽð  )
+ *
+ * ũƮ  ( ٿ  , '#' Ĵ ּ)
+ *   <frame> state <Login|Room|CharSelect|Game>
+ *   <frame> key <SDL Ű ̸>       (KeyDown + KeyUp)
+ *   <frame> keydown|keyup <SDL Ű ̸>
+ *   <frame> text <ڿ>
+ *   <frame> mouse <x> <y>
+ *   <frame> click <x> <y>
+ *   <frame> quit
+ *
+ */
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct HeadlessOptions
+{
+    std::filesystem::path script_path;
+    std::filesystem::path output_dir{ "headless_out" };
+    int max_frames{ 600 };
+    uint32_t seed{ 0x5EED };
+    bool dump_frames{ false };
+    float time_scale{ 1.0f };
+};
+
+class HeadlessRunner
+{
+public:
+
+    explicit HeadlessRunner(HeadlessOptions options);
+    ~HeadlessRunner();
+
+    HeadlessRunner(const HeadlessRunner&) = delete;
+    HeadlessRunner& operator=(const HeadlessRunner&) = delete;
+    HeadlessRunner(HeadlessRunner&&) = delete;
+    HeadlessRunner& operator=(HeadlessRunner&&) = delete;
+
+    // --headless [--script <path>] [--frames <n>] [--out <dir>] [--seed <n>] [--dump-frames] [--time-scale <x>]
+    [[nodiscard]] static std::optional<HeadlessOptions> ParseCommandLine(int argc, char* argv[]);
+
+    [[nodiscard]] bool Initialize();
+    void Release();
+
+    void BeginFrame();
+    void CaptureFrame(SDL_Renderer* renderer, double render_ms);
+
+    [[nodiscard]] bool IsFinished() const { return is_finished_; }
+    [[nodiscard]] int GetFrameIndex() const { return frame_index_; }
+
+    //   Ӹ     
+    [[nodiscard]] int GetStepsPerFrame() const;
+    [[nodiscard]] const HeadlessOptions& GetOptions() const { return options_; }
+
+private:
+
+    enum class CommandType : uint8_t
+    {
+        State,
+        KeyDown,
+        KeyUp,
+        KeyPress,
+        Text,
+        MouseMove,
+        Click,
+        Quit
+    };
+
+    struct ScriptCommand
+    {
+        int frame{ 0 };
+        CommandType type{ CommandType::Quit };
+        std::string text;
+        SDL_Keycode key{ SDLK_UNKNOWN };
+        float x{ 0.0f };
+        float y{ 0.0f };
+    };
+
+    [[nodiscard]] bool LoadScript();
+    [[nodiscard]] bool ParseLine(const std::string& line, int lineNumber);
+    void Dispatch(const ScriptCommand& command);
+
+    void PushKeyEvent(SDL_EventType type, SDL_Keycode key);
+    void PushMouseEvent(SDL_EventType type, float x, float y);
+
+    [[nodiscard]] static uint64_t HashSurface(const SDL_Surface* surface);
+
+private:
+
+    HeadlessOptions options_;
+    std::vector<ScriptCommand> commands_;
+    size_t next_command_{ 0 };
+
+    std::ofstream frame_log_;
+    std::vector<double> render_times_;
+
+    int frame_index_{ 0 };
+    bool is_finished_{ false };
+};
@@ -7,6 +7,7 @@
  */
 
 
+#include <cstddef>
 #include <string>
 #include <string_view>
 
@@ -20,5 +21,8 @@ public:
     [[nodiscard]] virtual bool Load(const std::string& path) = 0;    
     [[nodiscard]] virtual bool IsLoaded() const = 0;
     [[nodiscard]] virtual std::string_view GetResourcePath() const = 0;
+
+    // ޸   뷫  ũ (Ʈ)
+    [[nodiscard]] virtual size_t GetMemorySize() const { return 0; }
     
 };
\ No newline at end of file
@@ -0,0 +1,585 @@
+#include "MicroBenchmark.hpp"
+#include "common/constants/Constants.hpp"
+
+#include "../game/analysis/BoardBatch.hpp"
+#include "../game/block/Block.hpp"
+#include "../game/block/GameGroupBlock.hpp"
+#include "../game/system/BasePlayer.hpp"
+#include "../game/system/MatchRandom.hpp"
+#include "../network/RingBuffer.hpp"
+#include "../network/PacketProcessor.hpp"
+#include "../network/packets/GamePackets.hpp"
+#include "../resource/AssetPack.hpp"
+#include "../utils/Logger.hpp"
+#include "../utils/TimerScheduler.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint32_t BOARD_SEED = 0x5EED;
+    constexpr int LOGGER_BURST_SIZE = 256;
+    constexpr size_t POP_BATCH_SIZE = 64;
+
+    //   ȣ ȭ  ʵ   д
+    volatile uint64_t g_sink = 0;
+
+    // puyo.txt  ã   ϴ ⺻  ( puyo.txt  )
+    constexpr std::string_view DEFAULT_BOARD =
+        "000000\n000000\n000000\n000000\n000000\n000000\n000000\n000000\n000000\n"
+        "012340\n123450\n123450\n123450\n";
+
+    // Ʒ rows   õ  (1~5) ä 
+    std::string CreateRandomBoard(int rows)
+    {
+        std::mt19937 random(BOARD_SEED);
+        std::uniform_int_distribution<int> color(static_cast<int>(BlockType::Red), static_cast<int>(BlockType::Purple));
+
+        std::string text;
+        for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; ++y)
+        {
+            const bool filled = y >= Constants::Board::BOARD_Y_COUNT - rows;
+            for (int x = 0; x < Constants::Board::BOARD_X_COUNT; ++x)
+            {
+                text += filled ? static_cast<char>('0' + color(random)) : '0';
+            }
+            text += '\n';
+        }
+
+        return text;
+    }
+
+    //   ˻ϱ  ÷̾ (ؽó//Ʈũ )
+    class BenchPlayer final : public BasePlayer
+    {
+    public:
+
+        explicit BenchPlayer(const std::string& board)
+        {
+            CreateBlocksFromText(board, nullptr);
+        }
+
+        using BasePlayer::FindMatchedBlocks;
+        using BasePlayer::UpdateBlockLinks;
+
+        [[nodiscard]] std::list<std::shared_ptr<Block>>* GetBlockList() { return &block_list_; }
+
+        void ClearRecursionCheck()
+        {
+            for (const auto& block : block_list_)
+            {
+                block->SetRecursionCheck(false);
+            }
+        }
+
+        bool Initialize(uint8_t, uint16_t, const std::shared_ptr<GameBackground>&) override { return true; }
+        bool Restart() override { return true; }
+        void CreateNextBlock() override {}
+        void PlayNextBlock() override {}
+        bool CheckGameBlockState() override { return true; }
+        void MoveBlock(uint8_t, float) override {}
+        void RotateBlock(uint8_t, bool) override {}
+        void UpdateBlockPosition(float, float) override {}
+        void UpdateFallingBlock(uint8_t, bool) override {}
+        void ChangeBlockState(uint8_t) override {}
+        void AttackInterruptBlock(float, float, uint8_t) override {}
+        void DefenseInterruptBlockCount(int16_t, float, float, uint8_t) override {}
+
+    protected:
+
+        void CreateBullet(Block*) override {}
+    };
+
+    // ؽó  ⺻       (SetGroupBlock  ÷̾ Ŵ ȸϹǷ  )
+    class BenchControlBlock final : public GameGroupBlock
+    {
+    public:
+
+        BenchControlBlock(float x, float y, std::list<std::shared_ptr<Block>>* gameBlocks)
+        {
+            const BlockType types[] = { BlockType::Red, BlockType::Blue };
+            for (size_t i = 0; i < blocks_.size(); ++i)
+            {
+                blocks_[i]->SetBlockType(types[i % 2]);
+            }
+
+            SetState(BlockState::Playing);
+            SetPosXY(x, y);
+            SetGameBlocks(gameBlocks);
+        }
+    };
+
+    struct TimerRearm
+    {
+        TimerScheduler* scheduler;
+        float delay;
+
+        void operator()() const
+        {
+            scheduler->ScheduleTask(delay, TimerRearm{ scheduler, delay });
+        }
+    };
+
+    struct CaseOptions
+    {
+        uint64_t max_iterations{ UINT64_MAX };
+        std::function<void()> between_samples;  //  ̿ ϸ  
+    };
+
+    class Suite
+    {
+    public:
+
+        explicit Suite(const MicroBenchmark::Options& options)
+            : options_(options)
+        {
+        }
+
+        [[nodiscard]] bool Matches(std::string_view name) const
+        {
+            return options_.filter.empty() || name.find(options_.filter) != std::string_view::npos;
+        }
+
+        // body(iterations)    iterations  
+        template<typename Body>
+        void Measure(const std::string& name, Body&& body, const CaseOptions& caseOptions = {})
+        {
+            if (!Matches(name))
+            {
+                return;
+            }
+
+            auto runSample = [&](uint64_t iterations)
+            {
+                const auto start = Clock::now();
+                body(iterations);
+                const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+                if (caseOptions.between_samples)
+                {
+                    caseOptions.between_samples();
+                }
+                return elapsed;
+            };
+
+            //   MIN_SAMPLE_MS ̻ ɸ  ݺ Ƚ ø (ù  ־ )
+            constexpr double MIN_SAMPLE_NS = MicroBenchmark::MIN_SAMPLE_MS * 1'000'000.0;
+
+            uint64_t iterations = 1;
+            while (iterations < caseOptions.max_iterations)
+            {
+                const double elapsed = runSample(iterations);
+                if (elapsed >= MIN_SAMPLE_NS)
+                {
+                    break;
+                }
+
+                const double scale = (elapsed > 0.0) ? std::clamp(MIN_SAMPLE_NS * 1.2 / elapsed, 2.0, 100.0) : 100.0;
+                iterations = std::min(caseOptions.max_iterations, static_cast<uint64_t>(static_cast<double>(iterations) * scale));
+            }
+
+            std::vector<double> samples;
+            samples.reserve(options_.samples);
+            for (int i = 0; i < options_.samples; ++i)
+            {
+                samples.push_back(runSample(iterations) / static_cast<double>(iterations));
+            }
+            std::sort(samples.begin(), samples.end());
+
+            MicroBenchmark::Result result;
+            result.name = name;
+            result.iterations = iterations;
+            result.samples = static_cast<int>(samples.size());
+
+            if (!samples.empty())
+            {
+                result.mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+                result.p50_ns = samples[samples.size() / 2];
+                result.p99_ns = samples[static_cast<size_t>(static_cast<double>(samples.size() - 1) * 0.99)];
+                result.min_ns = samples.front();
+            }
+
+            results_.push_back(std::move(result));
+        }
+
+        [[nodiscard]] std::vector<MicroBenchmark::Result> TakeResults() { return std::move(results_); }
+
+    private:
+
+        const MicroBenchmark::Options& options_;
+        std::vector<MicroBenchmark::Result> results_;
+    };
+
+    std::vector<std::pair<std::string, std::string>> CreateBoards()
+    {
+        std::string puyoText;
+        if (!ASSET_PACK.ReadText(AssetPack::BOARD_FILE, puyoText))
+        {
+            puyoText = DEFAULT_BOARD;
+        }
+
+        return {
+            { "puyo_txt", std::move(puyoText) },
+            { "half_random", CreateRandomBoard(Constants::Board::BOARD_Y_COUNT / 2) },
+            { "full_random", CreateRandomBoard(Constants::Board::BOARD_Y_COUNT - 1) },
+        };
+    }
+
+    //   POP_BATCH_SIZE    ĭ ġ Ŀη   ã´ (ݺ 1ȸ = ġ 1ȸ)
+    void RunPopBatchCases(Suite& suite, const std::string& boardName, const std::string& boardText)
+    {
+        const auto board = Analysis::Board::FromText(boardText);
+        if (!board)
+        {
+            return;
+        }
+
+        for (const auto kernel : { Analysis::BoardBatch::Kernel::Scalar, Analysis::BoardBatch::Kernel::AVX2 })
+        {
+            Analysis::BoardBatch batch;
+            if (!batch.SetKernel(kernel))
+            {
+                continue;
+            }
+
+            for (size_t i = 0; i < POP_BATCH_SIZE; ++i)
+            {
+                batch.Add(*board);
+            }
+
+            std::vector<Analysis::CellMask> masks;
+            suite.Measure(std::format("pop_batch{}/{}/{}", POP_BATCH_SIZE, Analysis::BoardBatch::GetKernelName(kernel), boardName),
+                [&](uint64_t iterations)
+                {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        batch.FindPopMasks(masks);
+                        g_sink = g_sink + masks.back().low;
+                    }
+                });
+        }
+    }
+
+    void RunBoardCases(Suite& suite)
+    {
+        for (const auto& [boardName, boardText] : CreateBoards())
+        {
+            BenchPlayer player(boardText);
+            std::list<BasePlayer::BlockVector> matched;
+
+            // Ī   ӿ ŵǹǷ  ݺ  ˻ ǥø ǵ ( )
+            suite.Measure(std::format("match/{}", boardName), [&](uint64_t iterations)
+                {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        matched.clear();
+                        g_sink = g_sink + static_cast<uint64_t>(player.FindMatchedBlocks(matched)) + matched.size();
+                        player.ClearRecursionCheck();
+                    }
+                });
+
+            suite.Measure(std::format("links/{}", boardName), [&](uint64_t iterations)
+                {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        player.UpdateBlockLinks();
+                    }
+                });
+
+            //  ʿ    浹    ϰ  ˻
+            BenchControlBlock control(Constants::Board::WIDTH_MARGIN + Constants::Block::SIZE * 2, 0.0f, player.GetBlockList());
+
+            suite.Measure(std::format("collision/move_down/{}", boardName), [&](uint64_t iterations)
+                {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        g_sink = g_sink + static_cast<uint64_t>(control.MoveDown(true));
+                    }
+                });
+
+            RunPopBatchCases(suite, boardName, boardText);
+        }
+    }
+
+    void RunNetworkCases(Suite& suite)
+    {
+        MoveBlockPacket packet;
+        packet.player_id = 1;
+        packet.move_type = 2;
+        packet.position = 64.0f;
+
+        const auto bytes = packet.ToBytes();
+
+        if (suite.Matches("ring_buffer/get_release"))
+        {
+            RingBuffer ring;
+            ring.Create();
+
+            suite.Measure("ring_buffer/get_release", [&](uint64_t iterations)
+                {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        char* buffer = ring.GetBuffer(bytes.size());
+                        if (!buffer)
+                        {
+                            ring.Reset();
+                            continue;
+                        }
+
+                        std::memcpy(buffer, bytes.data(), bytes.size());
+                        g_sink = g_sink + static_cast<uint8_t>(buffer[0]);
+                        ring.ReleaseBuffer(bytes.size());
+                    }
+                });
+        }
+
+        PacketProcessor processor;
+        processor.RegisterHandler<MoveBlockPacket>(PacketType::UpdateBlockMove,
+            std::function<void(uint8_t, const MoveBlockPacket*)>([](uint8_t, const MoveBlockPacket* received)
+                {
+                    g_sink = g_sink + received->move_type;
+                }));
+
+        suite.Measure("packet/dispatch", [&](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    processor.ProcessPacket(0, std::span<const char>(bytes), static_cast<uint32_t>(bytes.size()));
+                }
+            });
+    }
+
+    void RunTimerCases(Suite& suite)
+    {
+        for (const size_t timerCount : { size_t{ 1'000 }, size_t{ 10'000 } })
+        {
+            const std::string name = std::format("timer/advance_step/{}", timerCount);
+            if (!suite.Matches(name))
+            {
+                continue;
+            }
+
+            //  Ÿ̸Ӵ   ٽ Ͽ    (1ms ~ 5s )
+            TimerScheduler scheduler(TimerScheduler::TimeSource::Manual);
+            std::mt19937 random(BOARD_SEED);
+            std::uniform_real_distribution<float> delay(0.001f, 5.0f);
+
+            for (size_t i = 0; i < timerCount; ++i)
+            {
+                const float value = delay(random);
+                scheduler.ScheduleTask(value, TimerRearm{ &scheduler, value });
+            }
+
+            suite.Measure(name, [&](uint64_t iterations)
+                {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        scheduler.Advance(Constants::Time::FIXED_STEP);
+                    }
+                    g_sink = g_sink + scheduler.GetActiveCount();
+                });
+        }
+    }
+
+    void RunRandomCases(Suite& suite)
+    {
+        //  ġ      õ ʱȭ (ġ   )
+        constexpr uint32_t PIECES_PER_MATCH = 1024;
+
+        suite.Measure("match_random/next_piece", [](uint64_t iterations)
+            {
+                uint32_t index = PIECES_PER_MATCH;
+                for (uint64_t i = 0; i < iterations; ++i, ++index)
+                {
+                    if (index == PIECES_PER_MATCH)
+                    {
+                        MATCH_RANDOM.Reset(BOARD_SEED + static_cast<uint32_t>(i));
+                        index = 0;
+                    }
+
+                    const auto piece = MATCH_RANDOM.GetPiece(index);
+                    g_sink = g_sink + piece[0] + piece[1];
+                }
+            });
+    }
+
+    void RunLoggerCases(Suite& suite)
+    {
+        if (!suite.Matches("logger/info_async"))
+        {
+            return;
+        }
+
+        LOGGER.Initialize();
+        LOGGER.SetLogToConsole(false);
+        LOGGER.SetLogToDebugger(false);
+        LOGGER.StartAsync();
+
+        //  ġ ʵ  Ʈ ũ ϰ  ̿ Flush (Flush   )
+        CaseOptions options;
+        options.max_iterations = LOGGER_BURST_SIZE;
+        options.between_samples = []() { LOGGER.Flush(); };
+
+        const std::string name = "puyo";
+        suite.Measure("logger/info_async", [&](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    LOGGER.Info("bench frame={} value={:.3f} name={} ok={}", i, static_cast<float>(i) * 0.5f, name, (i & 1) == 0);
+                }
+            }, options);
+
+        LOGGER.SetLogToConsole(true);
+        LOGGER.SetLogToDebugger(true);
+    }
+
+    void AppendJsonString(std::string& out, std::string_view text)
+    {
+        out += '"';
+        for (const char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+            }
+            out += c;
+        }
+        out += '"';
+    }
+}
+
+namespace MicroBenchmark
+{
+    std::optional<Options> ParseCommandLine(int argc, char* argv[])
+    {
+        Options options;
+        bool is_bench = false;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg(argv[i]);
+            const bool has_value = i + 1 < argc;
+
+            if (arg == "--bench")
+            {
+                is_bench = true;
+                if (has_value && std::string_view(argv[i + 1]).substr(0, 2) != "--")
+                {
+                    options.filter = argv[++i];
+                }
+            }
+            else if (arg == "--bench-out" && has_value)
+            {
+                options.output_path = argv[++i];
+            }
+            else if (arg == "--bench-samples" && has_value)
+            {
+                const std::string_view value(argv[++i]);
+                if (std::from_chars(value.data(), value.data() + value.size(), options.samples).ec != std::errc{} || options.samples < 1)
+                {
+                    LOGGER.Warning("Invalid --bench-samples value: {}", value);
+                    options.samples = MicroBenchmark::DEFAULT_SAMPLES;
+                }
+            }
+        }
+
+        if (!is_bench)
+        {
+            return std::nullopt;
+        }
+
+        return options;
+    }
+
+    std::vector<Result> Run(const Options& options)
+    {
+        Suite suite(options);
+
+        RunBoardCases(suite);
+        RunNetworkCases(suite);
+        RunTimerCases(suite);
+        RunRandomCases(suite);
+        RunLoggerCases(suite);
+
+        auto results = suite.TakeResults();
+        if (results.empty())
+        {
+            LOGGER.Warning("[MicroBenchmark] No benchmark matches filter '{}'", options.filter);
+        }
+
+        return results;
+    }
+
+    void LogResults(std::span<const Result> results)
+    {
+        for (const auto& result : results)
+        {
+            LOGGER.Info("[MicroBenchmark] name={} iterations={} samples={} mean={:.1f}ns p50={:.1f}ns p99={:.1f}ns min={:.1f}ns",
+                result.name,
+                result.iterations,
+                result.samples,
+                result.mean_ns,
+                result.p50_ns,
+                result.p99_ns,
+                result.min_ns);
+        }
+    }
+
+    bool WriteJson(std::span<const Result> results, const std::string& path)
+    {
+        std::ofstream stream(path, std::ios::trunc);
+        if (!stream)
+        {
+            LOGGER.Error("Failed to open benchmark output file: {}", path);
+            return false;
+        }
+
+#ifdef NDEBUG
+        constexpr std::string_view BUILD_TYPE = "release";
+#else
+        constexpr std::string_view BUILD_TYPE = "debug";
+#endif
+
+        // real_time/cpu_time  p50   (  ̹Ƿ   )
+        std::string json = std::format("{{\n  \"context\": {{\"num_cpus\": {}, \"library_build_type\": \"{}\"}},\n  \"benchmarks\": [",
+            std::thread::hardware_concurrency(), BUILD_TYPE);
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& result = results[i];
+
+            json += (i == 0) ? "\n    {\"name\": " : ",\n    {\"name\": ";
+            AppendJsonString(json, result.name);
+            json += ", \"run_name\": ";
+            AppendJsonString(json, result.name);
+            json += std::format(", \"run_type\": \"iteration\", \"repetitions\": {}, \"iterations\": {}, "
+                "\"real_time\": {:.3f}, \"cpu_time\": {:.3f}, \"time_unit\": \"ns\", "
+                "\"mean_ns\": {:.3f}, \"p99_ns\": {:.3f}, \"min_ns\": {:.3f}}}",
+                result.samples, result.iterations, result.p50_ns, result.p50_ns, result.mean_ns, result.p99_ns, result.min_ns);
+        }
+
+        json += "\n  ]\n}\n";
+        stream << json;
+
+        if (!stream)
+        {
+            LOGGER.Error("Failed to write benchmark output file: {}", path);
+            return false;
+        }
+
+        LOGGER.Info("[MicroBenchmark] {} results written to {}", results.size(), path);
+        return true;
+    }
+}
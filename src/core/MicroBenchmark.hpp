@@ -0,0 +1,48 @@
+#pragma once
+/*
+*
+* :   н ũ ġũ 
+* 1.   --bench [filter]  ϸ â  ʰ ̸ filter  Ե ̽   
+* 2. Ī ˻(FindMatchedBlocks/RecursionCheckBlock), ũ , ׷  浹, RingBuffer, Ŷ ġ,
+*    Ÿ̸ , ġ  , Logger, ġ  ĭ Ŀ(BoardBatch, Scalar/AVX2) puyo.txt    õ 
+* 3. ̽   MIN_SAMPLE_MS ̻ ɸ ݺ Ƚ   ú ns/op  /p50/p99/min  
+* 4. --bench-out <path>   Google Benchmark   JSON  Ͽ    ȸ ˻
+*
+*/
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace MicroBenchmark
+{
+    inline constexpr int DEFAULT_SAMPLES = 30;
+    inline constexpr double MIN_SAMPLE_MS = 2.0;
+
+    struct Options
+    {
+        std::string filter;
+        std::string output_path;
+        int samples{ DEFAULT_SAMPLES };
+    };
+
+    struct Result
+    {
+        std::string name;
+        uint64_t iterations{ 0 };   // ô ݺ Ƚ
+        int samples{ 0 };
+        double mean_ns{ 0.0 };
+        double p50_ns{ 0.0 };
+        double p99_ns{ 0.0 };
+        double min_ns{ 0.0 };
+    };
+
+    // --bench [filter] [--bench-out <path>] [--bench-samples <n>]
+    [[nodiscard]] std::optional<Options> ParseCommandLine(int argc, char* argv[]);
+
+    [[nodiscard]] std::vector<Result> Run(const Options& options);
+    void LogResults(std::span<const Result> results);
+    bool WriteJson(std::span<const Result> results, const std::string& path);
+}
@@ -95,7 +95,13 @@ namespace Constants
         constexpr int MINUTE = 60 * SECOND;
         constexpr int HOUR = 60 * MINUTE;
         constexpr int DAY = 24 * HOUR;
-        constexpr float FRAME_TIME = 1.0f / 60.0f;
+        constexpr float FRAME_TIME = 1.0f / 60.0f;                  //   (Ӵ ̵ ǵ  )
+
+        //    ֱ ϰ   
+        constexpr int LOGIC_RATE = 120;
+        constexpr float FIXED_STEP = 1.0f / static_cast<float>(LOGIC_RATE);
+        constexpr int MAX_STEPS_PER_FRAME = 8;                      //  ӿ  ִ  
+        constexpr float MAX_FRAME_TIME = 0.25f;                     // ߴ/â ̵   ð 
     }
 
     inline namespace Block
@@ -199,7 +205,9 @@ namespace Constants
         constexpr int MAX_PACKET_SIZE = 256;
         constexpr int PACKET_DATA_SIZE_LEN = MAX_PACKET_SIZE - PACKET_SIZE_LEN;
         constexpr int MAX_WORKERTHREAD = 1;
-        constexpr int MAX_CLIENT = 4;
+        constexpr int MAX_CLIENT = 8;              //   ִ ÷̾  ( , 3 ̸̻  )
+        constexpr int MAX_SPECTATOR = 256;
+        constexpr int MAX_CONNECTION = MAX_CLIENT + MAX_SPECTATOR;
         constexpr int MAX_RINGBUFSIZE = 1024;
 
         constexpr int CLIENT_BUF_SIZE = 256;
@@ -228,6 +236,7 @@ namespace Constants
             constexpr float GRAVITY = 98.0f;
             constexpr float DEFAULT_LIFETIME = 5.0f;
             constexpr size_t PARTICLE_COUNT = 10;
+            constexpr size_t MAX_EMITTERS = 256;        // ÿ   ִ  ̹ 
         }
     }   
 
@@ -6,6 +6,7 @@
 #include <cassert>
 #include "../../utils/PathUtil.hpp"
 #include "../../utils/Logger.hpp"
+#include "../../resource/AssetPack.hpp"
 
 void FontManager::FontDeleter::operator()(TTF_Font* font) const
 {
@@ -74,7 +75,7 @@ void FontManager::LoadFont(FontType type, const std::string& filename, float siz
         std::string fontPath = PathUtil::CombinePaths(exeBasePath, PathUtil::CombinePaths(PathUtil::FONT_DIR, filename));
         std::string fullPath = PathUtil::CombinePaths(exeBasePath, fontPath);
         
-        auto font = TTF_OpenFont(fullPath.c_str(), size);
+        auto font = TTF_OpenFontIO(ASSET_PACK.OpenIO(fullPath), true, size);
         if (font == nullptr) 
         {
             throw std::runtime_error(std::format("Failed to load font {}: {}", fullPath, SDL_GetError()));
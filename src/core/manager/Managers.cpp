@@ -12,38 +12,23 @@
 #include "MapManager.hpp"
 #include "ParticleManager.hpp"
 #include "PlayerManager.hpp"
+#include "../../texture/RenderRecorder.hpp"
 #include "../../utils/Logger.hpp"
+#include "../../utils/StartupProfiler.hpp"
+#include "../../utils/FrameProfiler.hpp"
 
 
 bool Managers::CreateManagers() 
 {
     try 
     {
-        //  Ŵ         
+        //  Ŵ  (/ƼŬ  ¿ ϹǷ ó   ʱȭ)
         createManager<ResourceManager>();
         createManager<FontManager>();
-        createManager<MapManager>();        
+        createManager<MapManager>(true);
         createManager<PlayerManager>();
         createManager<StateManager>();
-        createManager<ParticleManager>();
-
-
-        //  Ŵ    
-        renderables_.clear();
-
-        for (const auto& [name, manager] : managers_) 
-        {
-            if (auto* renderable = dynamic_cast<IRenderable*>(manager.get())) 
-            {
-                renderables_.push_back(renderable);
-            }
-        }
-
-        std::sort(renderables_.begin(), renderables_.end(),
-            [](IRenderable* a, IRenderable* b) 
-            {
-                return a->GetRenderPriority() < b->GetRenderPriority();
-            });
+        createManager<ParticleManager>(true);
 
         return true;
     }
@@ -58,13 +43,23 @@ bool Managers::Initialize()
 {
     try
     {
-        for (const auto& [name, manager] : managers_)
+        deferred_count_ = 0;
+
+        for (auto& entry : managers_)
         {
-            if (!manager->Initialize())
+            if (entry.is_deferred)
             {
-                throw std::runtime_error(std::format("Ŵ ʱȭ : {}", name));
+                ++deferred_count_;
+                continue;
+            }
+
+            if (!InitializeEntry(entry))
+            {
+                throw std::runtime_error(std::format("Ŵ ʱȭ : {}", entry.manager->GetName()));
             }
         }
+
+        RebuildRenderables();
         return true;
     }
     catch (const std::exception& e)
@@ -74,45 +69,127 @@ bool Managers::Initialize()
     }
 }
 
+bool Managers::InitializeEntry(ManagerEntry& entry)
+{
+    STARTUP_SCOPE(std::format("{}::Initialize", entry.manager->GetName()), "manager");
+
+    entry.is_initialized = entry.manager->Initialize();
+    return entry.is_initialized;
+}
+
+void Managers::InitializeDeferred(IManager& manager)
+{
+    for (auto& entry : managers_)
+    {
+        if (entry.manager.get() != &manager)
+        {
+            continue;
+        }
+
+        if (entry.is_initialized || !entry.is_deferred)
+        {
+            return;
+        }
+
+        --deferred_count_;
+
+        if (!InitializeEntry(entry))
+        {
+            throw std::runtime_error(std::format("Ŵ  ʱȭ : {}", manager.GetName()));
+        }
+
+        LOGGER.Info("Deferred manager initialized: {}", manager.GetName());
+        RebuildRenderables();
+        return;
+    }
+}
+
+void Managers::RebuildRenderables()
+{
+    // ʱȭ  Ŵ 켱  ĳ
+    renderables_.clear();
+
+    for (const auto& entry : managers_)
+    {
+        if (!entry.is_initialized)
+        {
+            continue;
+        }
+
+        if (auto* renderable = dynamic_cast<IRenderable*>(entry.manager.get()))
+        {
+            renderables_.push_back(renderable);
+        }
+    }
+
+    std::stable_sort(renderables_.begin(), renderables_.end(),
+        [](IRenderable* a, IRenderable* b) 
+        {
+            return a->GetRenderPriority() < b->GetRenderPriority();
+        });
+}
 
 
 void Managers::Update(float dateTime) 
 {
-    for (const auto& [name, manager] : managers_) 
+    PROFILE_SCOPE(ProfileZone::ManagersUpdate);
+
+    for (const auto& entry : managers_) 
     {
-        manager->Update(dateTime);
+        if (entry.is_initialized)
+        {
+            entry.manager->Update(dateTime);
+        }
     }
 }
 
 void Managers::Release() 
 {
-    for (const auto& [name, manager] : managers_) 
+    // ٸ Ŵ ϴ ResourceManager   ǵ  ó
+    for (auto it = managers_.rbegin(); it != managers_.rend(); ++it)
     {
-        manager->Release();
+        if (it->is_initialized)
+        {
+            it->manager->Release();
+        }
     }
 
+    renderables_.clear();
     managers_.clear();
+    deferred_count_ = 0;
 }
 
 void Managers::RenderAll(SDL_Renderer* renderer) 
 {
+    RenderFrame(renderer);
+    SDL_RenderPresent(renderer);
+}
+
+// Present    ׸ (帮 忡 Present  ȼ б )
+void Managers::RenderFrame(SDL_Renderer* renderer)
+{
+    PROFILE_SCOPE(ProfileZone::Render);
+
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderClear(renderer);
+    RENDER_RECORDER.Clear(renderer);
 
     // ĳõ   
     for (auto renderable : renderables_) 
     {
         renderable->Render();
     }
-
-    SDL_RenderPresent(renderer);
 }
 
 void Managers::HandleEvents(const SDL_Event& event)
 {    
-   for (const auto& [name, manager] : managers_)
+   for (const auto& entry : managers_)
    {
-       if (auto eventHandler = dynamic_cast<IEventHandler*>(manager.get()))
+       if (!entry.is_initialized)
+       {
+           continue;
+       }
+
+       if (auto eventHandler = dynamic_cast<IEventHandler*>(entry.manager.get()))
        {
            eventHandler->HandleEvent(event);
        }
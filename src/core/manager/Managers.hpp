@@ -2,13 +2,15 @@
 /*
  *
  * : IManager  Manager Ŭ    Ŭ 
+ * 1.   ʱȭ/ϰ  
+ * 2. ù ȭ(LoginState) ʿ  Ŵ    ϰ, ó   EnsureInitialized  ʱȭ
  *
  */
 
 #include "IManager.hpp"
 #include <memory>
-#include <unordered_map>
 #include <string_view>
+#include <vector>
 #include <concepts>
 
 class IRenderable;
@@ -32,32 +34,64 @@ public:
     template<std::derived_from<IManager> T>
     [[nodiscard]] T* GetManager(std::string_view name) const
     {
-        if (auto it = managers_.find(std::string(name)); it != managers_.end())
+        for (const auto& entry : managers_)
         {
-            return dynamic_cast<T*>(it->second.get());
+            if (entry.manager->GetName() == name)
+            {
+                return dynamic_cast<T*>(entry.manager.get());
+            }
         }
 
         return nullptr;
     }
 
+    //  ʱȭ     ȸϹǷ  ʱȭ ڿ  
+    void EnsureInitialized(IManager& manager)
+    {
+        if (deferred_count_ > 0)
+        {
+            InitializeDeferred(manager);
+        }
+    }
+
     bool Initialize();
     void Update(float deltaTime);
     void Release();
     void RenderAll(SDL_Renderer* renderer);
+    void RenderFrame(SDL_Renderer* renderer);
     void HandleEvents(const SDL_Event& event);
     
 
 private:
+    struct ManagerEntry
+    {
+        std::unique_ptr<IManager> manager;
+        bool is_deferred{ false };
+        bool is_initialized{ false };
+    };
+
     template<std::derived_from<IManager> T>
-    bool createManager()
+    bool createManager(bool deferred = false)
     {
         auto manager = std::make_unique<T>();
-        auto [it, inserted] = managers_.emplace(manager->GetName(), std::move(manager));
-        return inserted;
+
+        if (GetManager<IManager>(manager->GetName()) != nullptr)
+        {
+            return false;
+        }
+
+        managers_.push_back({ std::move(manager), deferred, false });
+        return true;
     }
 
+    bool InitializeEntry(ManagerEntry& entry);
+    void InitializeDeferred(IManager& manager);
+    void RebuildRenderables();
+
 private:
     
-    std::unordered_map<std::string, std::unique_ptr<IManager>> managers_;
+    //   = ʱȭ  (ResourceManager  ٸ Ŵ  غǾ )
+    std::vector<ManagerEntry> managers_;
     std::vector<IRenderable*> renderables_;   
+    size_t deferred_count_{ 0 };
 };
\ No newline at end of file
@@ -72,6 +72,14 @@ std::shared_ptr<GameBackground> MapManager::CreateMap(uint8_t index)
     return new_map;
 }
 
+void MapManager::CollectTexturePaths(std::vector<std::string>& paths) const
+{
+    for (const auto index : map_indices_)
+    {
+        GameBackground::CollectTexturePaths(index, paths);
+    }
+}
+
 std::shared_ptr<GameBackground> MapManager::GetRandomMap() 
 {
     if (map_indices_.empty()) 
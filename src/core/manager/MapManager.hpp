@@ -10,6 +10,7 @@
 #include <memory>
 #include <unordered_map>
 #include <vector>
+#include <string>
 #include <string_view>
 
 class GameBackground;
@@ -45,6 +46,9 @@ public:
     [[nodiscard]] std::shared_ptr<GameBackground> GetCurrentMap() const { return current_map_; }
     bool RemoveMap(uint8_t index);
 
+    // õ  ִ   ؽó 
+    void CollectTexturePaths(std::vector<std::string>& paths) const;
+
 private:
     
     GameMapContainer game_maps_;
@@ -1,10 +1,14 @@
 #include "ParticleManager.hpp"
 #include "../../game/effect/ParticleContainer.hpp"
+#include "../../game/effect/ExplosionEffect.hpp"
 #include "../../texture/ImageTexture.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 #include "../../utils/Logger.hpp"
+#include "../../utils/FrameJobSystem.hpp"
+#include "../../utils/FrameProfiler.hpp"
 
 
 ParticleManager::~ParticleManager() 
@@ -26,6 +30,7 @@ bool ParticleManager::Initialize()
     {
         containers_.clear();
         textures_.clear();
+        ResizeExplosionPool(max_explosions_);
         is_draw_enabled_ = true;
         is_initialized_ = true;
         return true;
@@ -44,6 +49,20 @@ void ParticleManager::Update(float deltaTime)
         return;
     }
 
+    // 프레임당 한 번, 게임 로직 이후 프레임 잡 단계에서 시뮬레이션
+    FRAME_JOBS.Submit("Particles", [this, deltaTime]()
+        {
+            Simulate(deltaTime);
+        });
+}
+
+void ParticleManager::Simulate(float deltaTime)
+{
+    // 작업 스레드에서 실행되므로 해당 스레드의 히스토그램에 기록
+    PROFILE_SCOPE(ProfileZone::ParticleUpdate);
+
+    UpdateExplosions(deltaTime);
+
     for (auto it = containers_.begin(); it != containers_.end();) 
     {
         if ((*it)->GetAliveParticleCount() == 0) 
@@ -70,6 +89,15 @@ void ParticleManager::RenderForPlayer(uint8_t playerId)
         return;
     }
 
+    for (size_t index : active_explosions_)
+    {
+        auto& explosion = *explosion_pool_[index];
+        if (explosion.GetPlayerID() == playerId)
+        {
+            explosion.Render();
+        }
+    }
+
     for (const auto& container : containers_) 
     {
         if (container->GetPlayerID() == playerId) 
@@ -124,6 +152,125 @@ void ParticleManager::RemoveParticleContainer(const ParticleContainer& container
         });
 }
 
+ExplosionContainer* ParticleManager::SpawnExplosion(const SDL_FPoint& position, BlockType type, uint8_t playerId)
+{
+    if (!is_initialized_)
+    {
+        throw std::runtime_error("ParticleManager not initialized");
+    }
+
+    if (explosion_pool_.empty())
+    {
+        return nullptr;
+    }
+
+    // 텍스처는 최초 1회만 조회하고 이후에는 모든 이미터가 공유
+    if (!explosion_texture_)
+    {
+        explosion_texture_ = ImageTexture::Create(ExplosionContainer::TEXTURE_PATH);
+        if (!explosion_texture_)
+        {
+            return nullptr;
+        }
+    }
+
+    const size_t index = AcquireExplosionSlot();
+    auto& explosion = *explosion_pool_[index];
+
+    explosion.SetTexture(explosion_texture_);
+    explosion.SetBlockType(type);
+    explosion.SetPlayerID(playerId);
+    explosion.SetPosition(position);
+
+    if (!explosion.InitializeParticles())
+    {
+        free_explosions_.push_back(index);
+        return nullptr;
+    }
+
+    active_explosions_.push_back(index);
+    peak_explosions_ = std::max(peak_explosions_, active_explosions_.size());
+
+    return &explosion;
+}
+
+void ParticleManager::SetMaxExplosionEmitters(size_t count)
+{
+    max_explosions_ = count;
+
+    // 풀 재구성은 힙 할당이 발생하므로 게임 플레이 중이 아닌 시점에 호출해야 한다.
+    if (is_initialized_)
+    {
+        ResizeExplosionPool(max_explosions_);
+    }
+}
+
+void ParticleManager::ResizeExplosionPool(size_t capacity)
+{
+    active_explosions_.clear();
+    free_explosions_.clear();
+
+    explosion_pool_.resize(capacity);
+    active_explosions_.reserve(capacity);
+    free_explosions_.reserve(capacity);
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        if (!explosion_pool_[i])
+        {
+            explosion_pool_[i] = std::make_unique<ExplosionContainer>();
+        }
+
+        // 스택처럼 꺼내 쓰므로 낮은 인덱스부터 사용되도록 역순으로 쌓는다.
+        free_explosions_.push_back(capacity - 1 - i);
+    }
+
+    peak_explosions_ = 0;
+    evicted_explosions_ = 0;
+}
+
+size_t ParticleManager::AcquireExplosionSlot()
+{
+    if (!free_explosions_.empty())
+    {
+        const size_t index = free_explosions_.back();
+        free_explosions_.pop_back();
+        return index;
+    }
+
+    // 상한에 도달하면 가장 오래된 이미터를 회수하여 재사용
+    assert(!active_explosions_.empty());
+    const size_t oldest = active_explosions_.front();
+    active_explosions_.erase(active_explosions_.begin());
+    ++evicted_explosions_;
+
+    return oldest;
+}
+
+void ParticleManager::UpdateExplosions(float deltaTime)
+{
+    size_t write = 0;
+
+    for (size_t read = 0; read < active_explosions_.size(); ++read)
+    {
+        const size_t index = active_explosions_[read];
+        auto& explosion = *explosion_pool_[index];
+
+        explosion.Update(deltaTime);
+
+        if (explosion.GetAliveParticleCount() == 0)
+        {
+            free_explosions_.push_back(index);
+        }
+        else
+        {
+            active_explosions_[write++] = index;
+        }
+    }
+
+    active_explosions_.resize(write);
+}
+
 std::shared_ptr<ImageTexture> ParticleManager::FindParticleTexture(const std::string& name) 
 {
     if (!is_initialized_)
@@ -145,5 +292,11 @@ void ParticleManager::ClearAllResources()
 {
     containers_.clear();
     textures_.clear();
+
+    active_explosions_.clear();
+    free_explosions_.clear();
+    explosion_pool_.clear();
+    explosion_texture_.reset();
+
     is_draw_enabled_ = true;
 }
\ No newline at end of file
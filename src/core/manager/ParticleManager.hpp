@@ -9,13 +9,17 @@
 #include "IManager.hpp"
 #include "../IRenderable.hpp"
 #include "../../game/effect/ParticleContainer.hpp"
+#include "../../game/effect/ExplosionEffect.hpp"
+#include "../common/constants/Constants.hpp"
 #include <list>
+#include <vector>
 #include <string>
 #include <unordered_map>
 #include <memory>
 #include <SDL3/SDL.h> 
 
 class ImageTexture;
+enum class BlockType;
 
 class ParticleManager : public IManager, public IRenderable 
 {
@@ -23,6 +27,7 @@ public:
 
     using ParticleContainerList = std::list<std::shared_ptr<ParticleContainer>>;
     using TextureMap = std::unordered_map<std::string, std::shared_ptr<ImageTexture>>;
+    using ExplosionPool = std::vector<std::unique_ptr<ExplosionContainer>>;
 
     ParticleManager() = default;
     ~ParticleManager() override;
@@ -46,17 +51,39 @@ public:
     void AddParticleContainer(const std::shared_ptr<ParticleContainer>&& container, const SDL_FPoint& position);
     void RemoveParticleContainer(const ParticleContainer& container);
 
+    //   Ʈ ̸ Ҵ ̹ Ǯ  (    ̹͸ ȸ)
+    ExplosionContainer* SpawnExplosion(const SDL_FPoint& position, BlockType type, uint8_t playerId);
+    void SetMaxExplosionEmitters(size_t count);
+
+    [[nodiscard]] size_t GetMaxExplosionEmitters() const { return max_explosions_; }
+    [[nodiscard]] size_t GetActiveExplosionCount() const { return active_explosions_.size(); }
+    [[nodiscard]] size_t GetPeakExplosionCount() const { return peak_explosions_; }
+    [[nodiscard]] size_t GetEvictedExplosionCount() const { return evicted_explosions_; }
+
     void SetDrawEnabled(bool enabled) { is_draw_enabled_ = enabled; }
     [[nodiscard]] std::shared_ptr<ImageTexture> FindParticleTexture(const std::string& name);
 
 private:    
 
     void ClearAllResources();
+    void Simulate(float deltaTime);
+    void ResizeExplosionPool(size_t capacity);
+    [[nodiscard]] size_t AcquireExplosionSlot();
+    void UpdateExplosions(float deltaTime);
 
 private:    
 
     ParticleContainerList containers_;
     TextureMap textures_;
+
+    ExplosionPool explosion_pool_;
+    std::vector<size_t> free_explosions_;
+    std::vector<size_t> active_explosions_;     //    (   ̹)
+    std::shared_ptr<ImageTexture> explosion_texture_;
+    size_t max_explosions_{ Constants::Particle::Explosion::MAX_EMITTERS };
+    size_t peak_explosions_{ 0 };
+    size_t evicted_explosions_{ 0 };
+
     bool is_draw_enabled_{ true };
     bool is_initialized_{ false };
 };
\ No newline at end of file
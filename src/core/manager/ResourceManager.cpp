@@ -4,6 +4,7 @@
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_image.h>
 #include <SDL3/SDL_render.h>
+#include <algorithm>
 #include <format>
 #include "../../utils/Logger.hpp"
 
@@ -11,7 +12,7 @@ bool ResourceManager::Initialize()
 {
     try
     {
-        resources_.clear();
+        base_path_ = PathUtil::GetExecutableBasePath();
         return true;
     }
     catch (const std::exception& e)
@@ -23,35 +24,148 @@ bool ResourceManager::Initialize()
 
 void ResourceManager::Update(float deltaTime)
 {
+    EnforceMemoryBudget();
+
+    if (++frames_since_report_ >= STATS_REPORT_INTERVAL_FRAMES)
+    {
+        frames_since_report_ = 0;
+        LogStats();
+    }
 }
 
 void ResourceManager::Release()
 {
-    for (auto& [type, container] : resources_)
+    LogStats();
+
+    // 슬롯(ID)은 유지하고 리소스만 해제
+    for (auto& slot : slots_)
     {
-        for (auto& [path, resource] : container)
+        if (slot.resource)
         {
-            if (resource)
-            {
-                resource->Unload();
-            }
+            slot.resource->Unload();
+            slot.resource.reset();
         }
-        container.clear();
+        slot.memory_size = 0;
     }
-    resources_.clear();
+
+    resident_bytes_ = 0;
+    resident_count_ = 0;
     renderer_ = nullptr;
 }
 
-bool ResourceManager::IsResourceLoaded(const std::string& filename) const
+ResourceHandle ResourceManager::FindHandle(std::type_index type, const std::string& key) const
 {
-    for (const auto& [type, container] : resources_)
+    if (auto typeIt = ids_.find(type); typeIt != ids_.end())
     {
-        if (container.contains(filename))
+        if (auto it = typeIt->second.find(key); it != typeIt->second.end())
         {
-            return true;
+            return { it->second };
         }
     }
-    return false;
+
+    return {};
+}
+
+ResourceHandle ResourceManager::AddSlot(std::type_index type, const std::string& key, std::string fullPath)
+{
+    const auto id = static_cast<uint32_t>(slots_.size());
+
+    slots_.push_back({ type, key, std::move(fullPath) });
+    ids_[type].emplace(key, id);
+
+    return { id };
+}
+
+void ResourceManager::SetResident(ResourceSlot& slot, std::shared_ptr<IResource> resource)
+{
+    slot.resource = std::move(resource);
+    slot.memory_size = slot.resource->GetMemorySize();
+
+    resident_bytes_ += slot.memory_size;
+    ++resident_count_;
+}
+
+void ResourceManager::Evict(ResourceSlot& slot)
+{
+    if (!slot.resource)
+    {
+        return;
+    }
+
+    // 외부에서 참조 중이면 그쪽 수명이 끝날 때 해제되고, 캐시는 다음 Get 에서 다시 로드
+    slot.resource.reset();
+
+    resident_bytes_ -= slot.memory_size;
+    slot.memory_size = 0;
+    --resident_count_;
+}
+
+void ResourceManager::EnforceMemoryBudget()
+{
+    if (resident_bytes_ <= memory_budget_)
+    {
+        return;
+    }
+
+    // 캐시만 참조하는 리소스를 오래 사용되지 않은 순서로 축출
+    std::vector<uint32_t> candidates;
+    for (uint32_t i = 0; i < slots_.size(); ++i)
+    {
+        if (slots_[i].resource && slots_[i].resource.use_count() == 1)
+        {
+            candidates.push_back(i);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [this](uint32_t lhs, uint32_t rhs)
+        {
+            return slots_[lhs].last_used < slots_[rhs].last_used;
+        });
+
+    for (const auto id : candidates)
+    {
+        if (resident_bytes_ <= memory_budget_)
+        {
+            break;
+        }
+
+        auto& slot = slots_[id];
+        LOG_RESOURCE(Debug, "Evicting {} ({} bytes)", slot.key, slot.memory_size);
+
+        Evict(slot);
+        ++evictions_;
+    }
+
+    if (resident_bytes_ > memory_budget_)
+    {
+        LOG_RESOURCE(Warning, "Resident resources {} bytes exceed budget {} bytes (all in use)", resident_bytes_, memory_budget_);
+    }
+}
+
+ResourceCacheStats ResourceManager::GetStats() const
+{
+    return {
+        hits_,
+        misses_,
+        evictions_,
+        resident_count_,
+        resident_bytes_,
+        slots_.size(),
+        memory_budget_
+    };
+}
+
+void ResourceManager::LogStats() const
+{
+    const auto stats = GetStats();
+    const uint64_t lookups = stats.hits + stats.misses;
+
+    LOG_RESOURCE(Info, "Resource cache: hits={} misses={} hit_rate={:.1f}% evictions={} resident={}/{} ({:.1f}/{:.1f} MB)",
+        stats.hits, stats.misses,
+        lookups > 0 ? 100.0 * static_cast<double>(stats.hits) / static_cast<double>(lookups) : 0.0,
+        stats.evictions, stats.resident_count, stats.slot_count,
+        static_cast<double>(stats.resident_bytes) / (1024.0 * 1024.0),
+        static_cast<double>(stats.budget_bytes) / (1024.0 * 1024.0));
 }
 
 
@@ -2,6 +2,10 @@
 /*
  *
  * : IResource   asset  Class
+ * 1. δ Intern    ؼϿ ResourceHandle(迭 ε) ȸ, ڿ  API  Intern + Get
+ * 2. ҽ ܺο (shared_ptr)ϴ  , ĳø ϴ ҽ  
+ * 3.  ޸𸮰   Update     (LRU) ҽ 
+ * 4.  ҽ (ID) ǹǷ  Get  ٽ ε (miss  )
  *
  */
 
@@ -11,11 +15,14 @@
 #include <typeindex>
 #include <filesystem>
 #include <concepts>
+#include <cassert>
+#include <vector>
 
 #include <SDL3/SDL_filesystem.h>
 
 #include "IManager.hpp"
 #include "../IResource.hpp"
+#include "../../resource/ResourceHandle.hpp"
 #include "../../resource/ResourcePathTrait.hpp"
 #include "../../utils/Logger.hpp"
 
@@ -25,11 +32,24 @@ struct SDL_Texture;
 struct SDL_Surface;
 
 
-class ResourceManager final : public IManager 
+struct ResourceCacheStats
+{
+    uint64_t hits{ 0 };
+    uint64_t misses{ 0 };
+    uint64_t evictions{ 0 };
+    size_t resident_count{ 0 };
+    size_t resident_bytes{ 0 };
+    size_t slot_count{ 0 };
+    size_t budget_bytes{ 0 };
+};
+
+
+class ResourceManager final : public IManager
 {
 public:
 
-    using ResourceContainer = std::unordered_map<std::string, std::shared_ptr<IResource>>;
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 256ull * 1024 * 1024;
+    static constexpr int STATS_REPORT_INTERVAL_FRAMES = 3600;
 
     ResourceManager() = default;
     ~ResourceManager() override = default;
@@ -39,7 +59,7 @@ public:
     ResourceManager(ResourceManager&&) = delete;
     ResourceManager& operator=(ResourceManager&&) = delete;
 
-    
+
     [[nodiscard]] bool Initialize() override;
     void Update(float deltaTime) override;
     void Release() override;
@@ -47,6 +67,14 @@ public:
 
     SDL_Texture* CreateTextureFromSurface(SDL_Surface* surface) const;
 
+    // θ ID  ȯ (ε ),  Ÿ/δ ׻  ID
+    template<std::derived_from<IResource> T>
+    [[nodiscard]] ResourceHandle Intern(const std::string& path);
+
+    //  н O(1) ȸ,    ε
+    template<std::derived_from<IResource> T>
+    [[nodiscard]] std::shared_ptr<T> Get(ResourceHandle handle);
+
     template<std::derived_from<IResource> T>
     [[nodiscard]] std::shared_ptr<T> LoadResource(const std::string& path);
 
@@ -56,102 +84,187 @@ public:
     template<std::derived_from<IResource> T>
     void UnloadResource(const std::string& path);
 
-private:
-    bool IsResourceLoaded(const std::string& filename) const;
+    // ĳø ȸ ( nullptr, ε )
+    template<std::derived_from<IResource> T>
+    [[nodiscard]] std::shared_ptr<T> FindResource(const std::string& path) const;
 
+    // ܺ(AssetLoader) ε ҽ , ̹   ҽ ȯ
     template<std::derived_from<IResource> T>
-    [[nodiscard]] ResourceContainer& GetResourceContainer();
+    std::shared_ptr<T> AddResource(const std::string& path, std::shared_ptr<T> resource);
 
+    // GetResource  ϴ θ   η ȯ
     template<std::derived_from<IResource> T>
-    [[nodiscard]] const ResourceContainer& GetResourceContainer() const;
+    [[nodiscard]] std::string GetFullPath(const std::string& path) const;
+
+    void SetMemoryBudget(size_t bytes) { memory_budget_ = bytes; }
+    [[nodiscard]] ResourceCacheStats GetStats() const;
+    void LogStats() const;
+
+private:
+
+    struct ResourceSlot
+    {
+        std::type_index type;
+        std::string key;
+        std::string full_path;
+        std::shared_ptr<IResource> resource;
+        size_t memory_size{ 0 };
+        uint64_t last_used{ 0 };
+    };
+
+    [[nodiscard]] ResourceHandle FindHandle(std::type_index type, const std::string& key) const;
+    [[nodiscard]] ResourceHandle AddSlot(std::type_index type, const std::string& key, std::string fullPath);
+
+    void SetResident(ResourceSlot& slot, std::shared_ptr<IResource> resource);
+    void Evict(ResourceSlot& slot);
+    void EnforceMemoryBudget();
 
 private:
-    
-    std::unordered_map<std::type_index, ResourceContainer> resources_;
+
+    // ԰ ID ̺ Release Ŀ  (   ڵ  ȿϵ)
+    std::vector<ResourceSlot> slots_;
+    std::unordered_map<std::type_index, std::unordered_map<std::string, uint32_t>> ids_;
+
+    size_t memory_budget_{ DEFAULT_MEMORY_BUDGET };
+    size_t resident_bytes_{ 0 };
+    size_t resident_count_{ 0 };
+    uint64_t use_clock_{ 0 };
+
+    uint64_t hits_{ 0 };
+    uint64_t misses_{ 0 };
+    uint64_t evictions_{ 0 };
+    int frames_since_report_{ 0 };
+
+    //    (Initialize    )
+    std::string base_path_;
 
     SDL_Renderer* renderer_{ nullptr };
-   
+
 };
 
 
 template<std::derived_from<IResource> T>
-std::shared_ptr<T> ResourceManager::GetResource(const std::string& path)
+ResourceHandle ResourceManager::Intern(const std::string& path)
 {
-    std::string exeBasePath = PathUtil::GetExecutableBasePath();
-    if (exeBasePath.empty()) 
-    {    
-        SDL_Log("Executable path is empty()");
+    const std::type_index type(typeid(T));
+
+    if (auto handle = FindHandle(type, path); handle.IsValid())
+    {
+        return handle;
+    }
+
+    return AddSlot(type, path, GetFullPath<T>(path));
+}
+
+template<std::derived_from<IResource> T>
+std::shared_ptr<T> ResourceManager::Get(ResourceHandle handle)
+{
+    if (!handle.IsValid() || handle.id >= slots_.size())
+    {
         return nullptr;
     }
 
-    std::string assetPath = PathUtil::CombinePaths(ResourcePathTrait<T>::BaseDir, path);
-    std::string fullPath = PathUtil::CombinePaths(exeBasePath, assetPath);
+    auto& slot = slots_[handle.id];
+    assert(slot.type == std::type_index(typeid(T)));
 
-    const auto& container = GetResourceContainer<T>();
+    slot.last_used = ++use_clock_;
 
-    if (auto it = container.find(fullPath); it != container.end())
+    if (slot.resource)
     {
-        return static_pointer_cast<T>(it->second);
+        ++hits_;
+        return std::static_pointer_cast<T>(slot.resource);
     }
-    
+
+    ++misses_;
+
+    // ε  ٸ ΰ ϵǸ  迭 Ҵ  Ƿ   纻 
+    const std::string fullPath = slot.full_path;
+
     try
     {
-        return LoadResource<T>(fullPath);
+        //  ҽ   ε
+        auto resource = std::make_shared<T>();
+
+        if (!resource->Load(fullPath))
+        {
+            throw std::runtime_error("Failed to load resource: " + fullPath);
+        }
+
+        LOG_RESOURCE(Debug, "Loaded resource {}", fullPath);
+
+        SetResident(slots_[handle.id], resource);
+        return resource;
     }
     catch (const std::exception& e)
     {
-        SDL_LOG_ERROR(SDL_LOG_CATEGORY_APPLICATION, "Failed to load resource '%s': %s", fullPath.c_str(), e.what());
+        LOG_RESOURCE(Error, "Failed to load resource '{}': {}", fullPath, e.what());
         return nullptr;
     }
 }
 
-
 template<std::derived_from<IResource> T>
-void ResourceManager::UnloadResource(const std::string& path)
+std::shared_ptr<T> ResourceManager::GetResource(const std::string& path)
 {
-    auto& container = GetResourceContainer<T>();
-    container.erase(path);
+    return Get<T>(Intern<T>(path));
 }
 
-
 template<std::derived_from<IResource> T>
-ResourceManager::ResourceContainer& ResourceManager::GetResourceContainer()
+std::shared_ptr<T> ResourceManager::LoadResource(const std::string& path)
 {
-    return resources_[std::type_index(typeid(T))];
-}
+    // ޵ θ ״   η 
+    const std::type_index type(typeid(T));
 
-template<std::derived_from<IResource> T>
-const ResourceManager::ResourceContainer& ResourceManager::GetResourceContainer() const
-{
-    if (auto it = resources_.find(std::type_index(typeid(T))); it != resources_.end())
+    auto handle = FindHandle(type, path);
+    if (!handle.IsValid())
     {
-        return it->second;
+        handle = AddSlot(type, path, path);
     }
 
-    static const ResourceContainer empty;
-    return empty;
+    auto resource = Get<T>(handle);
+    if (!resource)
+    {
+        throw std::runtime_error("Failed to load resource: " + path);
+    }
 
+    return resource;
 }
 
 template<std::derived_from<IResource> T>
-std::shared_ptr<T> ResourceManager::LoadResource(const std::string& path)
+void ResourceManager::UnloadResource(const std::string& path)
 {
-    auto& container = GetResourceContainer<T>();
+    if (auto handle = FindHandle(std::type_index(typeid(T)), path); handle.IsValid())
+    {
+        Evict(slots_[handle.id]);
+    }
+}
 
-    // ̹ ε ҽ Ȯ
-    if (auto it = container.find(path); it != container.end())
+template<std::derived_from<IResource> T>
+std::shared_ptr<T> ResourceManager::FindResource(const std::string& path) const
+{
+    if (auto handle = FindHandle(std::type_index(typeid(T)), path); handle.IsValid() && slots_[handle.id].resource)
     {
-        return static_pointer_cast<T>(it->second);
+        return std::static_pointer_cast<T>(slots_[handle.id].resource);
     }
 
-    //  ҽ   ε
-    auto resource = std::make_shared<T>();
+    return nullptr;
+}
+
+template<std::derived_from<IResource> T>
+std::shared_ptr<T> ResourceManager::AddResource(const std::string& path, std::shared_ptr<T> resource)
+{
+    auto& slot = slots_[Intern<T>(path).id];
+    slot.last_used = ++use_clock_;
 
-    if (!resource->Load(path))
+    if (!slot.resource)
     {
-        throw std::runtime_error("Failed to load resource: " + path);
+        SetResident(slot, std::move(resource));
     }
 
-    auto [it, inserted] = container.emplace(path, resource);
-    return static_pointer_cast<T>(it->second);
-}
\ No newline at end of file
+    return std::static_pointer_cast<T>(slot.resource);
+}
+
+template<std::derived_from<IResource> T>
+std::string ResourceManager::GetFullPath(const std::string& path) const
+{
+    return PathUtil::CombinePaths(base_path_, PathUtil::CombinePaths(ResourcePathTrait<T>::BaseDir, path));
+}
@@ -4,6 +4,9 @@
 #include "../../states/CharacterSelectState.hpp"
 #include "../../states/GameState.hpp"
 #include "../../utils/Logger.hpp"
+#include "../../utils/FrameJobSystem.hpp"
+#include "../../resource/AssetLoader.hpp"
+#include "../../utils/StartupProfiler.hpp"
 #include <format>
 
 StateManager::StateManager()
@@ -37,16 +40,40 @@ bool StateManager::Initialize()
 
 void StateManager::InitializeStates()
 {
-    //     ʱȭ
-    states_[StateID::Login] = std::make_shared<LoginState>();
-    states_[StateID::Room] = std::make_shared<RoomState>();
-    states_[StateID::CharSelect] = std::make_shared<CharacterSelectState>();
-    states_[StateID::Game] = std::make_shared<GameState>();
-
-    // ʱ  
+    // ù ȭ鸸   ʱȭϰ,  ´ ó ȯ(Ǵ ̸ ε)  
     ChangeState(StateID::Login);
 }
 
+std::shared_ptr<BaseState> StateManager::CreateState(StateID stateId)
+{
+    switch (stateId)
+    {
+    case StateID::Login:
+        return std::make_shared<LoginState>();
+    case StateID::Room:
+        return std::make_shared<RoomState>();
+    case StateID::CharSelect:
+        return std::make_shared<CharacterSelectState>();
+    case StateID::Game:
+        return std::make_shared<GameState>();
+    default:
+        throw std::runtime_error(std::format("Invalid state requested: {}", static_cast<int>(stateId)));
+    }
+}
+
+const std::shared_ptr<BaseState>& StateManager::FindOrCreateState(StateID stateId)
+{
+    auto it = states_.find(stateId);
+
+    if (it == states_.end())
+    {
+        STARTUP_SCOPE(std::format("Construct state {}", static_cast<int>(stateId)), "state");
+        it = states_.emplace(stateId, CreateState(stateId)).first;
+    }
+
+    return it->second;
+}
+
 void StateManager::Update(float deltaTime)
 {
     if (!initialized_ || paused_) 
@@ -112,25 +139,48 @@ void StateManager::RequestStateChange(StateID newState)
     state_change_queue_.push(newState);
 }
 
-void StateManager::ChangeState(StateID newState)
+void StateManager::PreloadState(StateID stateId)
 {
-    auto it = states_.find(newState);
-
-    if (it == states_.end()) 
+    const auto& state = FindOrCreateState(stateId);
+    if (state->isInitialized())
     {
-        throw std::runtime_error(std::format("Invalid state requested: {}", static_cast<int>(newState)));
+        return;
     }
 
+    std::vector<std::string> paths;
+    state->CollectTexturePaths(paths);
+
+    ASSET_LOADER.Preload(paths);
+}
+
+void StateManager::ChangeState(StateID newState)
+{
+    // ߸ ID   ¸   
+    const auto& nextState = FindOrCreateState(newState);
+
     if (current_state_) 
     {
+        //   ü ϴ  ۾      ó
+        FRAME_JOBS.Execute();
         current_state_->Leave();
     }
 
     current_state_id_ = newState;
-    current_state_ = it->second;
+    current_state_ = nextState;
 
     if (current_state_->isInitialized() == false)
     {
+        STARTUP_SCOPE(std::format("Init {}", current_state_->GetStateName()), "state");
+
+        // ؽó Ŀ ķ ڵϰ, ̸ ε ̴  ϷḸ ٸ  Init  ĳ÷ ȸ
+        std::vector<std::string> texturePaths;
+        current_state_->CollectTexturePaths(texturePaths);
+
+        if (!ASSET_LOADER.LoadTextures(texturePaths))
+        {
+            LOGGER.Warning("Some textures of state {} failed to load", current_state_->GetStateName());
+        }
+
         current_state_->Init();
     }
     
@@ -2,6 +2,7 @@
 /*
  *
  * : BaseState  State ϴ Manager Class
+ * 1.  ü ó ȯ(Ǵ ̸ ε)  ϰ, ó   Init
  *
  */
 
@@ -54,6 +55,9 @@ public:
 
     
     void RequestStateChange(StateID newState);
+
+    //  ʱȭ   ؽó ׶忡 ̸ ε
+    void PreloadState(StateID stateId);
     void PauseCurrentState();
     void ResumeCurrentState();
     
@@ -65,6 +69,8 @@ public:
 public:
     void ChangeState(StateID newState);
     void InitializeStates();
+    [[nodiscard]] const std::shared_ptr<BaseState>& FindOrCreateState(StateID stateId);
+    [[nodiscard]] static std::shared_ptr<BaseState> CreateState(StateID stateId);
     void ProcessStateChangeRequests();
     
     StateMap states_;
@@ -0,0 +1,258 @@
+#include "AnalysisBoard.hpp"
+#include "../block/Block.hpp"
+#include "../system/ScoreTable.hpp"
+
+#include <algorithm>
+
+namespace Analysis
+{
+    namespace
+    {
+        constexpr uint8_t FIRST_COLOR = static_cast<uint8_t>(BlockType::Red);
+        constexpr uint8_t LAST_COLOR = static_cast<uint8_t>(BlockType::Purple);
+        constexpr uint8_t ICE = static_cast<uint8_t>(BlockType::Ice);
+
+        constexpr bool IsColor(uint8_t type)
+        {
+            return type >= FIRST_COLOR && type <= LAST_COLOR;
+        }
+
+        //   ̾ ĭ group   visited  ǥ, ׷ ũ⸦ ȯ
+        int CollectGroup(const Cells& cells, int start, std::array<bool, BOARD_CELLS>& visited, std::array<uint8_t, BOARD_CELLS>& group)
+        {
+            const uint8_t type = cells[start];
+            int count = 0;
+            int head = 0;
+
+            visited[start] = true;
+            group[count++] = static_cast<uint8_t>(start);
+
+            while (head < count)
+            {
+                const int index = group[head++];
+                const int x = index % BOARD_WIDTH;
+                const int y = index / BOARD_WIDTH;
+
+                for (const auto& [dx, dy] : Constants::DirectionInfo::OFFSETS)
+                {
+                    const int checkX = x + dx;
+                    const int checkY = y + dy;
+
+                    if (checkX < 0 || checkX >= BOARD_WIDTH || checkY < 0 || checkY >= BOARD_HEIGHT)
+                    {
+                        continue;
+                    }
+
+                    const int next = checkY * BOARD_WIDTH + checkX;
+                    if (!visited[next] && cells[next] == type)
+                    {
+                        visited[next] = true;
+                        group[count++] = static_cast<uint8_t>(next);
+                    }
+                }
+            }
+
+            return count;
+        }
+    }
+
+    Board Board::FromCells(const Cells& cells)
+    {
+        Board board;
+        board.cells_ = cells;
+        board.ApplyGravity();
+        return board;
+    }
+
+    std::optional<Board> Board::FromText(std::string_view text)
+    {
+        Cells cells{};
+
+        for (int row = 0; row < BOARD_HEIGHT; ++row)
+        {
+            if (text.empty())
+            {
+                return std::nullopt;
+            }
+
+            const size_t end = text.find('\n');
+            std::string_view line = text.substr(0, end);
+            text = (end == std::string_view::npos) ? std::string_view{} : text.substr(end + 1);
+
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+
+            const int y = BOARD_HEIGHT - 1 - row;
+            for (int x = 0; x < BOARD_WIDTH && x < static_cast<int>(line.size()); ++x)
+            {
+                const int type = line[x] - '0';
+                if (type <= 0)
+                {
+                    continue;
+                }
+
+                if (!IsColor(static_cast<uint8_t>(type)) && type != ICE)
+                {
+                    return std::nullopt;
+                }
+
+                cells[y * BOARD_WIDTH + x] = static_cast<uint8_t>(type);
+            }
+        }
+
+        return FromCells(cells);
+    }
+
+    bool Board::IsEmpty() const
+    {
+        return std::all_of(heights_.begin(), heights_.end(), [](uint8_t height) { return height == 0; });
+    }
+
+    bool Board::Drop(int x, uint8_t type)
+    {
+        if (heights_[x] >= BOARD_HEIGHT)
+        {
+            return false;
+        }
+
+        cells_[heights_[x] * BOARD_WIDTH + x] = type;
+        ++heights_[x];
+        return true;
+    }
+
+    bool Board::IsMatched(int x, int y) const
+    {
+        const int start = y * BOARD_WIDTH + x;
+        if (!IsColor(cells_[start]))
+        {
+            return false;
+        }
+
+        std::array<bool, BOARD_CELLS> visited{};
+        std::array<uint8_t, BOARD_CELLS> group;
+        return CollectGroup(cells_, start, visited, group) >= Constants::Game::MIN_MATCH_COUNT;
+    }
+
+    ChainResult Board::Resolve()
+    {
+        ChainResult result;
+
+        std::array<uint8_t, BOARD_CELLS> group;
+
+        while (true)
+        {
+            std::array<bool, BOARD_CELLS> visited{};
+            std::array<bool, BOARD_CELLS> removed{};
+            int blockCount = 0;
+            int groupCount = 0;
+            int linkBonus = 0;
+
+            for (int i = 0; i < static_cast<int>(BOARD_CELLS); ++i)
+            {
+                if (visited[i] || !IsColor(cells_[i]))
+                {
+                    continue;
+                }
+
+                const int count = CollectGroup(cells_, i, visited, group);
+                if (count < Constants::Game::MIN_MATCH_COUNT)
+                {
+                    continue;
+                }
+
+                for (int j = 0; j < count; ++j)
+                {
+                    removed[group[j]] = true;
+                }
+
+                blockCount += count;
+                linkBonus += ScoreTable::GetLinkBonus(static_cast<size_t>(count));
+                ++groupCount;
+            }
+
+            if (groupCount == 0)
+            {
+                break;
+            }
+
+            ++result.chain;
+            result.cleared = static_cast<uint16_t>(result.cleared + blockCount);
+            result.score += static_cast<uint32_t>(ScoreTable::GetStepScore(blockCount,
+                ScoreTable::GetComboConstant(result.chain) + linkBonus + ScoreTable::GetTypeBonus(static_cast<size_t>(groupCount))));
+
+            // ŵǴ  Ͽ   ϵ Բ  (BasePlayer::CollectRemoveIceBlocks)
+            for (int i = 0; i < static_cast<int>(BOARD_CELLS); ++i)
+            {
+                if (!removed[i] || cells_[i] == ICE)
+                {
+                    continue;
+                }
+
+                const int x = i % BOARD_WIDTH;
+                const int y = i / BOARD_WIDTH;
+                for (const auto& [dx, dy] : Constants::DirectionInfo::OFFSETS)
+                {
+                    const int checkX = x + dx;
+                    const int checkY = y + dy;
+                    if (checkX >= 0 && checkX < BOARD_WIDTH && checkY >= 0 && checkY < BOARD_HEIGHT &&
+                        cells_[checkY * BOARD_WIDTH + checkX] == ICE)
+                    {
+                        removed[checkY * BOARD_WIDTH + checkX] = true;
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < BOARD_CELLS; ++i)
+            {
+                if (removed[i])
+                {
+                    cells_[i] = 0;
+                }
+            }
+
+            ApplyGravity();
+        }
+
+        return result;
+    }
+
+    void Board::ApplyGravity()
+    {
+        for (int x = 0; x < BOARD_WIDTH; ++x)
+        {
+            int height = 0;
+            for (int y = 0; y < BOARD_HEIGHT; ++y)
+            {
+                const uint8_t type = cells_[y * BOARD_WIDTH + x];
+                if (type == 0)
+                {
+                    continue;
+                }
+
+                cells_[y * BOARD_WIDTH + x] = 0;
+                cells_[height * BOARD_WIDTH + x] = type;
+                ++height;
+            }
+            heights_[x] = static_cast<uint8_t>(height);
+        }
+    }
+
+    std::string Board::ToText() const
+    {
+        std::string text;
+        text.reserve(BOARD_CELLS + BOARD_HEIGHT);
+
+        for (int y = BOARD_HEIGHT - 1; y >= 0; --y)
+        {
+            for (int x = 0; x < BOARD_WIDTH; ++x)
+            {
+                text.push_back(static_cast<char>('0' + Get(x, y)));
+            }
+            text.push_back('\n');
+        }
+
+        return text;
+    }
+}
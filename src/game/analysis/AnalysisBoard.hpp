@@ -0,0 +1,73 @@
+#pragma once
+/*
+*
+* :  м( ,  Ǯ) 淮 
+* 1.  ü  ĭ BlockType  , ĭ ġ Replay::BoardSnapshot::cells   ([y *  + x], y = 0  ٴ)
+* 2. ׻ ϰ  ¸ ϹǷ  ̸    ĭ   ִ
+* 3. Resolve  Ӱ  Ģ(4 ̻  ,    , ) ⸦  ϰ
+*     ScoreTable   (ð    ȯ )
+*
+*/
+
+#include "../../core/common/constants/Constants.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Analysis
+{
+    inline constexpr int BOARD_WIDTH = Constants::Board::BOARD_X_COUNT;
+    inline constexpr int BOARD_HEIGHT = Constants::Board::BOARD_Y_COUNT;
+    inline constexpr size_t BOARD_CELLS = static_cast<size_t>(BOARD_WIDTH * BOARD_HEIGHT);
+
+    using Cells = std::array<uint8_t, BOARD_CELLS>;
+
+    struct ChainResult
+    {
+        uint8_t chain{ 0 };
+        uint32_t score{ 0 };
+        uint16_t cleared{ 0 };      // ŵ    ( )
+    };
+
+    class Board
+    {
+    public:
+
+        Board() = default;
+
+        //  ִ  ٷ ϽŲ (MatchRecorder::CaptureBoard  cells  ״   ִ)
+        [[nodiscard]] static Board FromCells(const Cells& cells);
+
+        // puyo.txt  ( ٿ  ,  , 0  ĭ),   ڶų    ̸ nullopt
+        [[nodiscard]] static std::optional<Board> FromText(std::string_view text);
+
+        [[nodiscard]] uint8_t Get(int x, int y) const { return cells_[y * BOARD_WIDTH + x]; }
+        [[nodiscard]] int GetHeight(int x) const { return heights_[x]; }
+        [[nodiscard]] const Cells& GetCells() const { return cells_; }
+
+        [[nodiscard]] bool IsEmpty() const;
+
+        //  x    ϳ ´,   á false
+        bool Drop(int x, uint8_t type);
+
+        // (x, y)     ׷쿡 ϴ (  ȭ  Ȯο)
+        [[nodiscard]] bool IsMatched(int x, int y) const;
+
+        // ⸦  ,  ׷  chain == 0
+        ChainResult Resolve();
+
+        [[nodiscard]] std::string ToText() const;
+
+        bool operator==(const Board& other) const { return cells_ == other.cells_; }
+
+    private:
+
+        void ApplyGravity();
+
+        Cells cells_{};
+        std::array<uint8_t, BOARD_WIDTH> heights_{};
+    };
+}
@@ -0,0 +1,368 @@
+#include "BoardBatch.hpp"
+#include "../block/Block.hpp"
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <algorithm>
+#include <bit>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define BOARD_BATCH_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+// MSVC /arch ɼ ̵ AVX2 intrinsic ϹǷ Ÿ ˻縸 ϴ.
+#if defined(__GNUC__) || defined(__clang__)
+#define BOARD_BATCH_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define BOARD_BATCH_TARGET_AVX2
+#endif
+
+namespace Analysis
+{
+    namespace
+    {
+        constexpr uint8_t FIRST_COLOR = static_cast<uint8_t>(BlockType::Red);
+        constexpr uint8_t LAST_COLOR = static_cast<uint8_t>(BlockType::Purple);
+        constexpr uint8_t ICE = static_cast<uint8_t>(BlockType::Ice);
+
+        constexpr size_t COLOR_COUNT = LAST_COLOR - FIRST_COLOR + 1;
+        constexpr size_t ICE_PLANE = COLOR_COUNT;
+
+        constexpr int COLUMN_BITS = 16;
+        constexpr int LOW_COLUMNS = 4;
+        constexpr int HIGH_SHIFT = COLUMN_BITS * (LOW_COLUMNS - 1);     // low    <-> high  ù 
+
+        static_assert(BOARD_HEIGHT < COLUMN_BITS && BOARD_WIDTH <= LOW_COLUMNS * 2);
+
+        struct KernelArgs
+        {
+            const uint64_t* const* low;     // [PLANE_COUNT][lane]
+            const uint64_t* const* high;
+            CellMask* masks;
+        };
+
+        //   Ʈ  (Scalar Ŀ)
+        struct Bits
+        {
+            uint64_t low;
+            uint64_t high;
+        };
+
+        Bits And(Bits a, Bits b) { return { a.low & b.low, a.high & b.high }; }
+        Bits Or(Bits a, Bits b) { return { a.low | b.low, a.high | b.high }; }
+
+        // ¿ ̿ ĭ Ʈ  ĭ ġ ű  (  Ʈ ȣ ʿ  AND Ͽ )
+        Bits Expand(Bits b)
+        {
+            return {
+                (b.low << 1) | (b.low >> 1) | (b.low << COLUMN_BITS) | (b.low >> COLUMN_BITS) | (b.high << HIGH_SHIFT),
+                (b.high << 1) | (b.high >> 1) | (b.high << COLUMN_BITS) | (b.high >> COLUMN_BITS) | (b.low >> HIGH_SHIFT)
+            };
+        }
+
+        // 鿡 4 ̻  ׷ ĭ
+        Bits FindGroups(Bits plane)
+        {
+            const Bits up = And(plane, { plane.low >> 1, plane.high >> 1 });
+            const Bits down = And(plane, { plane.low << 1, plane.high << 1 });
+            const Bits left = And(plane, { plane.low << COLUMN_BITS, (plane.high << COLUMN_BITS) | (plane.low >> HIGH_SHIFT) });
+            const Bits right = And(plane, { (plane.low >> COLUMN_BITS) | (plane.high << HIGH_SHIFT), plane.high >> COLUMN_BITS });
+
+            const Bits verticalBoth = And(up, down);
+            const Bits horizontalBoth = And(left, right);
+            const Bits verticalAny = Or(up, down);
+            const Bits horizontalAny = Or(left, right);
+
+            const Bits threes = Or(And(verticalBoth, horizontalAny), And(horizontalBoth, verticalAny));
+            const Bits twos = Or(Or(verticalBoth, horizontalBoth), And(verticalAny, horizontalAny));
+
+            Bits group = Or(threes, And(twos, Expand(twos)));
+            if ((group.low | group.high) == 0)
+            {
+                return group;
+            }
+
+            while (true)
+            {
+                const Bits next = And(plane, Or(group, Expand(group)));
+                if (next.low == group.low && next.high == group.high)
+                {
+                    return group;
+                }
+                group = next;
+            }
+        }
+
+        void FindPopMasksScalar(const KernelArgs& args, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                Bits pop{ 0, 0 };
+                for (size_t color = 0; color < COLOR_COUNT; ++color)
+                {
+                    pop = Or(pop, FindGroups({ args.low[color][i], args.high[color][i] }));
+                }
+
+                const Bits ice = And({ args.low[ICE_PLANE][i], args.high[ICE_PLANE][i] }, Expand(pop));
+                args.masks[i] = { pop.low | ice.low, pop.high | ice.high };
+            }
+        }
+
+#ifdef BOARD_BATCH_KERNEL_X86
+        //  4 Ʈ  (AVX2 Ŀ)
+        struct Bits4
+        {
+            __m256i low;
+            __m256i high;
+        };
+
+        BOARD_BATCH_TARGET_AVX2 Bits4 And4(Bits4 a, Bits4 b)
+        {
+            return { _mm256_and_si256(a.low, b.low), _mm256_and_si256(a.high, b.high) };
+        }
+
+        BOARD_BATCH_TARGET_AVX2 Bits4 Or4(Bits4 a, Bits4 b)
+        {
+            return { _mm256_or_si256(a.low, b.low), _mm256_or_si256(a.high, b.high) };
+        }
+
+        BOARD_BATCH_TARGET_AVX2 Bits4 Expand4(Bits4 b)
+        {
+            const __m256i low = _mm256_or_si256(
+                _mm256_or_si256(_mm256_slli_epi64(b.low, 1), _mm256_srli_epi64(b.low, 1)),
+                _mm256_or_si256(
+                    _mm256_or_si256(_mm256_slli_epi64(b.low, COLUMN_BITS), _mm256_srli_epi64(b.low, COLUMN_BITS)),
+                    _mm256_slli_epi64(b.high, HIGH_SHIFT)));
+
+            const __m256i high = _mm256_or_si256(
+                _mm256_or_si256(_mm256_slli_epi64(b.high, 1), _mm256_srli_epi64(b.high, 1)),
+                _mm256_or_si256(
+                    _mm256_or_si256(_mm256_slli_epi64(b.high, COLUMN_BITS), _mm256_srli_epi64(b.high, COLUMN_BITS)),
+                    _mm256_srli_epi64(b.low, HIGH_SHIFT)));
+
+            return { low, high };
+        }
+
+        BOARD_BATCH_TARGET_AVX2 Bits4 FindGroups4(Bits4 plane)
+        {
+            const Bits4 up = And4(plane, { _mm256_srli_epi64(plane.low, 1), _mm256_srli_epi64(plane.high, 1) });
+            const Bits4 down = And4(plane, { _mm256_slli_epi64(plane.low, 1), _mm256_slli_epi64(plane.high, 1) });
+            const Bits4 left = And4(plane, { _mm256_slli_epi64(plane.low, COLUMN_BITS),
+                _mm256_or_si256(_mm256_slli_epi64(plane.high, COLUMN_BITS), _mm256_srli_epi64(plane.low, HIGH_SHIFT)) });
+            const Bits4 right = And4(plane, { _mm256_or_si256(_mm256_srli_epi64(plane.low, COLUMN_BITS), _mm256_slli_epi64(plane.high, HIGH_SHIFT)),
+                _mm256_srli_epi64(plane.high, COLUMN_BITS) });
+
+            const Bits4 verticalBoth = And4(up, down);
+            const Bits4 horizontalBoth = And4(left, right);
+            const Bits4 verticalAny = Or4(up, down);
+            const Bits4 horizontalAny = Or4(left, right);
+
+            const Bits4 threes = Or4(And4(verticalBoth, horizontalAny), And4(horizontalBoth, verticalAny));
+            const Bits4 twos = Or4(Or4(verticalBoth, horizontalBoth), And4(verticalAny, horizontalAny));
+
+            Bits4 group = Or4(threes, And4(twos, Expand4(twos)));
+            const __m256i seeds = _mm256_or_si256(group.low, group.high);
+            if (_mm256_testz_si256(seeds, seeds))
+            {
+                return group;
+            }
+
+            //        (ñ⸸ ϹǷ   Ʈ  Ȯ)
+            while (true)
+            {
+                const Bits4 next = And4(plane, Or4(group, Expand4(group)));
+                if (_mm256_testc_si256(group.low, next.low) && _mm256_testc_si256(group.high, next.high))
+                {
+                    return group;
+                }
+                group = next;
+            }
+        }
+
+        BOARD_BATCH_TARGET_AVX2 void FindPopMasksAVX2(const KernelArgs& args, size_t count)
+        {
+            alignas(32) uint64_t low[BoardBatch::LANE_WIDTH];
+            alignas(32) uint64_t high[BoardBatch::LANE_WIDTH];
+
+            for (size_t i = 0; i < count; i += BoardBatch::LANE_WIDTH)
+            {
+                Bits4 pop{ _mm256_setzero_si256(), _mm256_setzero_si256() };
+                for (size_t color = 0; color < COLOR_COUNT; ++color)
+                {
+                    const Bits4 plane{
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(args.low[color] + i)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(args.high[color] + i)) };
+                    pop = Or4(pop, FindGroups4(plane));
+                }
+
+                const Bits4 ice{
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(args.low[ICE_PLANE] + i)),
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(args.high[ICE_PLANE] + i)) };
+                const Bits4 mask = Or4(pop, And4(ice, Expand4(pop)));
+
+                _mm256_store_si256(reinterpret_cast<__m256i*>(low), mask.low);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(high), mask.high);
+
+                for (size_t lane = 0; lane < BoardBatch::LANE_WIDTH; ++lane)
+                {
+                    args.masks[i + lane] = { low[lane], high[lane] };
+                }
+            }
+        }
+#endif
+
+        constexpr size_t RoundUpToLane(size_t count)
+        {
+            return (count + BoardBatch::LANE_WIDTH - 1) / BoardBatch::LANE_WIDTH * BoardBatch::LANE_WIDTH;
+        }
+
+        constexpr int GetBitIndex(int x, int y)
+        {
+            return (x % LOW_COLUMNS) * COLUMN_BITS + y;
+        }
+    }
+
+    bool CellMask::Contains(int x, int y) const
+    {
+        const uint64_t word = (x < LOW_COLUMNS) ? low : high;
+        return (word >> GetBitIndex(x, y)) & 1;
+    }
+
+    int CellMask::Count() const
+    {
+        return std::popcount(low) + std::popcount(high);
+    }
+
+    BoardBatch::BoardBatch()
+        : kernel_(GetBestKernel())
+    {
+    }
+
+    void BoardBatch::Reserve(size_t capacity)
+    {
+        capacity = RoundUpToLane(capacity);
+        if (capacity <= low_[0].size())
+        {
+            return;
+        }
+
+        // е α SIMD óϹǷ size ü 뷮ŭ ȮѴ.
+        for (size_t plane = 0; plane < PLANE_COUNT; ++plane)
+        {
+            low_[plane].resize(capacity, 0);
+            high_[plane].resize(capacity, 0);
+        }
+    }
+
+    void BoardBatch::Clear()
+    {
+        for (size_t plane = 0; plane < PLANE_COUNT; ++plane)
+        {
+            std::fill_n(low_[plane].begin(), count_, 0);
+            std::fill_n(high_[plane].begin(), count_, 0);
+        }
+        count_ = 0;
+    }
+
+    size_t BoardBatch::Add(const Board& board)
+    {
+        if (count_ == low_[0].size())
+        {
+            Reserve(std::max<size_t>(LANE_WIDTH, low_[0].size() * 2));
+        }
+
+        const size_t index = count_++;
+        for (int y = 0; y < BOARD_HEIGHT; ++y)
+        {
+            for (int x = 0; x < BOARD_WIDTH; ++x)
+            {
+                const uint8_t type = board.Get(x, y);
+                if (type == 0)
+                {
+                    continue;
+                }
+
+                const size_t plane = (type == ICE) ? ICE_PLANE : static_cast<size_t>(type - FIRST_COLOR);
+                auto& words = (x < LOW_COLUMNS) ? low_[plane] : high_[plane];
+                words[index] |= uint64_t{ 1 } << GetBitIndex(x, y);
+            }
+        }
+
+        return index;
+    }
+
+    void BoardBatch::FindPopMasks(std::vector<CellMask>& masks) const
+    {
+        const size_t laneCount = RoundUpToLane(count_);
+        masks.resize(laneCount);
+
+        if (count_ > 0)
+        {
+            std::array<const uint64_t*, PLANE_COUNT> low;
+            std::array<const uint64_t*, PLANE_COUNT> high;
+            for (size_t plane = 0; plane < PLANE_COUNT; ++plane)
+            {
+                low[plane] = low_[plane].data();
+                high[plane] = high_[plane].data();
+            }
+
+            const KernelArgs args{ low.data(), high.data(), masks.data() };
+
+            switch (kernel_)
+            {
+#ifdef BOARD_BATCH_KERNEL_X86
+            case Kernel::AVX2:
+                FindPopMasksAVX2(args, laneCount);
+                break;
+#endif
+            default:
+                FindPopMasksScalar(args, 0, count_);
+                break;
+            }
+        }
+
+        masks.resize(count_);
+    }
+
+    bool BoardBatch::SetKernel(Kernel kernel)
+    {
+        if (!IsKernelSupported(kernel))
+        {
+            return false;
+        }
+
+        kernel_ = kernel;
+        return true;
+    }
+
+    BoardBatch::Kernel BoardBatch::GetBestKernel()
+    {
+        static const Kernel best = IsKernelSupported(Kernel::AVX2) ? Kernel::AVX2 : Kernel::Scalar;
+        return best;
+    }
+
+    bool BoardBatch::IsKernelSupported(Kernel kernel)
+    {
+        switch (kernel)
+        {
+#ifdef BOARD_BATCH_KERNEL_X86
+        case Kernel::AVX2:
+            return SDL_HasAVX2();
+#endif
+        case Kernel::Scalar:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    std::string_view BoardBatch::GetKernelName(Kernel kernel)
+    {
+        switch (kernel)
+        {
+        case Kernel::Scalar: return "Scalar";
+        case Kernel::AVX2: return "AVX2";
+        default: return "Unknown";
+        }
+    }
+}
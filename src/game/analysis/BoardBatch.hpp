@@ -0,0 +1,88 @@
+#pragma once
+/*
+*
+* :     ĭ(4 ̻   ϰ ׿   )   ã ġ Ŀ
+* 1. 帶  Ʈ ( 16Ʈ,  13Ʈ )  (0~3 / 4~5) ,
+*      带   迭  SoA ¶ SIMD  ϳ  ϳ ô´
+* 2. ̿ Ʈ   ̿ 3 ̻ ĭ, ̿ 2 ̻ ĭ ´  ã (ڿ ﰢ Ƿ)
+*    Ȯ 4 ̻  ׷쿡  ,    ȿ      ׷ ü ´
+* 3. Ŀ AVX2( 4) / Scalar   CPU ϴ  ,  Ŀ  
+* 4. ׷ ũ⺰  ʿ Board::Resolve , 뷮 ùķ̼/Ž ȭ ο  ĭ ʿ  
+*
+*/
+
+#include "AnalysisBoard.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Analysis
+{
+    //    ĭ , (x, y)  x < 4 ̸ low  x * 16 + y Ʈ, ƴϸ high  (x - 4) * 16 + y Ʈ
+    struct CellMask
+    {
+        uint64_t low{ 0 };
+        uint64_t high{ 0 };
+
+        [[nodiscard]] bool IsEmpty() const { return (low | high) == 0; }
+        [[nodiscard]] bool Contains(int x, int y) const;
+        [[nodiscard]] int Count() const;
+
+        bool operator==(const CellMask&) const = default;
+    };
+
+    class BoardBatch
+    {
+    public:
+
+        static constexpr size_t LANE_WIDTH = 4;     // AVX2  uint64 4, 迭 ũ   
+
+        enum class Kernel : uint8_t
+        {
+            Scalar,
+            AVX2
+        };
+
+        BoardBatch();
+        ~BoardBatch() = default;
+
+        BoardBatch(const BoardBatch&) = delete;
+        BoardBatch& operator=(const BoardBatch&) = delete;
+        BoardBatch(BoardBatch&&) noexcept = default;
+        BoardBatch& operator=(BoardBatch&&) noexcept = default;
+
+        void Reserve(size_t capacity);
+        void Clear();
+
+        // 带 ߰ϰ ġ   ȯ
+        size_t Add(const Board& board);
+
+        // masks[i]  i °    ĭ (ũ Size()  )
+        void FindPopMasks(std::vector<CellMask>& masks) const;
+
+        [[nodiscard]] size_t Size() const { return count_; }
+        [[nodiscard]] bool IsEmpty() const { return count_ == 0; }
+
+        [[nodiscard]] Kernel GetKernel() const { return kernel_; }
+        bool SetKernel(Kernel kernel);
+
+        [[nodiscard]] static Kernel GetBestKernel();
+        [[nodiscard]] static bool IsKernelSupported(Kernel kernel);
+        [[nodiscard]] static std::string_view GetKernelName(Kernel kernel);
+
+    private:
+
+        static constexpr size_t PLANE_COUNT = 6;    //  5 + 
+
+        using WordArray = std::vector<uint64_t>;
+
+        std::array<WordArray, PLANE_COUNT> low_;
+        std::array<WordArray, PLANE_COUNT> high_;
+
+        size_t count_{ 0 };
+        Kernel kernel_{ Kernel::Scalar };
+    };
+}
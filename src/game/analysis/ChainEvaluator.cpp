@@ -0,0 +1,353 @@
+#include "ChainEvaluator.hpp"
+#include "../block/Block.hpp"
+#include "../../resource/AssetPack.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint8_t FIRST_COLOR = static_cast<uint8_t>(BlockType::Red);
+    constexpr uint8_t COLOR_COUNT = static_cast<uint8_t>(BlockType::Purple) - FIRST_COLOR + 1;
+    constexpr uint32_t DEADLINE_CHECK_INTERVAL = 256;   // 
+
+    constexpr const char* COLOR_NAMES[COLOR_COUNT] = { "red", "green", "blue", "yellow", "purple" };
+
+    struct SharedState
+    {
+        const ChainEvaluatorOptions& options;
+        Clock::time_point deadline;
+        int max_added{ 0 };                 // ̹ ݺ ߰  ִ  
+        std::atomic<int> best_chain{ 0 };
+        std::atomic<size_t> next_root{ 0 };
+        std::atomic<bool> is_timed_out{ false };
+    };
+
+    bool IsBetter(const ChainEvaluator::Result& lhs, const ChainEvaluator::Result& rhs)
+    {
+        if (lhs.chain.chain != rhs.chain.chain)
+        {
+            return lhs.chain.chain > rhs.chain.chain;
+        }
+        if (lhs.chain.score != rhs.chain.score)
+        {
+            return lhs.chain.score > rhs.chain.score;
+        }
+        return !lhs.drops.empty() && (rhs.drops.empty() || lhs.drops.size() < rhs.drops.size());
+    }
+
+    //  ϳ  켱 Ž (/ ߰ ,   ,  θ )
+    class Searcher
+    {
+    public:
+
+        Searcher(SharedState& shared, const Analysis::Board& board) : shared_(shared)
+        {
+            for (const uint8_t type : board.GetCells())
+            {
+                if (type >= FIRST_COLOR && type < FIRST_COLOR + COLOR_COUNT)
+                {
+                    ++color_counts_[type - FIRST_COLOR];
+                }
+            }
+        }
+
+        // 忡 drop   , ȭϸ ⸦ ϰ ƴϸ ̾ Ž
+        void Expand(const Analysis::Board& board, ChainEvaluator::Drop drop, int minColumn, int added)
+        {
+            const int color = drop.type - FIRST_COLOR;
+            auto& count = counts_[drop.column][color];
+            if (count >= shared_.options.max_per_color)
+            {
+                return;
+            }
+
+            Analysis::Board next = board;
+            if (!next.Drop(drop.column, drop.type))
+            {
+                return;
+            }
+
+            path_.push_back(drop);
+
+            if (next.IsMatched(drop.column, next.GetHeight(drop.column) - 1))
+            {
+                Record(next.Resolve());
+            }
+            else if (drop.column >= minColumn)
+            {
+                ++count;
+                ++color_counts_[color];
+                Search(next, drop.column, added + 1);
+                --color_counts_[color];
+                --count;
+            }
+
+            path_.pop_back();
+        }
+
+        [[nodiscard]] ChainEvaluator::Result& GetBest() { return best_; }
+
+    private:
+
+        void Search(const Analysis::Board& board, int minColumn, int added)
+        {
+            if (++best_.visited_nodes % DEADLINE_CHECK_INTERVAL == 0 && Clock::now() >= shared_.deadline)
+            {
+                shared_.is_timed_out = true;
+            }
+
+            const int remaining = shared_.max_added - added;
+            if (remaining <= 0 || shared_.is_timed_out.load(std::memory_order_relaxed) ||
+                GetChainBound(remaining) < shared_.best_chain.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            for (uint8_t x = 0; x < Analysis::BOARD_WIDTH; ++x)
+            {
+                for (uint8_t color = 0; color < COLOR_COUNT; ++color)
+                {
+                    Expand(board, { x, static_cast<uint8_t>(FIRST_COLOR + color) }, minColumn, added);
+                }
+            }
+        }
+
+        //   ܰ踶   MIN_MATCH_COUNT  ̻ Ƿ,     
+        // ڶ    ä   ִ ׷    
+        [[nodiscard]] int GetChainBound(int remaining) const
+        {
+            constexpr int MATCH = Constants::Game::MIN_MATCH_COUNT;
+
+            int bound = 0;
+            std::array<int, COLOR_COUNT> shortages{};
+            for (size_t i = 0; i < COLOR_COUNT; ++i)
+            {
+                bound += color_counts_[i] / MATCH;
+                shortages[i] = MATCH - color_counts_[i] % MATCH;
+            }
+
+            std::sort(shortages.begin(), shortages.end());
+            for (const int shortage : shortages)
+            {
+                if (remaining < shortage)
+                {
+                    break;
+                }
+                remaining -= shortage;
+                ++bound;
+            }
+
+            return bound + remaining / MATCH;
+        }
+
+        void Record(const Analysis::ChainResult& chain)
+        {
+            ChainEvaluator::Result candidate;
+            candidate.chain = chain;
+            candidate.drops = path_;
+
+            if (!IsBetter(candidate, best_))
+            {
+                return;
+            }
+
+            best_.chain = chain;
+            best_.drops = path_;
+
+            int best = shared_.best_chain.load(std::memory_order_relaxed);
+            while (chain.chain > best && !shared_.best_chain.compare_exchange_weak(best, chain.chain, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        SharedState& shared_;
+        std::array<std::array<uint8_t, COLOR_COUNT>, Analysis::BOARD_WIDTH> counts_{};
+        std::array<int, COLOR_COUNT> color_counts_{};
+        std::vector<ChainEvaluator::Drop> path_;
+        ChainEvaluator::Result best_;
+    };
+
+    template <typename T>
+    void ParseNumber(std::string_view value, T& out)
+    {
+        T parsed{};
+        if (std::from_chars(value.data(), value.data() + value.size(), parsed).ec == std::errc{})
+        {
+            out = parsed;
+        }
+    }
+}
+
+ChainEvaluator::Result ChainEvaluator::Evaluate(const Analysis::Board& board, const ChainEvaluatorOptions& options)
+{
+    const auto start = Clock::now();
+    Result result;
+
+    // ̹  ׷   ߰ ʾƵ Ⱑ Ͼ
+    Analysis::Board settled = board;
+    result.chain = settled.Resolve();
+    if (result.chain.chain > 0 || options.max_added == 0 || options.max_per_color == 0)
+    {
+        result.elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        return result;
+    }
+
+    std::vector<Drop> roots;
+    for (uint8_t x = 0; x < Analysis::BOARD_WIDTH; ++x)
+    {
+        for (uint8_t color = 0; color < COLOR_COUNT; ++color)
+        {
+            roots.push_back({ x, static_cast<uint8_t>(FIRST_COLOR + color) });
+        }
+    }
+
+    SharedState shared{ options, start + options.budget };
+
+    size_t threadCount = options.thread_count ? options.thread_count : std::thread::hardware_concurrency();
+    threadCount = std::clamp<size_t>(threadCount, 1, roots.size());
+
+    std::vector<Searcher> searchers(threadCount, Searcher(shared, board));
+
+    auto work = [&](Searcher& searcher)
+    {
+        for (size_t i = shared.next_root++; i < roots.size() && !shared.is_timed_out; i = shared.next_root++)
+        {
+            searcher.Expand(board, roots[i], 0, 0);
+        }
+    };
+
+    // ߰   ϳ ÷  Ž (budget        Ȯǰ,
+    //  ݺ ְ Ⱑ  ݺ  ġ⿡ δ)
+    for (int depth = 1; depth <= options.max_added && !shared.is_timed_out; ++depth)
+    {
+        shared.max_added = depth;
+        shared.next_root = 0;
+
+        // ȣ 嵵 Ž 
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (size_t i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(work, std::ref(searchers[i]));
+        }
+        work(searchers[0]);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (!shared.is_timed_out)
+        {
+            result.searched_adds = static_cast<uint8_t>(depth);
+        }
+    }
+
+    for (auto& searcher : searchers)
+    {
+        auto& best = searcher.GetBest();
+        result.visited_nodes += best.visited_nodes;
+
+        if (IsBetter(best, result))
+        {
+            result.chain = best.chain;
+            result.drops = std::move(best.drops);
+        }
+    }
+
+    result.timed_out = shared.is_timed_out;
+    result.elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return result;
+}
+
+std::optional<ChainEvaluatorCommandLine> ChainEvaluator::ParseCommandLine(int argc, char* argv[])
+{
+    std::optional<ChainEvaluatorCommandLine> commandLine;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--chain-eval")
+        {
+            const bool hasPath = (i + 1 < argc) && std::string_view(argv[i + 1]).substr(0, 2) != "--";
+            commandLine.emplace();
+            commandLine->board_path = hasPath ? argv[++i] : AssetPack::BOARD_FILE;
+        }
+    }
+
+    if (!commandLine)
+    {
+        return std::nullopt;
+    }
+
+    auto& options = commandLine->options;
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--chain-k")
+        {
+            ParseNumber(argv[++i], options.max_per_color);
+        }
+        else if (arg == "--chain-adds")
+        {
+            ParseNumber(argv[++i], options.max_added);
+        }
+        else if (arg == "--chain-budget")
+        {
+            int64_t budget = options.budget.count();
+            ParseNumber(argv[++i], budget);
+            options.budget = std::chrono::milliseconds(budget);
+        }
+        else if (arg == "--chain-threads")
+        {
+            ParseNumber(argv[++i], options.thread_count);
+        }
+    }
+
+    return commandLine;
+}
+
+bool ChainEvaluator::PrintReport(const ChainEvaluatorCommandLine& commandLine)
+{
+    std::string text;
+    if (!ASSET_PACK.ReadText(commandLine.board_path.string(), text))
+    {
+        LOGGER.Error("Failed to open board: {}", commandLine.board_path.string());
+        return false;
+    }
+
+    const auto board = Analysis::Board::FromText(text);
+    if (!board)
+    {
+        LOGGER.Error("Invalid board text: {}", commandLine.board_path.string());
+        return false;
+    }
+
+    const auto& options = commandLine.options;
+    const Result result = Evaluate(*board, options);
+
+    LOGGER.Info("Chain potential {} (K {}, up to {} blocks, budget {} ms)", commandLine.board_path.string(),
+        options.max_per_color, options.max_added, options.budget.count());
+    LOGGER.Info("  {} chain, score {}, {} blocks cleared", result.chain.chain, result.chain.score, result.chain.cleared);
+
+    for (size_t i = 0; i < result.drops.size(); ++i)
+    {
+        const auto& drop = result.drops[i];
+        LOGGER.Info("  {} column {} {}", i + 1 == result.drops.size() ? "trigger" : "add    ",
+            drop.column, COLOR_NAMES[drop.type - FIRST_COLOR]);
+    }
+
+    LOGGER.Info("  {} nodes in {:.1f} ms, exhaustive up to {} blocks{}", result.visited_nodes, result.elapsed_ms,
+        result.searched_adds, result.timed_out ? " (timed out)" : "");
+    return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+/*
+*
+* :     (" 忡 Ⱑ 󸶳 Ŀ  ִ°")
+* 1.    ִ max_per_color (ü max_added )  ߰    ִ ִ   ã´
+* 2.  ߰     ,   ⸦ ϴ ȭ 
+* 3. Ž ġ
+*    - ȭ ʴ   ȣ  ʴ θ ´ ( ٸ    )
+*    - ȭϴ Ͽ   ʴ´ ( ߿  ߰  )
+*    -     ߰    ִ ׷ ( )  ְ ⺸  ߴ
+* 4. ߰   1  ÷  ݺ ȭ,  ݺ ù (, )  ۾   忡 Žϰ
+*    ְ    ġ⿡ 
+* 5. budget   ׶ ּ  timed_out  Բ ȯ (Ʒ  Ʈ ª, м  )
+* 6. --chain-eval <board.txt> [--chain-k n] [--chain-adds n] [--chain-budget ms] [--chain-threads n]  â   
+*
+*/
+
+#include "AnalysisBoard.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+struct ChainEvaluatorOptions
+{
+    uint8_t max_per_color{ 2 };                         //   ߰  ִ   (K)
+    uint8_t max_added{ 4 };                             // ü ߰   (ȭ  )
+    std::chrono::milliseconds budget{ 100 };
+    size_t thread_count{ 0 };                           // 0 ̸ ϵ  
+};
+
+struct ChainEvaluatorCommandLine
+{
+    std::filesystem::path board_path;
+    ChainEvaluatorOptions options;
+};
+
+class ChainEvaluator
+{
+public:
+
+    struct Drop
+    {
+        uint8_t column{ 0 };
+        uint8_t type{ 0 };      // BlockType
+    };
+
+    struct Result
+    {
+        Analysis::ChainResult chain;
+        std::vector<Drop> drops;        //  ,  ȭ  (̹  ׷ ִ   )
+        uint8_t searched_adds{ 0 };     // ð ȿ  Ž ߰  
+        uint64_t visited_nodes{ 0 };
+        double elapsed_ms{ 0.0 };
+        bool timed_out{ false };
+    };
+
+    // ȣ 忡 budget  ŷ (     忡 ȣ)
+    [[nodiscard]] static Result Evaluate(const Analysis::Board& board, const ChainEvaluatorOptions& options = {});
+
+    [[nodiscard]] static std::optional<ChainEvaluatorCommandLine> ParseCommandLine(int argc, char* argv[]);
+    static bool PrintReport(const ChainEvaluatorCommandLine& commandLine);
+};
@@ -10,6 +10,7 @@
 
 
 #include <stdexcept>
+#include <cmath>
 #include "../../utils/RectUtil.hpp"
 
 Block::Block() 
@@ -89,6 +90,8 @@ void Block::InitializeEffectPositions()
 
 void Block::Update(float deltaTime) 
 {
+    SavePreviousPosition();
+
     switch (state_) 
     {
     case BlockState::Playing:
@@ -225,8 +228,9 @@ void Block::UpdateDownMoving(float deltaTime)
 {
     float fallSpeed = deltaTime * (static_cast<float>(Constants::Board::BOARD_Y_COUNT) + Constants::Block::SHATTERING_DOWN_SPEED - static_cast<float>(index_y_));
 
+    // ӵ  (FRAME_TIME) ̵̹Ƿ  ݿ Ͽ 
     down_velocity_ += fallSpeed;
-    position_.y += down_velocity_;
+    position_.y += down_velocity_ * (deltaTime / Constants::Time::FRAME_TIME);
 
     SetY(position_.y);
 
@@ -308,8 +312,35 @@ void Block::Render()
     }
     else 
     {
-        texture_->Render(position_.x, position_.y, &source_rect_);
+        const SDL_FPoint renderPosition = GetRenderPosition();
+        texture_->Render(renderPosition.x, renderPosition.y, &source_rect_);
+    }
+}
+
+void Block::SavePreviousPosition()
+{
+    previous_position_ = position_;
+    previous_step_ = GAME_APP.GetSimulationStep();
+}
+
+SDL_FPoint Block::GetRenderPosition() const
+{
+    //  ܿ ŵ ʾҰų  ĭ ̻  ̵(ġ/¿ ̵)   
+    if (previous_step_ != GAME_APP.GetSimulationStep())
+    {
+        return position_;
     }
+
+    const float dx = position_.x - previous_position_.x;
+    const float dy = position_.y - previous_position_.y;
+
+    if (std::abs(dx) >= Constants::Block::SIZE || std::abs(dy) >= Constants::Block::SIZE)
+    {
+        return position_;
+    }
+
+    const float alpha = GAME_APP.GetInterpolationAlpha();
+    return { previous_position_.x + dx * alpha, previous_position_.y + dy * alpha };
 }
 
 void Block::Release() 
@@ -138,6 +138,12 @@ private:
     void UpdateLinkStateForDownMoving();    
     
 
+protected:
+
+    //     ġ ϰ,     / ġ 
+    void SavePreviousPosition();
+    [[nodiscard]] SDL_FPoint GetRenderPosition() const;
+
 protected:
 
     SDL_FRect source_rect_;                       // ؽó ҽ 
@@ -166,5 +172,8 @@ protected:
     float scale_velocity_{ 0.0f };                // ũ  ӵ
     float down_velocity_{ 0.0f };                 //  ӵ
 
+    SDL_FPoint previous_position_{ 0.0f, 0.0f };  //      ġ
+    uint64_t previous_step_{ 0 };                 // previous_position_    ȣ
+
     uint8_t playerID_{ 0 };                      // ÷̾ ID
 };
@@ -595,7 +595,7 @@ void GameGroupBlock::Update(float deltaTime)
 
     /*if (player_id_ == 1)
     {
-        LOGGER.Info("GameGroupBlock::Update state_ = {} velocity_ = {} y = {}", (int)state_, velocity_, position_.y);
+        LOG_GAMEPLAY(Info, "GameGroupBlock::Update state_ = {} velocity_ = {} y = {}", (int)state_, velocity_, position_.y);
     }*/
 
     if (state_ == BlockState::Playing && blocks_[Standard] && blocks_[Satellite]) 
@@ -618,7 +618,8 @@ void GameGroupBlock::Update(float deltaTime)
         }
         else 
         {
-            ForceVelocityY(velocity_);
+            // velocity_   (FRAME_TIME) ̵
+            ForceVelocityY(velocity_ * (deltaTime / Constants::Time::FRAME_TIME));
 
             // 浹 üũ  Ʈũ ó
             if (NETWORK.IsRunning() && GAME_APP.GetPlayerManager().IsLocalPlayer(player_id_) == true)
@@ -5,7 +5,7 @@
 #include "../../core/common/constants/Constants.hpp"
 #include "../../core/GameApp.hpp"
 #include "../../network/player/Player.hpp"
-#include <random>
+#include "../system/MatchRandom.hpp"
 #include <functional>
 #include <cassert>
 
@@ -24,33 +24,35 @@ void GroupBlock::InitializeBlocks()
     }
 }
 
-bool GroupBlock::Create() 
+bool GroupBlock::Create(uint32_t pieceIndex) 
 {
     try 
     {
         InitializeBlocks();
 
-        auto texture = ImageTexture::Create("PUYO/puyo_beta.png");
+        static const ResourceHandle blockTexture = ImageTexture::Intern("PUYO/puyo_beta.png");
+        auto texture = ImageTexture::Create(blockTexture);
         if (texture == nullptr) 
         {
             throw std::runtime_error("Failed to load block texture");
         }
 
-        std::random_device rd;
-        std::mt19937 randEngine(rd());
-        std::uniform_int_distribution<int> distribution(static_cast<int>(BlockType::Red), static_cast<int>(BlockType::Purple));
+        //  ÷̰     򵵷 ġ   
+        const auto piece = MATCH_RANDOM.GetPiece(pieceIndex);
 
-        for (auto& block : blocks_) 
+        for (size_t i = 0; i < blocks_.size(); ++i) 
         {
+            auto& block = blocks_[i];
             if (!block) 
             {
                 throw std::runtime_error("Block initialization failed");
             }
 
 #ifdef _APP_DEBUG_
-            block->SetBlockType(BlockType::Purple);
+            //      忡 ״ 
+            block->SetBlockType(MATCH_RANDOM.HasFixedPieces() ? static_cast<BlockType>(piece[i]) : BlockType::Purple);
 #else
-            block->SetBlockType(static_cast<BlockType>(distribution(randEngine)));
+            block->SetBlockType(static_cast<BlockType>(piece[i]));
 #endif
 
             block->SetBlockTex(texture);
@@ -71,7 +73,8 @@ bool GroupBlock::Create(BlockType type1, BlockType type2) {
     {
         InitializeBlocks();
 
-        auto texture = ImageTexture::Create("PUYO/puyo_beta.png");
+        static const ResourceHandle blockTexture = ImageTexture::Intern("PUYO/puyo_beta.png");
+        auto texture = ImageTexture::Create(blockTexture);
         if (texture == nullptr) 
         {
             throw std::runtime_error("Failed to load block texture");
@@ -36,7 +36,8 @@ public:
     virtual void Render() override;
     virtual void Release() override;
 
-    bool Create();
+    // ġ   pieceIndex °   ( ÷̾)
+    bool Create(uint32_t pieceIndex);
     bool Create(BlockType type1, BlockType type2);
 
     void SetState(BlockState state);
@@ -42,6 +42,8 @@ void IceBlock::SetState(BlockState state)
 
 void IceBlock::Update(float deltaTime) 
 {
+    SavePreviousPosition();
+
     switch (state_) 
     {
     case BlockState::Destroying:
@@ -78,7 +80,7 @@ void IceBlock::UpdateDownMoving(float deltaTime)
     float fallSpeed = deltaTime * static_cast<float>(Constants::Board::BOARD_Y_COUNT - index_y_);
 
     down_velocity_ += fallSpeed * 0.1f;
-    position_.y += down_velocity_;
+    position_.y += down_velocity_ * (deltaTime / Constants::Time::FRAME_TIME);
     SetY(position_.y);
 
     Block* (*blocks)[Constants::Board::BOARD_X_COUNT] = nullptr;
@@ -167,6 +169,7 @@ void IceBlock::Render()
     }
     else 
     {
-        texture_->Render(position_.x, position_.y, &source_rect_);
+        const SDL_FPoint renderPosition = GetRenderPosition();
+        texture_->Render(renderPosition.x, renderPosition.y, &source_rect_);
     }
 }
\ No newline at end of file
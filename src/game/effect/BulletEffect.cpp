@@ -175,11 +175,6 @@ void BulletEffect::UpdateShockwave(float delta_time)
         float new_alpha = static_cast<float>(alpha_) - (pos_velocity * 10.0f);
         new_alpha = std::max<float>(0.0f, new_alpha);
         alpha_ = static_cast<uint8_t>(new_alpha);
-
-        if (texture_ != nullptr)
-        {
-            texture_->SetAlpha(alpha_);
-        }
     }
     else
     {
@@ -225,8 +220,11 @@ void BulletEffect::RenderShockwave() const
         current_rect.h
     };
 
+    // ؽó ٸ źȯ ϹǷ Ĵ ׸ ȿ  (Update Ŀ 忡 )
+    texture_->SetAlpha(alpha_);
     texture_->RenderScaled(&rects_.shock[0], &dest_rect);
     texture_->RenderScaled(&rects_.shock[1], &dest_rect);
+    texture_->SetAlpha(255);
 }
 
 void BulletEffect::Release() 
@@ -8,8 +8,6 @@
 
 #include <cassert>
 
-ExplosionParticle::ExplosionParticle() = default;
-
 ExplosionContainer::ExplosionContainer() 
 {
     source_rect_ = 
@@ -18,11 +16,19 @@ ExplosionContainer::ExplosionContainer()
         Constants::Particle::Explosion::SIZE,
         Constants::Particle::Explosion::SIZE,
     };
+
+    store_.Reserve(Constants::Particle::Explosion::PARTICLE_COUNT);
 }
 
 bool ExplosionContainer::InitializeParticles() 
 {
-    source_texture_ = ImageTexture::Create("PUYO/puyo_beta.png");
+    // 풀에서 재사용되는 경우 ParticleManager가 공유 텍스처를 미리 지정해 둔다.
+    if (!source_texture_)
+    {
+        static const ResourceHandle textureHandle = ImageTexture::Intern(TEXTURE_PATH);
+        source_texture_ = ImageTexture::Create(textureHandle);
+    }
+
     if (!source_texture_)
     {
         assert(false && "Failed to load explosion texture");
@@ -32,106 +38,58 @@ bool ExplosionContainer::InitializeParticles()
     initial_lifetime_ = Constants::Particle::Explosion::DEFAULT_LIFETIME;
     accumulated_lifetime_ = 0.0f;
 
-    particles_.clear();
-    particles_.reserve(Constants::Particle::Explosion::PARTICLE_COUNT);
+    store_.Clear();
 
     for (size_t i = 0; i < Constants::Particle::Explosion::PARTICLE_COUNT; ++i)
     {
-        auto particle = std::make_unique<ExplosionParticle>();
-
-        particle->SetPosition(position_.x, position_.y);
-
         const float angle = GameUtils::Random::Range(25.0f, 155.0f);
         const float force = GameUtils::Random::Range(20.0f, 40.0f);
-
-        particle->direction_ =
-        {
-            force * std::cos(GameUtils::ToRadians(angle)),
-            force * -std::sin(GameUtils::ToRadians(angle))
-        };
-
         const float size = static_cast<float>(GameUtils::Random::Range(7, 15)); // 7 ~ 15
-        particle->SetScale(size, size);
-
-        particle->lifetime_ = 0.0f;
-        particle->is_alive_ = true;
 
-        particles_.push_back(std::move(particle));
+        store_.Emit(position_.x, position_.y,
+            force * std::cos(GameUtils::ToRadians(angle)),
+            force * -std::sin(GameUtils::ToRadians(angle)),
+            size);
     }
 
     return true;
 }
 
-void ExplosionContainer::UpdateParticlePhysics(ExplosionParticle& particle, float deltaTime) 
+void ExplosionContainer::Update(float deltaTime) 
 {
-
-    particle.lifetime_ += deltaTime;
-
-    if (particle.lifetime_ >= initial_lifetime_)
+    const ParticleStore::BallisticParams params
     {
-        particle.is_alive_ = false;
-        return;
-    }
-
-    float particleTime = particle.lifetime_;
-    particle.velocity_ = 
-    {
-        particle.direction_.x * particleTime,
-        particle.direction_.y * particleTime +
-        (Constants::Particle::Explosion::GRAVITY / 2.0f * particleTime * particleTime)
+        Constants::Particle::Explosion::GRAVITY,
+        initial_lifetime_
     };
 
-    SDL_FPoint newPosition
-    {
-        position_.x + particle.velocity_.x,
-        position_.y + particle.velocity_.y
-    };
-
-    particle.SetPosition(newPosition.x, newPosition.y);
-}
-
-void ExplosionContainer::Update(float deltaTime) 
-{
-    for (auto& particle : particles_) 
-    {
-        if (auto explosionParticle = dynamic_cast<ExplosionParticle*>(particle.get())) 
-        {
-            UpdateParticlePhysics(*explosionParticle, deltaTime);
-        }
-    }
+    accumulated_lifetime_ += deltaTime;
+    store_.Update(deltaTime, params);
 }
 
 void ExplosionContainer::Render()
 {
-    if (!source_texture_ || particles_.empty()) 
+    if (!source_texture_ || store_.IsEmpty()) 
     {
         return;
     }
 
-    bool hasVisibleParticles = false;
-    for (const auto& particle : particles_) 
-    {
-        if (particle && particle->IsAlive()) 
-        {
-            hasVisibleParticles = true;
-            break;
-        }
-    }
+    const float* xs = store_.GetPositionX();
+    const float* ys = store_.GetPositionY();
+    const float* sizes = store_.GetSizes();
+    const float* angles = store_.GetAngles();
 
-    if (!hasVisibleParticles) 
+    for (size_t i = 0; i < store_.Size(); ++i)
     {
-        return;
+        SDL_FRect destRect{ xs[i], ys[i], sizes[i], sizes[i] };
+        source_texture_->RenderScaled(&source_rect_, &destRect, angles[i]);
     }
+}
 
-    for (const auto& particle : particles_) 
-    {
-        if (particle && particle->IsAlive()) 
-        {
-            SDL_FRect destRect = particle->GetRect();
-
-            source_texture_->RenderScaled(&source_rect_, &destRect);
-        }
-    }
+void ExplosionContainer::Release()
+{
+    store_.Clear();
+    ParticleContainer::Release();
 }
 
 void ExplosionContainer::SetBlockType(BlockType type) 
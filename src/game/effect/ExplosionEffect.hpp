@@ -5,9 +5,8 @@
 *
 */
 
-#include "../RenderableObject.hpp"
-#include "Particle.hpp"
 #include "ParticleContainer.hpp"
+#include "ParticleStore.hpp"
 
 #include <vector>
 #include <memory>
@@ -18,32 +17,10 @@ enum class BlockType;
 struct SDL_FPoint;
 struct SDL_FRect;
 
-class ExplosionParticle final : public Particle 
-{
-public:
-    ExplosionParticle();
-    ~ExplosionParticle() override = default;
-
-    ExplosionParticle(const ExplosionParticle&) = delete;
-    ExplosionParticle& operator=(const ExplosionParticle&) = delete;
-    ExplosionParticle(ExplosionParticle&&) noexcept = default;
-    ExplosionParticle& operator=(ExplosionParticle&&) noexcept = default;
-
-    void Update(float deltaTime) override {}
-    void Render() override {}
-    void Release() override {}
-
-private:
-    friend class ExplosionContainer;
-
-    BlockType type_;
-    SDL_FPoint direction_{};
-    SDL_FPoint velocity_{};
-    float force_{ 0.0f };
-};
-
 class ExplosionContainer final : public ParticleContainer {
 public:
+    static constexpr const char* TEXTURE_PATH = "PUYO/puyo_beta.png";
+
     ExplosionContainer();
     ~ExplosionContainer() override = default;
 
@@ -54,15 +31,15 @@ public:
 
     void Update(float deltaTime) override;
     void Render() override;
-    bool InitializeParticles();
-
-    void SetBlockType(BlockType type);
+    bool InitializeParticles() override;
+    void Release() override;
 
-private:
+    [[nodiscard]] int GetAliveParticleCount() const override { return static_cast<int>(store_.Size()); }
 
-    void UpdateParticlePhysics(ExplosionParticle& particle, float deltaTime);
+    void SetBlockType(BlockType type);
 
 private:
 
     BlockType type_;
+    ParticleStore store_;
 };
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "ParticleBenchmark.hpp"
+
+#include "../../core/GameUtils.hpp"
+#include "../../core/common/constants/Constants.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <chrono>
+
+namespace
+{
+    void FillStore(ParticleStore& store, size_t count)
+    {
+        store.Clear();
+        store.Reserve(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float angle = GameUtils::Random::Range(25.0f, 155.0f);
+            const float force = GameUtils::Random::Range(20.0f, 40.0f);
+
+            store.Emit(GameUtils::Random::Range(0.0f, 640.0f), GameUtils::Random::Range(0.0f, 448.0f),
+                force * std::cos(GameUtils::ToRadians(angle)),
+                force * -std::sin(GameUtils::ToRadians(angle)),
+                static_cast<float>(GameUtils::Random::Range(7, 15)));
+        }
+    }
+}
+
+namespace ParticleBenchmark
+{
+    std::vector<Result> Run(std::span<const size_t> counts, int frames)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::vector<Result> results;
+
+        //   ƼŬ Ҹ ʵ     ´.
+        const ParticleStore::BallisticParams params
+        {
+            Constants::Particle::Explosion::GRAVITY,
+            Constants::Time::FRAME_TIME * static_cast<float>(frames + 1)
+        };
+
+        for (auto kernel : { ParticleStore::Kernel::Scalar, ParticleStore::Kernel::SSE,
+            ParticleStore::Kernel::AVX2, ParticleStore::Kernel::NEON })
+        {
+            ParticleStore store;
+            if (!store.SetKernel(kernel))
+            {
+                continue;
+            }
+
+            for (size_t count : counts)
+            {
+                FillStore(store, count);
+
+                const auto start = Clock::now();
+                for (int frame = 0; frame < frames; ++frame)
+                {
+                    store.Update(Constants::Time::FRAME_TIME, params);
+                }
+                const auto end = Clock::now();
+
+                Result result;
+                result.kernel = kernel;
+                result.particle_count = count;
+                result.elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+                result.particles_per_ms = result.elapsed_ms > 0.0 ?
+                    static_cast<double>(count) * frames / result.elapsed_ms : 0.0;
+
+                results.push_back(result);
+            }
+        }
+
+        return results;
+    }
+
+    void LogResults(std::span<const Result> results)
+    {
+        for (const auto& result : results)
+        {
+            LOGGER.Info("[ParticleBenchmark] kernel={} particles={} elapsed={:.3f}ms throughput={:.0f} particles/ms",
+                ParticleStore::GetKernelName(result.kernel),
+                result.particle_count,
+                result.elapsed_ms,
+                result.particles_per_ms);
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+/*
+*
+* : ParticleStore  Ŀ ó(particles/ms) 
+* 1.   --bench-particles  ϸ â  ʰ     
+* 2. CPU ϴ  Ŀο  1k ~ 100k  ƼŬ 
+*
+*/
+
+#include "ParticleStore.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace ParticleBenchmark
+{
+    inline constexpr std::array<size_t, 5> DEFAULT_COUNTS = { 1'000, 5'000, 10'000, 50'000, 100'000 };
+    inline constexpr int DEFAULT_FRAMES = 300;
+
+    struct Result
+    {
+        ParticleStore::Kernel kernel{ ParticleStore::Kernel::Scalar };
+        size_t particle_count{ 0 };
+        double elapsed_ms{ 0.0 };
+        double particles_per_ms{ 0.0 };
+    };
+
+    [[nodiscard]] std::vector<Result> Run(std::span<const size_t> counts = DEFAULT_COUNTS, int frames = DEFAULT_FRAMES);
+    void LogResults(std::span<const Result> results);
+}
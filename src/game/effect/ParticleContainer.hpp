@@ -46,7 +46,7 @@ public:
     virtual bool InitializeParticles() = 0;
     virtual void Release();
 
-    [[nodiscard]] int GetAliveParticleCount() const;
+    [[nodiscard]] virtual int GetAliveParticleCount() const;
     [[nodiscard]] bool IsAlive() const { return initial_lifetime_ > accumulated_lifetime_; }
     [[nodiscard]] uint8_t GetPlayerID() const { return player_id_; }
 
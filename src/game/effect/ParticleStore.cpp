@@ -0,0 +1,292 @@
+#include "ParticleStore.hpp"
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PARTICLE_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(_M_ARM64) || defined(__ARM_NEON)
+#define PARTICLE_KERNEL_NEON 1
+#include <arm_neon.h>
+#endif
+
+// MSVC /arch ɼ ̵ AVX2 intrinsic ϹǷ Ÿ ˻縸 ϴ.
+#if defined(__GNUC__) || defined(__clang__)
+#define PARTICLE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PARTICLE_TARGET_AVX2
+#endif
+
+namespace
+{
+    struct KernelArgs
+    {
+        const float* origin_x;
+        const float* origin_y;
+        const float* velocity_x;
+        const float* velocity_y;
+        float* position_x;
+        float* position_y;
+        float* lifetime;
+        float delta_time;
+        float half_gravity;
+    };
+
+    void UpdateScalar(const KernelArgs& args, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const float t = args.lifetime[i] + args.delta_time;
+            args.lifetime[i] = t;
+            args.position_x[i] = args.origin_x[i] + args.velocity_x[i] * t;
+            args.position_y[i] = args.origin_y[i] + args.velocity_y[i] * t + args.half_gravity * t * t;
+        }
+    }
+
+#ifdef PARTICLE_KERNEL_X86
+    void UpdateSSE(const KernelArgs& args, size_t count)
+    {
+        const __m128 dt = _mm_set1_ps(args.delta_time);
+        const __m128 half_gravity = _mm_set1_ps(args.half_gravity);
+
+        for (size_t i = 0; i < count; i += 4)
+        {
+            const __m128 t = _mm_add_ps(_mm_load_ps(args.lifetime + i), dt);
+            _mm_store_ps(args.lifetime + i, t);
+
+            const __m128 x = _mm_add_ps(_mm_load_ps(args.origin_x + i), _mm_mul_ps(_mm_load_ps(args.velocity_x + i), t));
+            const __m128 fall = _mm_mul_ps(_mm_mul_ps(half_gravity, t), t);
+            const __m128 y = _mm_add_ps(_mm_add_ps(_mm_load_ps(args.origin_y + i), _mm_mul_ps(_mm_load_ps(args.velocity_y + i), t)), fall);
+
+            _mm_store_ps(args.position_x + i, x);
+            _mm_store_ps(args.position_y + i, y);
+        }
+    }
+
+    PARTICLE_TARGET_AVX2 void UpdateAVX2(const KernelArgs& args, size_t count)
+    {
+        const __m256 dt = _mm256_set1_ps(args.delta_time);
+        const __m256 half_gravity = _mm256_set1_ps(args.half_gravity);
+
+        for (size_t i = 0; i < count; i += 8)
+        {
+            const __m256 t = _mm256_add_ps(_mm256_load_ps(args.lifetime + i), dt);
+            _mm256_store_ps(args.lifetime + i, t);
+
+            const __m256 x = _mm256_add_ps(_mm256_load_ps(args.origin_x + i), _mm256_mul_ps(_mm256_load_ps(args.velocity_x + i), t));
+            const __m256 fall = _mm256_mul_ps(_mm256_mul_ps(half_gravity, t), t);
+            const __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_load_ps(args.origin_y + i), _mm256_mul_ps(_mm256_load_ps(args.velocity_y + i), t)), fall);
+
+            _mm256_store_ps(args.position_x + i, x);
+            _mm256_store_ps(args.position_y + i, y);
+        }
+    }
+#endif
+
+#ifdef PARTICLE_KERNEL_NEON
+    void UpdateNEON(const KernelArgs& args, size_t count)
+    {
+        const float32x4_t dt = vdupq_n_f32(args.delta_time);
+        const float32x4_t half_gravity = vdupq_n_f32(args.half_gravity);
+
+        for (size_t i = 0; i < count; i += 4)
+        {
+            const float32x4_t t = vaddq_f32(vld1q_f32(args.lifetime + i), dt);
+            vst1q_f32(args.lifetime + i, t);
+
+            const float32x4_t x = vaddq_f32(vld1q_f32(args.origin_x + i), vmulq_f32(vld1q_f32(args.velocity_x + i), t));
+            const float32x4_t fall = vmulq_f32(vmulq_f32(half_gravity, t), t);
+            const float32x4_t y = vaddq_f32(vaddq_f32(vld1q_f32(args.origin_y + i), vmulq_f32(vld1q_f32(args.velocity_y + i), t)), fall);
+
+            vst1q_f32(args.position_x + i, x);
+            vst1q_f32(args.position_y + i, y);
+        }
+    }
+#endif
+
+    constexpr size_t RoundUpToLane(size_t count)
+    {
+        return (count + ParticleStore::LANE_WIDTH - 1) / ParticleStore::LANE_WIDTH * ParticleStore::LANE_WIDTH;
+    }
+}
+
+ParticleStore::ParticleStore()
+    : kernel_(GetBestKernel())
+{
+}
+
+void ParticleStore::Reserve(size_t capacity)
+{
+    capacity = RoundUpToLane(capacity);
+    if (capacity <= Capacity())
+    {
+        return;
+    }
+
+    // е α SIMD óϹǷ size ü 뷮ŭ ȮѴ.
+    for (FloatArray* array : { &origin_x_, &origin_y_, &position_x_, &position_y_,
+        &velocity_x_, &velocity_y_, &lifetime_, &size_, &angle_ })
+    {
+        array->resize(capacity, 0.0f);
+    }
+}
+
+void ParticleStore::Emit(float origin_x, float origin_y, float velocity_x, float velocity_y, float size, float angle)
+{
+    if (count_ == Capacity())
+    {
+        Reserve(std::max<size_t>(LANE_WIDTH, Capacity() * 2));
+    }
+
+    const size_t i = count_++;
+    origin_x_[i] = origin_x;
+    origin_y_[i] = origin_y;
+    position_x_[i] = origin_x;
+    position_y_[i] = origin_y;
+    velocity_x_[i] = velocity_x;
+    velocity_y_[i] = velocity_y;
+    lifetime_[i] = 0.0f;
+    size_[i] = size;
+    angle_[i] = angle;
+}
+
+void ParticleStore::Update(float deltaTime, const BallisticParams& params)
+{
+    if (count_ == 0)
+    {
+        return;
+    }
+
+    const KernelArgs args
+    {
+        origin_x_.data(), origin_y_.data(),
+        velocity_x_.data(), velocity_y_.data(),
+        position_x_.data(), position_y_.data(),
+        lifetime_.data(),
+        deltaTime,
+        params.gravity / 2.0f
+    };
+
+    const size_t lane_count = RoundUpToLane(count_);
+
+    switch (kernel_)
+    {
+#ifdef PARTICLE_KERNEL_X86
+    case Kernel::AVX2:
+        UpdateAVX2(args, lane_count);
+        break;
+    case Kernel::SSE:
+        UpdateSSE(args, lane_count);
+        break;
+#endif
+#ifdef PARTICLE_KERNEL_NEON
+    case Kernel::NEON:
+        UpdateNEON(args, lane_count);
+        break;
+#endif
+    default:
+        UpdateScalar(args, 0, count_);
+        break;
+    }
+
+    RemoveDeadParticles(params.max_lifetime);
+}
+
+void ParticleStore::RemoveDeadParticles(float max_lifetime)
+{
+    size_t i = 0;
+    while (i < count_)
+    {
+        if (lifetime_[i] >= max_lifetime)
+        {
+            --count_;
+            MoveParticle(count_, i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+void ParticleStore::MoveParticle(size_t from, size_t to)
+{
+    if (from == to)
+    {
+        return;
+    }
+
+    origin_x_[to] = origin_x_[from];
+    origin_y_[to] = origin_y_[from];
+    position_x_[to] = position_x_[from];
+    position_y_[to] = position_y_[from];
+    velocity_x_[to] = velocity_x_[from];
+    velocity_y_[to] = velocity_y_[from];
+    lifetime_[to] = lifetime_[from];
+    size_[to] = size_[from];
+    angle_[to] = angle_[from];
+}
+
+bool ParticleStore::SetKernel(Kernel kernel)
+{
+    if (!IsKernelSupported(kernel))
+    {
+        return false;
+    }
+
+    kernel_ = kernel;
+    return true;
+}
+
+ParticleStore::Kernel ParticleStore::GetBestKernel()
+{
+    static const Kernel best = []()
+        {
+            for (Kernel kernel : { Kernel::AVX2, Kernel::NEON, Kernel::SSE })
+            {
+                if (IsKernelSupported(kernel))
+                {
+                    return kernel;
+                }
+            }
+            return Kernel::Scalar;
+        }();
+
+    return best;
+}
+
+bool ParticleStore::IsKernelSupported(Kernel kernel)
+{
+    switch (kernel)
+    {
+#ifdef PARTICLE_KERNEL_X86
+    case Kernel::AVX2:
+        return SDL_HasAVX2();
+    case Kernel::SSE:
+        return SDL_HasSSE();
+#endif
+#ifdef PARTICLE_KERNEL_NEON
+    case Kernel::NEON:
+        return SDL_HasNEON();
+#endif
+    case Kernel::Scalar:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::string_view ParticleStore::GetKernelName(Kernel kernel)
+{
+    switch (kernel)
+    {
+    case Kernel::Scalar: return "Scalar";
+    case Kernel::SSE: return "SSE";
+    case Kernel::AVX2: return "AVX2";
+    case Kernel::NEON: return "NEON";
+    default: return "Unknown";
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+/*
+*
+* : ƼŬ Ӽ SoA(Structure of Arrays) · ϴ 
+* 1. ġ/ӵ//ũ/  32Ʈ ĵ 迭 иϿ SIMD Ŀη ϰ 
+* 2. Ŀ SSE / AVX2 / NEON / Scalar   CPU ϴ    
+* 3.   ƼŬ  ҿ ü(swap-remove)Ͽ 迭 
+*
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+#include <string_view>
+
+template<typename T, size_t Alignment>
+class AlignedAllocator
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Alignment }));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t{ Alignment });
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+};
+
+
+class ParticleStore
+{
+public:
+
+    static constexpr size_t ALIGNMENT = 32;
+    static constexpr size_t LANE_WIDTH = 8;   // AVX2  float 8, 迭 ũ   
+
+    using FloatArray = std::vector<float, AlignedAllocator<float, ALIGNMENT>>;
+
+    enum class Kernel : uint8_t
+    {
+        Scalar,
+        SSE,
+        AVX2,
+        NEON
+    };
+
+    // ź  Ķ (y = origin + v * t + gravity / 2 * t^2)
+    struct BallisticParams
+    {
+        float gravity{ 0.0f };
+        float max_lifetime{ 0.0f };
+    };
+
+    ParticleStore();
+    ~ParticleStore() = default;
+
+    ParticleStore(const ParticleStore&) = delete;
+    ParticleStore& operator=(const ParticleStore&) = delete;
+    ParticleStore(ParticleStore&&) noexcept = default;
+    ParticleStore& operator=(ParticleStore&&) noexcept = default;
+
+    void Reserve(size_t capacity);
+    void Clear() { count_ = 0; }
+    void Emit(float origin_x, float origin_y, float velocity_x, float velocity_y, float size, float angle = 0.0f);
+    void Update(float deltaTime, const BallisticParams& params);
+
+    [[nodiscard]] size_t Size() const { return count_; }
+    [[nodiscard]] size_t Capacity() const { return position_x_.size(); }
+    [[nodiscard]] bool IsEmpty() const { return count_ == 0; }
+
+    [[nodiscard]] const float* GetPositionX() const { return position_x_.data(); }
+    [[nodiscard]] const float* GetPositionY() const { return position_y_.data(); }
+    [[nodiscard]] const float* GetSizes() const { return size_.data(); }
+    [[nodiscard]] const float* GetAngles() const { return angle_.data(); }
+    [[nodiscard]] const float* GetLifetimes() const { return lifetime_.data(); }
+
+    [[nodiscard]] Kernel GetKernel() const { return kernel_; }
+    bool SetKernel(Kernel kernel);
+
+    [[nodiscard]] static Kernel GetBestKernel();
+    [[nodiscard]] static bool IsKernelSupported(Kernel kernel);
+    [[nodiscard]] static std::string_view GetKernelName(Kernel kernel);
+
+private:
+
+    void RemoveDeadParticles(float max_lifetime);
+    void MoveParticle(size_t from, size_t to);
+
+private:
+
+    FloatArray origin_x_;
+    FloatArray origin_y_;
+    FloatArray position_x_;
+    FloatArray position_y_;
+    FloatArray velocity_x_;
+    FloatArray velocity_y_;
+    FloatArray lifetime_;
+    FloatArray size_;
+    FloatArray angle_;
+
+    size_t count_{ 0 };
+    Kernel kernel_{ Kernel::Scalar };
+};
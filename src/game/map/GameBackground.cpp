@@ -3,6 +3,7 @@
 #include "../block/GroupBlock.hpp"
 #include "../particles/BgParticleSystem.hpp"
 #include "../../texture/ImageTexture.hpp"
+#include "../../texture/RenderRecorder.hpp"
 #include "../../core/GameApp.hpp"
 #include "../../core/manager/StateManager.hpp"
 #include "../../states/GameState.hpp"
@@ -11,6 +12,8 @@
 #include "../../core/GameUtils.hpp"
 #include "../../utils/Logger.hpp"
 #include "../../utils/PathUtil.hpp"
+#include "../../utils/FrameJobSystem.hpp"
+#include "../../resource/AssetLoader.hpp"
 
 #include <format>
 #include <stdexcept>
@@ -73,7 +76,7 @@ void GameBackground::Update(float delta_time)
         while (data.group_blocks.size() > MAX_BLOCKS_IN_QUEUE) 
         {
             data.group_blocks.pop_front();
-            LOGGER.Info("Excessive blocks detected for player {}, truncating queue", static_cast<int>(type));
+            LOG_GAMEPLAY(Info, "Excessive blocks detected for player {}, truncating queue", static_cast<int>(type));
         }
 
         if (data.is_changing_block) 
@@ -81,6 +84,11 @@ void GameBackground::Update(float delta_time)
             UpdateBlockAnimations(delta_time, type);
         }
     }
+
+    FRAME_JOBS.Submit("BackgroundParticles", [this, delta_time]()
+        {
+            UpdateParticles(delta_time);
+        });
 }
 
 GameBackground::BlockAnimationConfig GameBackground::GetAnimationConfig(Constants::PlayerType playerType) const
@@ -202,7 +210,7 @@ void GameBackground::UpdateBlockAnimations(float delta_time, Constants::PlayerTy
 
             /*if (playerType == Constants::PlayerType::Remote)
             {
-                LOGGER.Info("GameBackground::UpdateBlockAnimations move_finish {} size {}", move_finished, data.group_blocks.size());
+                LOG_GAMEPLAY(Info, "GameBackground::UpdateBlockAnimations move_finish {} size {}", move_finished, data.group_blocks.size());
             }*/
             if (move_finished) 
             {
@@ -210,7 +218,7 @@ void GameBackground::UpdateBlockAnimations(float delta_time, Constants::PlayerTy
 
                 if (data.group_blocks.size() != 2) 
                 {
-                    LOGGER.Info("GameBackground::UpdateBlockAnimations Invalid block count after pop: {} for player {}", data.group_blocks.size(), static_cast<int>(playerType));
+                    LOG_GAMEPLAY(Info, "GameBackground::UpdateBlockAnimations Invalid block count after pop: {} for player {}", data.group_blocks.size(), static_cast<int>(playerType));
 
                     //   - ׻ 2 ϸ ⵵ 
                     while (data.group_blocks.size() > 2) 
@@ -233,9 +241,13 @@ void GameBackground::UpdateBlockAnimations(float delta_time, Constants::PlayerTy
                     }
                     else 
                     {
-                        if (auto& remotePlayer = gameState->GetRemotePlayer()) 
+                        //    ڸ  ũ ׷ (1:1) ͸ 
+                        for (const auto& remotePlayer : gameState->GetRemotePlayers()) 
                         {
-                            remotePlayer->PlayNextBlock();
+                            if (!remotePlayer->IsCompact())
+                            {
+                                remotePlayer->PlayNextBlock();
+                            }
                         }
                     }
                 }
@@ -274,9 +286,9 @@ void GameBackground::Render()
     if (shouldRenderBlocks && render_target_) 
     {
         auto renderer = GAME_APP.GetRenderer();   
-        SDL_SetRenderTarget(renderer, render_target_.get());
+        RENDER_RECORDER.SetRenderTarget(renderer, render_target_.get());
         SDL_SetRenderDrawColor(renderer, 0xFF, 0xFF, 0xFF, 0);
-        SDL_RenderClear(renderer);
+        RENDER_RECORDER.Clear(renderer);
 
         if (mask_textures_[0]) 
         {
@@ -293,8 +305,8 @@ void GameBackground::Render()
             }
         }
 
-        SDL_SetRenderTarget(renderer, nullptr);
-        SDL_RenderTexture(renderer, render_target_.get(), nullptr, &render_target_rect_);
+        RENDER_RECORDER.SetRenderTarget(renderer, nullptr);
+        RENDER_RECORDER.DrawTexture(renderer, render_target_.get(), nullptr, &render_target_rect_);
     }
 
     if (mask_textures_[1]) 
@@ -345,7 +357,7 @@ void GameBackground::SetNextBlock(const std::shared_ptr<GroupBlock>& block, Cons
 
     /*if (playerType == Constants::PlayerType::Remote)
     {
-        LOGGER.Info("GameBackground::SetNextBlock size {}", data.group_blocks.size());
+        LOG_GAMEPLAY(Info, "GameBackground::SetNextBlock size {}", data.group_blocks.size());
     }*/
 
 
@@ -384,10 +396,31 @@ bool GameBackground::IsReadyGame() const
         player_data_.at(Constants::PlayerType::Remote).group_blocks.size() == 2;
 }
 
+void GameBackground::CollectTexturePaths(uint8_t mapIndex, std::vector<std::string>& paths)
+{
+    std::string bgPath = PathUtil::GetBgPath();
+
+    for (int i = 0; i < 2; ++i)
+    {
+        paths.push_back(std::format("{}/bg{:02d}/bg{:02d}_{:02d}.png", bgPath, mapIndex, mapIndex, i));
+        paths.push_back(std::format("{}/bg{:02d}/bg{:02d}_mask{}.png", bgPath, mapIndex, mapIndex, i == 0 ? "" : "_2"));
+    }
+
+    paths.push_back(std::format("{}/bg{:02d}/op{:02d}_00.png", bgPath, mapIndex, mapIndex));
+}
+
 bool GameBackground::LoadBackgroundTextures()
 {
     try
     {
+        // /ũ/Ʈ ķ ڵ (    ̸ εǾٸ ĳÿ ٷ ȯ)
+        std::vector<std::string> texturePaths;
+        CollectTexturePaths(map_index_, texturePaths);
+        if (!ASSET_LOADER.LoadTextures(texturePaths))
+        {
+            throw std::runtime_error("Failed to load map textures");
+        }
+
         std::string bgPath = PathUtil::GetBgPath();
 
         for (int i = 0; i < 2; ++i)
@@ -11,6 +11,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 class ImgTexture;
 class GroupBlock;
@@ -36,6 +37,9 @@ public:
     GameBackground(GameBackground&&) = delete;
     GameBackground& operator=(GameBackground&&) = delete;
 
+    //  /ũ/Ʈ ؽó  (   ̸ ε  )
+    static void CollectTexturePaths(uint8_t mapIndex, std::vector<std::string>& paths);
+
     [[nodiscard]] virtual bool Initialize();
     void Update(float deltaTime) override;
     [[nodiscard]] virtual void Render() override;
@@ -69,6 +73,9 @@ public:
 protected:
     [[nodiscard]] virtual bool LoadBackgroundTextures();
     [[nodiscard]] bool CreateRenderTarget();
+
+    //  ƼŬ ùķ̼ (  Ŀ ǹǷ / ¿  ʾƾ )
+    virtual void UpdateParticles(float deltaTime) {}
     void UpdateBlockAnimations(float deltaTime, Constants::PlayerType playerType);
 
     //  ִϸ̼  ü
@@ -105,7 +105,10 @@ bool GrasslandBackground::LoadEffectTextures()
 void GrasslandBackground::Update(float deltaTime)
 {
     GameBackground::Update(deltaTime);
+}
 
+void GrasslandBackground::UpdateParticles(float deltaTime)
+{
     if (particle_system_)
     {
         particle_system_->Update(deltaTime);
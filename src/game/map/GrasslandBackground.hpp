@@ -48,6 +48,9 @@ public:
     void SetParticleCount(size_t count);
     [[nodiscard]] size_t GetParticleCount() const;
 
+protected:
+    void UpdateParticles(float deltaTime) override;
+
 private:
     [[nodiscard]] bool LoadEffectTextures();
 
@@ -147,8 +147,6 @@ void IcelandBackground::Update(float deltaTime)
 
     if (particle_system_)
     {
-        particle_system_->Update(deltaTime);
-
         accumulated_time_ += deltaTime;
         if (accumulated_time_ >= STATE_CHANGE_TIME)
         {
@@ -175,6 +173,14 @@ void IcelandBackground::Update(float deltaTime)
     }
 }
 
+void IcelandBackground::UpdateParticles(float deltaTime)
+{
+    if (particle_system_)
+    {
+        particle_system_->Update(deltaTime);
+    }
+}
+
 void IcelandBackground::Render()
 {
     GameBackground::Render();
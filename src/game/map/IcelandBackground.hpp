@@ -60,6 +60,9 @@ public:
 
     void SetState(IcelandParticleSystem::State state);
 
+protected:
+    void UpdateParticles(float deltaTime) override;
+
 private:
     std::shared_ptr<ImageTexture> effect_texture_;
     SDL_FRect effect_rect_{};
@@ -0,0 +1,228 @@
+#include "NazoPuzzle.hpp"
+#include "../block/Block.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+
+namespace Nazo
+{
+    namespace
+    {
+        constexpr uint8_t FIRST_COLOR = static_cast<uint8_t>(BlockType::Red);
+        constexpr uint8_t LAST_COLOR = static_cast<uint8_t>(BlockType::Purple);
+
+        constexpr const char* ROTATION_NAMES[] = { "down", "right", "up", "left" };
+
+        bool IsColorDigit(char c)
+        {
+            return c >= '0' + FIRST_COLOR && c <= '0' + LAST_COLOR;
+        }
+
+        std::string_view Trim(std::string_view text)
+        {
+            const size_t begin = text.find_first_not_of(" \t\r");
+            if (begin == std::string_view::npos)
+            {
+                return {};
+            }
+            return text.substr(begin, text.find_last_not_of(" \t\r") - begin + 1);
+        }
+
+        //    ܾ 
+        std::string_view NextToken(std::string_view& text)
+        {
+            text = Trim(text);
+            const size_t end = std::min(text.find_first_of(" \t"), text.size());
+            const std::string_view token = text.substr(0, end);
+            text.remove_prefix(end);
+            return token;
+        }
+
+        bool ParseGoal(std::string_view text, Goal& goal)
+        {
+            const std::string_view type = NextToken(text);
+            const std::string_view value = NextToken(text);
+            int number = 0;
+            const bool hasNumber = std::from_chars(value.data(), value.data() + value.size(), number).ec == std::errc{};
+
+            if (type == "all-clear")
+            {
+                goal = { GoalType::AllClear, 0 };
+                return value.empty();
+            }
+            if (type == "chain" && hasNumber && number >= 1 && number <= Constants::Game::MAX_COMBO)
+            {
+                goal = { GoalType::Chain, static_cast<uint8_t>(number) };
+                return true;
+            }
+            if (type == "clear-color" && hasNumber && number >= FIRST_COLOR && number <= LAST_COLOR)
+            {
+                goal = { GoalType::ClearColor, static_cast<uint8_t>(number) };
+                return true;
+            }
+            return false;
+        }
+
+        bool ParsePieces(std::string_view text, std::vector<Piece>& pieces)
+        {
+            for (std::string_view token = NextToken(text); !token.empty(); token = NextToken(text))
+            {
+                if (token.size() != 2 || !IsColorDigit(token[0]) || !IsColorDigit(token[1]) || pieces.size() >= MAX_PIECES)
+                {
+                    return false;
+                }
+                pieces.push_back({ static_cast<uint8_t>(token[0] - '0'), static_cast<uint8_t>(token[1] - '0') });
+            }
+            return !pieces.empty();
+        }
+
+        std::optional<Puzzle> Fail(std::string* error, std::string message)
+        {
+            if (error)
+            {
+                *error = std::move(message);
+            }
+            return std::nullopt;
+        }
+    }
+
+    std::optional<Puzzle> Parse(std::string_view text, std::string* error)
+    {
+        Puzzle puzzle;
+        bool hasGoal = false;
+
+        while (!text.empty())
+        {
+            const size_t end = text.find('\n');
+            const std::string_view line = Trim(text.substr(0, end));
+
+            //  ڷ ϴ ù ٺ
+            if (!line.empty() && line.front() >= '0' && line.front() <= '9')
+            {
+                break;
+            }
+
+            text = (end == std::string_view::npos) ? std::string_view{} : text.substr(end + 1);
+
+            std::string_view rest = line;
+            const std::string_view key = NextToken(rest);
+
+            if (key.empty() || key.front() == '#')
+            {
+                continue;
+            }
+            else if (key == "goal")
+            {
+                if (!ParseGoal(rest, puzzle.goal))
+                {
+                    return Fail(error, std::format("invalid goal '{}'", Trim(rest)));
+                }
+                hasGoal = true;
+            }
+            else if (key == "pieces")
+            {
+                if (!ParsePieces(rest, puzzle.pieces))
+                {
+                    return Fail(error, std::format("invalid pieces '{}'", Trim(rest)));
+                }
+            }
+            else
+            {
+                return Fail(error, std::format("unknown key '{}'", key));
+            }
+        }
+
+        if (!hasGoal || puzzle.pieces.empty())
+        {
+            return Fail(error, "goal and pieces are required");
+        }
+
+        auto board = Analysis::Board::FromText(text);
+        if (!board)
+        {
+            return Fail(error, std::format("board needs {} rows of block types", Analysis::BOARD_HEIGHT));
+        }
+
+        puzzle.board = *board;
+        return puzzle;
+    }
+
+    bool Place(Analysis::Board& board, const Piece& piece, Placement placement)
+    {
+        const int x = placement.column;
+
+        switch (placement.rotation)
+        {
+        case Rotation::Default:
+        case Rotation::Top:
+        {
+            if (x >= Analysis::BOARD_WIDTH || board.GetHeight(x) + 2 > Analysis::BOARD_HEIGHT)
+            {
+                return false;
+            }
+
+            // Ʒ   ´
+            const bool isSatelliteBelow = placement.rotation == Rotation::Default;
+            board.Drop(x, isSatelliteBelow ? piece[1] : piece[0]);
+            board.Drop(x, isSatelliteBelow ? piece[0] : piece[1]);
+            return true;
+        }
+
+        case Rotation::Right:
+        case Rotation::Left:
+        {
+            const int satelliteX = placement.rotation == Rotation::Right ? x + 1 : x - 1;
+            if (x >= Analysis::BOARD_WIDTH || satelliteX < 0 || satelliteX >= Analysis::BOARD_WIDTH ||
+                board.GetHeight(x) >= Analysis::BOARD_HEIGHT || board.GetHeight(satelliteX) >= Analysis::BOARD_HEIGHT)
+            {
+                return false;
+            }
+
+            board.Drop(x, piece[0]);
+            board.Drop(satelliteX, piece[1]);
+            return true;
+        }
+
+        default:
+            return false;
+        }
+    }
+
+    bool IsGoalMet(const Goal& goal, const Analysis::Board& board, uint8_t chain)
+    {
+        switch (goal.type)
+        {
+        case GoalType::AllClear:
+            return board.IsEmpty();
+
+        case GoalType::Chain:
+            return chain >= goal.value;
+
+        case GoalType::ClearColor:
+            return std::none_of(board.GetCells().begin(), board.GetCells().end(),
+                [&goal](uint8_t type) { return type == goal.value; });
+
+        default:
+            return false;
+        }
+    }
+
+    std::string ToString(const Goal& goal)
+    {
+        switch (goal.type)
+        {
+        case GoalType::Chain:
+            return std::format("chain {}", goal.value);
+        case GoalType::ClearColor:
+            return std::format("clear-color {}", goal.value);
+        default:
+            return "all-clear";
+        }
+    }
+
+    std::string ToString(Placement placement)
+    {
+        return std::format("column {} {}", placement.column, ROTATION_NAMES[static_cast<size_t>(placement.rotation)]);
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+/*
+*
+* : ѿ()  İ Ģ
+* 1.  (.nazo): '#' ּ, "goal <ǥ>", "pieces <  >"  ڿ puyo.txt   13
+*      goal all-clear            
+*      goal chain <n>            n  ̻
+*      goal clear-color <>   ش (BlockType )   
+*      pieces 12 34 55          ָ  ڸ ( ,  )
+* 2.    ϳ , Ⱑ   ǥ Ȯ (     ޼ص )
+* 3.  ġ      (GameGroupBlock::RotateState   )
+*      ֹ  ʰ,       ġ 
+*
+*/
+
+#include "../analysis/AnalysisBoard.hpp"
+#include "../system/MatchRandom.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Nazo
+{
+    inline constexpr const char* FILE_EXTENSION = ".nazo";
+    inline constexpr size_t MAX_PIECES = 32;
+
+    using Piece = MatchRandom::Piece;
+
+    enum class GoalType : uint8_t
+    {
+        AllClear,
+        Chain,
+        ClearColor
+    };
+
+    struct Goal
+    {
+        GoalType type{ GoalType::AllClear };
+        uint8_t value{ 0 };     // Chain:  , ClearColor: BlockType
+    };
+
+    //   ġ (Ʒ, , , )
+    enum class Rotation : uint8_t
+    {
+        Default,
+        Right,
+        Top,
+        Left,
+        Count
+    };
+
+    struct Placement
+    {
+        uint8_t column{ 0 };    //   
+        Rotation rotation{ Rotation::Default };
+    };
+
+    struct Puzzle
+    {
+        Analysis::Board board;
+        std::vector<Piece> pieces;
+        Goal goal;
+    };
+
+    //  ߸Ǿ nullopt  Բ error   
+    [[nodiscard]] std::optional<Puzzle> Parse(std::string_view text, std::string* error = nullptr);
+
+    //       false (board  ٲ ʴ´)
+    bool Place(Analysis::Board& board, const Piece& piece, Placement placement);
+
+    //    Ⱑ      ǥ ޼  Ȯ
+    [[nodiscard]] bool IsGoalMet(const Goal& goal, const Analysis::Board& board, uint8_t chain);
+
+    [[nodiscard]] std::string ToString(const Goal& goal);
+    [[nodiscard]] std::string ToString(Placement placement);
+}
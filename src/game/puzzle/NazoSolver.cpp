@@ -0,0 +1,454 @@
+#include "NazoSolver.hpp"
+#include "../block/Block.hpp"
+#include "../../resource/AssetPack.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint8_t FIRST_COLOR = static_cast<uint8_t>(BlockType::Red);
+    constexpr uint8_t LAST_COLOR = static_cast<uint8_t>(BlockType::Purple);
+    constexpr size_t TYPE_COUNT = 8;                     // ĭ  0 ~ Ice
+    constexpr uint32_t DEADLINE_CHECK_INTERVAL = 256;   // 
+
+    // (ĭ,  )    Zobrist 
+    struct HashTable
+    {
+        std::array<std::array<uint64_t, TYPE_COUNT>, Analysis::BOARD_CELLS> cells{};
+        std::array<uint64_t, Nazo::MAX_PIECES + 1> indices{};
+
+        HashTable()
+        {
+            uint64_t state = 0x4E415A4F;    // "NAZO"
+            auto next = [&state]()
+            {
+                uint64_t z = (state += 0x9E3779B97F4A7C15);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+                return z ^ (z >> 31);
+            };
+
+            for (auto& cell : cells)
+            {
+                for (size_t type = 1; type < TYPE_COUNT; ++type)
+                {
+                    cell[type] = next();
+                }
+            }
+            for (auto& index : indices)
+            {
+                index = next();
+            }
+        }
+    };
+
+    const HashTable& GetHashTable()
+    {
+        static const HashTable table;
+        return table;
+    }
+
+    class Search
+    {
+    public:
+
+        Search(const Nazo::Puzzle& puzzle, const NazoSolverOptions& options, Clock::time_point deadline)
+            : puzzle_(puzzle), options_(options), deadline_(deadline), hash_(GetHashTable())
+        {
+        }
+
+        // Ȯ depth    ȿ Ǯ̸ ã´
+        bool Run(size_t depth)
+        {
+            depth_ = depth;
+            path_.clear();
+            return Visit(puzzle_.board, 0);
+        }
+
+        [[nodiscard]] const std::vector<Nazo::Placement>& GetPath() const { return path_; }
+        [[nodiscard]] bool IsTimedOut() const { return is_timed_out_; }
+        [[nodiscard]] uint64_t GetVisitedNodes() const { return visited_nodes_; }
+        [[nodiscard]] size_t GetMemoEntries() const { return failed_.size(); }
+
+    private:
+
+        bool Visit(const Analysis::Board& board, size_t index)
+        {
+            if (++visited_nodes_ % DEADLINE_CHECK_INTERVAL == 0 && Clock::now() >= deadline_)
+            {
+                is_timed_out_ = true;
+            }
+
+            const size_t remaining = depth_ - index;
+            if (is_timed_out_ || remaining == 0 || !IsFeasible(board, index))
+            {
+                return false;
+            }
+
+            //    ٷ Ȯϴ  ޸ ȸ δ
+            const bool useMemo = remaining > 1;
+            const uint64_t key = useMemo ? GetHash(board, index) : 0;
+            if (useMemo)
+            {
+                if (const auto it = failed_.find(key); it != failed_.end() && it->second >= remaining)
+                {
+                    return false;
+                }
+            }
+
+            const auto& piece = puzzle_.pieces[index];
+            const size_t rotationCount = (piece[0] == piece[1]) ? 2 : static_cast<size_t>(Nazo::Rotation::Count);
+
+            for (size_t rotation = 0; rotation < rotationCount; ++rotation)
+            {
+                for (uint8_t column = 0; column < Analysis::BOARD_WIDTH; ++column)
+                {
+                    const Nazo::Placement placement{ column, static_cast<Nazo::Rotation>(rotation) };
+
+                    Analysis::Board next = board;
+                    if (!Nazo::Place(next, piece, placement))
+                    {
+                        continue;
+                    }
+
+                    //   ⸸ ؼ ǥ  ޼ ʴ´ (ó ޼  Solve  ó)
+                    const uint8_t chain = IsFiring(next, placement) ? next.Resolve().chain : 0;
+
+                    path_.push_back(placement);
+                    if ((chain > 0 && Nazo::IsGoalMet(puzzle_.goal, next, chain)) || (remaining > 1 && Visit(next, index + 1)))
+                    {
+                        return true;
+                    }
+                    path_.pop_back();
+                }
+            }
+
+            // ð ʰ ߴܵ Ž з  ʴ´
+            if (useMemo && !is_timed_out_ && failed_.size() < options_.memo_limit)
+            {
+                auto& known = failed_[key];
+                known = std::max(known, static_cast<uint8_t>(remaining));
+            }
+            return false;
+        }
+
+        //      ϳ   ׷쿡 ϴ
+        static bool IsFiring(const Analysis::Board& board, Nazo::Placement placement)
+        {
+            const int x = placement.column;
+            const int y = board.GetHeight(x) - 1;
+
+            switch (placement.rotation)
+            {
+            case Nazo::Rotation::Default:
+            case Nazo::Rotation::Top:
+                return IsMatchedCell(board, x, y) || IsMatchedCell(board, x, y - 1);
+
+            default:
+            {
+                const int satelliteX = placement.rotation == Nazo::Rotation::Right ? x + 1 : x - 1;
+                return IsMatchedCell(board, x, y) || IsMatchedCell(board, satelliteX, board.GetHeight(satelliteX) - 1);
+            }
+            }
+        }
+
+        //   ̿  ׷ Ž  
+        static bool IsMatchedCell(const Analysis::Board& board, int x, int y)
+        {
+            const uint8_t type = board.Get(x, y);
+            const bool hasNeighbor = (x > 0 && board.Get(x - 1, y) == type) ||
+                (x + 1 < Analysis::BOARD_WIDTH && board.Get(x + 1, y) == type) ||
+                (y > 0 && board.Get(x, y - 1) == type) ||
+                (y + 1 < Analysis::BOARD_HEIGHT && board.Get(x, y + 1) == type);
+
+            return hasNeighbor && board.IsMatched(x, y);
+        }
+
+        //    index  depth    ǥ  Ȯ
+        bool IsFeasible(const Analysis::Board& board, size_t index) const
+        {
+            std::array<int, TYPE_COUNT> counts{};
+            for (const uint8_t type : board.GetCells())
+            {
+                ++counts[type];
+            }
+            for (size_t i = index; i < depth_; ++i)
+            {
+                ++counts[puzzle_.pieces[i][0]];
+                ++counts[puzzle_.pieces[i][1]];
+            }
+
+            constexpr int MATCH = Constants::Game::MIN_MATCH_COUNT;
+
+            switch (puzzle_.goal.type)
+            {
+            case Nazo::GoalType::AllClear:
+                for (uint8_t color = FIRST_COLOR; color <= LAST_COLOR; ++color)
+                {
+                    if (counts[color] > 0 && counts[color] < MATCH)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+
+            case Nazo::GoalType::ClearColor:
+            {
+                const int count = counts[puzzle_.goal.value];
+                return count == 0 || count >= MATCH;
+            }
+
+            case Nazo::GoalType::Chain:
+            {
+                int groups = 0;
+                for (uint8_t color = FIRST_COLOR; color <= LAST_COLOR; ++color)
+                {
+                    groups += counts[color] / MATCH;
+                }
+                return groups >= puzzle_.goal.value;
+            }
+
+            default:
+                return true;
+            }
+        }
+
+        uint64_t GetHash(const Analysis::Board& board, size_t index) const
+        {
+            uint64_t hash = hash_.indices[index];
+            const auto& cells = board.GetCells();
+            for (size_t i = 0; i < cells.size(); ++i)
+            {
+                hash ^= hash_.cells[i][cells[i] & (TYPE_COUNT - 1)];
+            }
+            return hash;
+        }
+
+        const Nazo::Puzzle& puzzle_;
+        const NazoSolverOptions& options_;
+        Clock::time_point deadline_;
+        const HashTable& hash_;
+
+        std::unordered_map<uint64_t, uint8_t> failed_;     // ؽ -> Ǯ̰  Ȯ   
+        std::vector<Nazo::Placement> path_;
+        size_t depth_{ 0 };
+        uint64_t visited_nodes_{ 0 };
+        bool is_timed_out_{ false };
+    };
+
+    struct PuzzleReport
+    {
+        std::filesystem::path path;
+        std::string error;
+        NazoSolver::Result result;
+    };
+
+    std::vector<std::filesystem::path> CollectPuzzleFiles(const std::filesystem::path& path)
+    {
+        std::vector<std::filesystem::path> files;
+        std::error_code ec;
+
+        if (!std::filesystem::is_directory(path, ec))
+        {
+            files.push_back(path);
+            return files;
+        }
+
+        for (const auto& entry : std::filesystem::directory_iterator(path, ec))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == Nazo::FILE_EXTENSION)
+            {
+                files.push_back(entry.path());
+            }
+        }
+
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    void SolveFile(PuzzleReport& report, const NazoSolverOptions& options)
+    {
+        std::string text;
+        if (!ASSET_PACK.ReadText(report.path.string(), text))
+        {
+            report.error = "failed to open";
+            return;
+        }
+
+        if (const auto puzzle = Nazo::Parse(text, &report.error))
+        {
+            report.result = NazoSolver::Solve(*puzzle, options);
+        }
+    }
+
+    template <typename T>
+    void ParseNumber(std::string_view value, T& out)
+    {
+        T parsed{};
+        if (std::from_chars(value.data(), value.data() + value.size(), parsed).ec == std::errc{})
+        {
+            out = parsed;
+        }
+    }
+}
+
+NazoSolver::Result NazoSolver::Solve(const Nazo::Puzzle& puzzle, const NazoSolverOptions& options)
+{
+    const auto start = Clock::now();
+    Result result;
+
+    if (Nazo::IsGoalMet(puzzle.goal, puzzle.board, 0))
+    {
+        result.is_solved = true;
+    }
+    else
+    {
+        Search search(puzzle, options, start + options.budget);
+
+        for (size_t depth = 1; depth <= puzzle.pieces.size(); ++depth)
+        {
+            if (search.Run(depth))
+            {
+                result.is_solved = true;
+                result.solution = search.GetPath();
+                break;
+            }
+
+            if (search.IsTimedOut())
+            {
+                result.timed_out = true;
+                break;
+            }
+
+            result.searched_pieces = static_cast<uint8_t>(depth);
+        }
+
+        result.visited_nodes = search.GetVisitedNodes();
+        result.memo_entries = search.GetMemoEntries();
+    }
+
+    result.elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return result;
+}
+
+std::optional<NazoSolveCommandLine> NazoSolver::ParseCommandLine(int argc, char* argv[])
+{
+    std::optional<NazoSolveCommandLine> commandLine;
+
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--nazo-solve")
+        {
+            commandLine.emplace();
+            commandLine->path = argv[++i];
+        }
+    }
+
+    if (!commandLine)
+    {
+        return std::nullopt;
+    }
+
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--nazo-budget")
+        {
+            int64_t budget = commandLine->options.budget.count();
+            ParseNumber(argv[++i], budget);
+            commandLine->options.budget = std::chrono::milliseconds(budget);
+        }
+        else if (arg == "--nazo-threads")
+        {
+            ParseNumber(argv[++i], commandLine->thread_count);
+        }
+    }
+
+    return commandLine;
+}
+
+bool NazoSolver::Run(const NazoSolveCommandLine& commandLine)
+{
+    const auto files = CollectPuzzleFiles(commandLine.path);
+    if (files.empty())
+    {
+        LOGGER.Error("No puzzle files in {}", commandLine.path.string());
+        return false;
+    }
+
+    std::vector<PuzzleReport> reports(files.size());
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        reports[i].path = files[i];
+    }
+
+    //  ϳ  ϳ Ǯ, ȣ 嵵 
+    std::atomic<size_t> nextIndex{ 0 };
+    auto work = [&]()
+    {
+        for (size_t i = nextIndex++; i < reports.size(); i = nextIndex++)
+        {
+            SolveFile(reports[i], commandLine.options);
+        }
+    };
+
+    size_t threadCount = commandLine.thread_count ? commandLine.thread_count : std::thread::hardware_concurrency();
+    threadCount = std::clamp<size_t>(threadCount, 1, reports.size());
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    size_t solvedCount = 0;
+    for (const auto& report : reports)
+    {
+        const auto& result = report.result;
+        const std::string name = report.path.filename().string();
+
+        if (!report.error.empty())
+        {
+            LOGGER.Error("  {}: invalid ({})", name, report.error);
+            continue;
+        }
+
+        if (!result.is_solved)
+        {
+            LOGGER.Warning("  {}: {} within {} pieces ({} nodes, {:.1f} ms)", name,
+                result.timed_out ? "timed out, no solution" : "unsolvable", result.searched_pieces, result.visited_nodes, result.elapsed_ms);
+            continue;
+        }
+
+        ++solvedCount;
+        std::string moves;
+        for (const auto& placement : result.solution)
+        {
+            moves += moves.empty() ? "" : ", ";
+            moves += Nazo::ToString(placement);
+        }
+
+        LOGGER.Info("  {}: solved with {} pieces ({} nodes, {} memo, {:.1f} ms): {}", name,
+            result.solution.size(), result.visited_nodes, result.memo_entries, result.elapsed_ms, moves);
+    }
+
+    LOGGER.Info("Nazo puzzles: {} / {} solvable", solvedCount, reports.size());
+    return solvedCount == reports.size();
+}
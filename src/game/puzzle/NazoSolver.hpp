@@ -0,0 +1,56 @@
+#pragma once
+/*
+*
+* : ѿ  Ǯ̱ (Ǯ  ִ ϰ      Ǯ̸ ã´)
+* 1.     1  ÷  ݺ ȭ  켱 Ž̶ ó ã Ǯ̰ ּ Ǯ
+* 2. ġ
+*    -    Ʒ/, / ġ  带 Ƿ  ⸸ Ž
+*    - (,  ) ؽÿ и Ȯ      忡 ٸ  ϸ ǳʶ (޸̼)
+*    -  ϱ    ǥ Ұϸ ߴ ( : 1~3  , :   ִ ׷  )
+* 3. budget   timed_out  Բ ׶  Ž   ȯ
+* 4. --nazo-solve <file|dir> [--nazo-budget ms] [--nazo-threads n]   (丮  .nazo)  忡 ,
+*    ϳ Ǯ  ų  ߸Ǿ з  (  ϰ )
+*
+*/
+
+#include "NazoPuzzle.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+struct NazoSolverOptions
+{
+    std::chrono::milliseconds budget{ 1000 };
+    size_t memo_limit{ 1 << 20 };                       // ޸ ׸   (   )
+};
+
+struct NazoSolveCommandLine
+{
+    std::filesystem::path path;
+    NazoSolverOptions options;
+    size_t thread_count{ 0 };                           // 0 ̸ ϵ  
+};
+
+class NazoSolver
+{
+public:
+
+    struct Result
+    {
+        bool is_solved{ false };
+        bool timed_out{ false };
+        std::vector<Nazo::Placement> solution;          //   
+        uint8_t searched_pieces{ 0 };                   // Ǯ̰  Ȯ   
+        uint64_t visited_nodes{ 0 };
+        size_t memo_entries{ 0 };
+        double elapsed_ms{ 0.0 };
+    };
+
+    [[nodiscard]] static Result Solve(const Nazo::Puzzle& puzzle, const NazoSolverOptions& options = {});
+
+    [[nodiscard]] static std::optional<NazoSolveCommandLine> ParseCommandLine(int argc, char* argv[]);
+    static bool Run(const NazoSolveCommandLine& commandLine);
+};
@@ -0,0 +1,113 @@
+#include "PuzzleMode.hpp"
+
+#include "../replay/MatchRecorder.hpp"
+#include "../system/BasePlayer.hpp"
+#include "../system/MatchRandom.hpp"
+#include "../../core/GameApp.hpp"
+#include "../../core/manager/PlayerManager.hpp"
+#include "../../core/manager/StateManager.hpp"
+#include "../../network/player/Player.hpp"
+#include "../../resource/AssetPack.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace
+{
+    constexpr uint8_t LOCAL_PLAYER_ID = 1;
+}
+
+PuzzleMode& PuzzleMode::GetInstance()
+{
+    static PuzzleMode instance;
+    return instance;
+}
+
+std::optional<std::filesystem::path> PuzzleMode::ParseCommandLine(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--puzzle" && i + 1 < argc)
+        {
+            return std::filesystem::path(argv[i + 1]);
+        }
+    }
+    return std::nullopt;
+}
+
+bool PuzzleMode::Open(const std::filesystem::path& path)
+{
+    std::string text;
+    if (!ASSET_PACK.ReadText(path.string(), text))
+    {
+        LOGGER.Error("Failed to open puzzle: {}", path.string());
+        return false;
+    }
+
+    std::string error;
+    auto puzzle = Nazo::Parse(text, &error);
+    if (!puzzle)
+    {
+        LOGGER.Error("Invalid puzzle {}: {}", path.string(), error);
+        return false;
+    }
+
+    puzzle_ = std::move(*puzzle);
+    path_ = path;
+    is_active_ = true;
+
+    LOGGER.Info("Puzzle {}: {} with {} pieces", path.string(), Nazo::ToString(puzzle_.goal), puzzle_.pieces.size());
+    return true;
+}
+
+void PuzzleMode::EnterGame()
+{
+    auto& playerManager = GAME_APP.GetPlayerManager();
+    if (auto player = playerManager.CreatePlayer(LOCAL_PLAYER_ID))
+    {
+        playerManager.SetMyPlayer(player);
+    }
+
+    GAME_APP.GetStateManager().RequestStateChange(StateManager::StateID::Game);
+}
+
+void PuzzleMode::Begin()
+{
+    if (!is_active_)
+    {
+        return;
+    }
+
+    //    ġ       Ƿ õ 
+    MATCH_RANDOM.Reset(0);
+    MATCH_RANDOM.SetFixedPieces(puzzle_.pieces);
+    used_pieces_ = 0;
+}
+
+PuzzleMode::Outcome PuzzleMode::OnBoardSettled(BasePlayer& player)
+{
+    if (!is_active_)
+    {
+        return Outcome::None;
+    }
+
+    ++used_pieces_;
+
+    const auto snapshot = MatchRecorder::CaptureBoard(player);
+    const auto board = Analysis::Board::FromCells(snapshot.cells);
+
+    if (Nazo::IsGoalMet(puzzle_.goal, board, player.GetComboCount()))
+    {
+        LOGGER.Info("Puzzle solved with {} of {} pieces", used_pieces_, puzzle_.pieces.size());
+        return Outcome::Solved;
+    }
+
+    if (used_pieces_ >= puzzle_.pieces.size())
+    {
+        LOGGER.Info("Puzzle failed: {} not reached with {} pieces", Nazo::ToString(puzzle_.goal), puzzle_.pieces.size());
+        return Outcome::Failed;
+    }
+
+    return Outcome::None;
+}
@@ -0,0 +1,66 @@
+#pragma once
+/*
+*
+* : ѿ()   (--puzzle <file.nazo>)
+* 1.    ÷̾ ϰ MATCH_RANDOM       
+* 2.   ϳ Ⱑ   LocalPlayer  OnBoardSettled  ǥ Ȯ
+*    ǥ ޼ϸ ¸,     ޼ ϸ й  
+* 3. Ʈũ  ȥ ϸ ġ   
+*
+*/
+
+#include "NazoPuzzle.hpp"
+
+#include <filesystem>
+#include <optional>
+
+class BasePlayer;
+
+class PuzzleMode
+{
+public:
+
+    enum class Outcome
+    {
+        None,       //  
+        Solved,
+        Failed
+    };
+
+    static PuzzleMode& GetInstance();
+
+    PuzzleMode(const PuzzleMode&) = delete;
+    PuzzleMode& operator=(const PuzzleMode&) = delete;
+    PuzzleMode(PuzzleMode&&) = delete;
+    PuzzleMode& operator=(PuzzleMode&&) = delete;
+
+    // --puzzle <path>
+    [[nodiscard]] static std::optional<std::filesystem::path> ParseCommandLine(int argc, char* argv[]);
+
+    [[nodiscard]] bool Open(const std::filesystem::path& path);
+    [[nodiscard]] bool IsActive() const { return is_active_; }
+    [[nodiscard]] const Nazo::Puzzle& GetPuzzle() const { return puzzle_; }
+
+    // α ó  ÷̾   · ȯ (GameApp ʱȭ )
+    void EnterGame();
+
+    // GameState::Enter  ȣ
+    void Begin();
+
+    //   ϳ Ⱑ   (  ʱȭϱ ) ȣ
+    [[nodiscard]] Outcome OnBoardSettled(BasePlayer& player);
+
+private:
+
+    PuzzleMode() = default;
+    ~PuzzleMode() = default;
+
+private:
+
+    Nazo::Puzzle puzzle_;
+    std::filesystem::path path_;
+    bool is_active_{ false };
+    size_t used_pieces_{ 0 };
+};
+
+#define PUZZLE_MODE PuzzleMode::GetInstance()
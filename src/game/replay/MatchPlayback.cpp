@@ -0,0 +1,162 @@
+#include "MatchPlayback.hpp"
+#include "MatchRecorder.hpp"
+
+#include "../system/MatchRandom.hpp"
+#include "../../core/GameApp.hpp"
+#include "../../core/manager/PlayerManager.hpp"
+#include "../../core/manager/StateManager.hpp"
+#include "../../network/player/Player.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <string_view>
+
+MatchPlayback& MatchPlayback::GetInstance()
+{
+    static MatchPlayback instance;
+    return instance;
+}
+
+std::optional<std::filesystem::path> MatchPlayback::ParseCommandLine(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--play-match" && i + 1 < argc)
+        {
+            return std::filesystem::path(argv[i + 1]);
+        }
+    }
+    return std::nullopt;
+}
+
+bool MatchPlayback::Open(const std::filesystem::path& path)
+{
+    if (!replay_.Load(path))
+    {
+        return false;
+    }
+
+    if (replay_.GetHeader().players.empty())
+    {
+        LOGGER.Error("Match replay has no players: {}", path.string());
+        return false;
+    }
+
+    is_active_ = true;
+    LOGGER.Info("Playing match replay {} (seed {:08x})", path.string(), replay_.GetHeader().seed);
+    return true;
+}
+
+void MatchPlayback::EnterGame()
+{
+    const auto& info = GetLocalPlayer();
+
+    auto& playerManager = GAME_APP.GetPlayerManager();
+    if (auto player = playerManager.CreatePlayer(info.id))
+    {
+        player->SetCharacterId(info.character_id);
+        playerManager.SetMyPlayer(player);
+    }
+
+    GAME_APP.GetStateManager().RequestStateChange(StateManager::StateID::Game);
+}
+
+void MatchPlayback::Begin()
+{
+    if (!is_active_)
+    {
+        return;
+    }
+
+    MATCH_RANDOM.Reset(replay_.GetHeader().seed);
+
+    cursor_ = replay_.Begin();
+    has_pending_event_ = false;
+    is_finished_ = false;
+    tick_ = 0;
+    verified_keyframes_ = 0;
+    mismatched_keyframes_ = 0;
+    first_mismatch_tick_.reset();
+}
+
+bool MatchPlayback::PollEvent(Replay::Event& event)
+{
+    if (!is_active_ || is_finished_)
+    {
+        return false;
+    }
+
+    if (!has_pending_event_)
+    {
+        if (!replay_.Next(cursor_, pending_event_))
+        {
+            Finish();
+            return false;
+        }
+        has_pending_event_ = true;
+    }
+
+    if (pending_event_.tick > tick_)
+    {
+        return false;
+    }
+
+    has_pending_event_ = false;
+    event = std::move(pending_event_);
+    return true;
+}
+
+void MatchPlayback::VerifyKeyframe(const Replay::Keyframe& keyframe, BasePlayer& localPlayer)
+{
+    for (size_t i = 0; i < keyframe.boards.size(); ++i)
+    {
+        if (keyframe.players[i] != LOCAL_PLAYER_INDEX)
+        {
+            continue;
+        }
+
+        ++verified_keyframes_;
+
+        const auto actual = MatchRecorder::CaptureBoard(localPlayer);
+        const auto& expected = keyframe.boards[i];
+        const bool isRandomSynced = keyframe.random_draws == MATCH_RANDOM.GetDrawCount();
+
+        if (actual == expected && isRandomSynced)
+        {
+            return;
+        }
+
+        ++mismatched_keyframes_;
+
+        // ó ߳  ڼ  Ĵ  
+        if (!first_mismatch_tick_)
+        {
+            first_mismatch_tick_ = keyframe.tick;
+            LOGGER.Warning("Match replay diverged at tick {}: score {} / {}, pending garbage {} / {}, random draws {} / {}\nrecorded:\n{}replayed:\n{}",
+                keyframe.tick, expected.score, actual.score, expected.pending_garbage, actual.pending_garbage,
+                keyframe.random_draws, MATCH_RANDOM.GetDrawCount(), Replay::ToBoardText(expected), Replay::ToBoardText(actual));
+        }
+        return;
+    }
+}
+
+void MatchPlayback::Finish()
+{
+    if (is_finished_)
+    {
+        return;
+    }
+
+    is_finished_ = true;
+
+    if (first_mismatch_tick_)
+    {
+        LOGGER.Warning("Match replay finished at tick {}: {} of {} keyframes diverged (first at tick {})",
+            tick_, mismatched_keyframes_, verified_keyframes_, *first_mismatch_tick_);
+    }
+    else
+    {
+        LOGGER.Info("Match replay finished at tick {}: {} keyframes verified", tick_, verified_keyframes_);
+    }
+
+    GAME_APP.SetGameRunning(false);
+}
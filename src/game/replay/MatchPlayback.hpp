@@ -0,0 +1,74 @@
+#pragma once
+/*
+*
+* :  ġ   ٽ  (--play-match <path>)
+* 1.  õ MATCH_RANDOM  ʱȭϰ  ÷̾ ٷ  ¿ , Ű Է 
+* 2.  ÷̾ Է//  ȭ ̺Ʈ ϵ ƽ  (  Ŷ Ƿ Űθ Ȯ)
+* 3. ŰӸ  //  Ƚ Ͽ ó ߳ ƽ  带 α׷ 
+* 4. --headless --time-scale 10~100  Բ  ð ϰ   ,  α׷ 
+*
+*/
+
+#include "MatchReplay.hpp"
+
+#include <filesystem>
+#include <optional>
+
+class BasePlayer;
+
+class MatchPlayback
+{
+public:
+
+    static constexpr uint8_t LOCAL_PLAYER_INDEX = 0;
+
+    static MatchPlayback& GetInstance();
+
+    MatchPlayback(const MatchPlayback&) = delete;
+    MatchPlayback& operator=(const MatchPlayback&) = delete;
+    MatchPlayback(MatchPlayback&&) = delete;
+    MatchPlayback& operator=(MatchPlayback&&) = delete;
+
+    // --play-match <path>
+    [[nodiscard]] static std::optional<std::filesystem::path> ParseCommandLine(int argc, char* argv[]);
+
+    [[nodiscard]] bool Open(const std::filesystem::path& path);
+    [[nodiscard]] bool IsActive() const { return is_active_; }
+    [[nodiscard]] const Replay::Header& GetHeader() const { return replay_.GetHeader(); }
+    [[nodiscard]] const Replay::PlayerInfo& GetLocalPlayer() const { return replay_.GetHeader().players[LOCAL_PLAYER_INDEX]; }
+
+    //   ÷̾ α ó ϰ  · ȯ (GameApp ʱȭ )
+    void EnterGame();
+
+    // GameState::Enter  ȣ
+    void Begin();
+
+    //  ƽ   ̺Ʈ (GameState::Update      ȣ)
+    bool PollEvent(Replay::Event& event);
+    void AdvanceTick() { ++tick_; }
+
+    void VerifyKeyframe(const Replay::Keyframe& keyframe, BasePlayer& localPlayer);
+    void Finish();
+
+private:
+
+    MatchPlayback() = default;
+    ~MatchPlayback() = default;
+
+private:
+
+    MatchReplay replay_;
+    MatchReplay::Cursor cursor_;
+    Replay::Event pending_event_;
+    bool has_pending_event_{ false };
+
+    bool is_active_{ false };
+    bool is_finished_{ false };
+    uint64_t tick_{ 0 };
+
+    uint64_t verified_keyframes_{ 0 };
+    uint64_t mismatched_keyframes_{ 0 };
+    std::optional<uint64_t> first_mismatch_tick_;
+};
+
+#define MATCH_PLAYBACK MatchPlayback::GetInstance()
@@ -0,0 +1,285 @@
+#include "MatchRecorder.hpp"
+
+#include "../system/BasePlayer.hpp"
+#include "../block/Block.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <chrono>
+#include <format>
+#include <fstream>
+
+MatchRecorder& MatchRecorder::GetInstance()
+{
+    static MatchRecorder instance;
+    return instance;
+}
+
+Replay::BoardSnapshot MatchRecorder::CaptureBoard(BasePlayer& player)
+{
+    Replay::BoardSnapshot snapshot;
+
+    auto blocks = player.GetGameBlocks();
+    for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; ++y)
+    {
+        for (int x = 0; x < Constants::Board::BOARD_X_COUNT; ++x)
+        {
+            if (const Block* block = blocks[y][x])
+            {
+                snapshot.cells[y * Constants::Board::BOARD_X_COUNT + x] = static_cast<uint8_t>(block->GetBlockType());
+            }
+        }
+    }
+
+    snapshot.score = player.GetTotalScore();
+    snapshot.pending_garbage = player.GetTotalInterruptBlockCount();
+    snapshot.phase = static_cast<uint8_t>(player.GetGameState());
+    return snapshot;
+}
+
+void MatchRecorder::Enable(std::filesystem::path directory)
+{
+    directory_ = std::move(directory);
+    is_enabled_ = true;
+}
+
+void MatchRecorder::Begin(uint32_t seed, const Replay::PlayerInfo& localPlayer)
+{
+    if (!is_enabled_)
+    {
+        return;
+    }
+
+    Finish();
+
+    header_ = Replay::Header{};
+    header_.seed = seed;
+    header_.recorded_at = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    header_.players.push_back(localPlayer);
+
+    events_.Clear();
+    keyframe_index_.clear();
+
+    tick_ = 0;
+    last_event_tick_ = 0;
+    next_keyframe_tick_ = 0;
+    is_recording_ = true;
+}
+
+void MatchRecorder::AddPlayer(const Replay::PlayerInfo& player)
+{
+    if (!is_recording_ || FindPlayerIndex(player.id) >= 0 || header_.players.size() >= Replay::MAX_PLAYERS)
+    {
+        return;
+    }
+
+    header_.players.push_back(player);
+}
+
+void MatchRecorder::Finish(uint8_t winnerId)
+{
+    if (!is_recording_)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    event.type = Replay::EventType::End;
+    const int winner = FindPlayerIndex(winnerId);
+    event.winner = winner >= 0 ? static_cast<uint8_t>(winner) : Replay::NO_WINNER;
+    Write(event);
+
+    is_recording_ = false;
+    Save();
+}
+
+int MatchRecorder::FindPlayerIndex(uint8_t playerId) const
+{
+    for (size_t i = 0; i < header_.players.size(); ++i)
+    {
+        if (header_.players[i].id == playerId)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void MatchRecorder::AdvanceTick()
+{
+    if (is_recording_)
+    {
+        ++tick_;
+    }
+}
+
+void MatchRecorder::Write(Replay::Event& event)
+{
+    event.tick = tick_;
+    Replay::WriteEvent(events_, event, last_event_tick_);
+    last_event_tick_ = tick_;
+}
+
+void MatchRecorder::RecordKeyframe(uint64_t randomDraws, std::span<BasePlayer* const> players)
+{
+    if (!is_recording_)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    event.type = Replay::EventType::Keyframe;
+    event.keyframe.random_draws = randomDraws;
+
+    for (auto* player : players)
+    {
+        const int index = player ? FindPlayerIndex(player->GetPlayerID()) : -1;
+        if (index < 0)
+        {
+            continue;
+        }
+
+        event.keyframe.players.push_back(static_cast<uint8_t>(index));
+        event.keyframe.boards.push_back(CaptureBoard(*player));
+    }
+
+    keyframe_index_.push_back({ tick_, events_.GetSize() });
+    Write(event);
+
+    next_keyframe_tick_ = tick_ + Replay::KEYFRAME_INTERVAL;
+}
+
+void MatchRecorder::RecordNextBlock(uint8_t playerId, uint8_t blockType1, uint8_t blockType2)
+{
+    const int index = is_recording_ ? FindPlayerIndex(playerId) : -1;
+    if (index < 0)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    event.type = Replay::EventType::NextBlock;
+    event.player = static_cast<uint8_t>(index);
+    event.block_types = { blockType1, blockType2 };
+    Write(event);
+}
+
+void MatchRecorder::RecordInput(uint8_t playerId, Replay::InputAction action)
+{
+    const int index = is_recording_ ? FindPlayerIndex(playerId) : -1;
+    if (index < 0)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    event.type = Replay::EventType::Input;
+    event.player = static_cast<uint8_t>(index);
+    event.action = action;
+    Write(event);
+}
+
+void MatchRecorder::RecordMove(uint8_t playerId, uint8_t moveType)
+{
+    switch (static_cast<Constants::Direction>(moveType))
+    {
+    case Constants::Direction::Left:
+        RecordInput(playerId, Replay::InputAction::MoveLeft);
+        break;
+    case Constants::Direction::Right:
+        RecordInput(playerId, Replay::InputAction::MoveRight);
+        break;
+    case Constants::Direction::Bottom:
+        RecordInput(playerId, Replay::InputAction::SoftDrop);
+        break;
+    default:
+        break;
+    }
+}
+
+void MatchRecorder::RecordStart(uint8_t playerId)
+{
+    const int index = is_recording_ ? FindPlayerIndex(playerId) : -1;
+    if (index < 0)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    event.type = Replay::EventType::Start;
+    event.player = static_cast<uint8_t>(index);
+    Write(event);
+}
+
+void MatchRecorder::RecordGarbageState(uint8_t playerId, int16_t total, bool comboAttack)
+{
+    const int index = is_recording_ ? FindPlayerIndex(playerId) : -1;
+    if (index < 0)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    event.type = Replay::EventType::GarbageState;
+    event.player = static_cast<uint8_t>(index);
+    event.garbage_total = total;
+    event.combo_attack = comboAttack;
+    Write(event);
+}
+
+void MatchRecorder::RecordGarbageDrop(uint8_t playerId, uint8_t rows, uint8_t columnMask)
+{
+    const int index = is_recording_ ? FindPlayerIndex(playerId) : -1;
+    if (index < 0)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    event.type = Replay::EventType::GarbageDrop;
+    event.player = static_cast<uint8_t>(index);
+    event.garbage_rows = rows;
+    event.garbage_columns = columnMask;
+    Write(event);
+}
+
+bool MatchRecorder::Save() const
+{
+    std::error_code error;
+    std::filesystem::create_directories(directory_, error);
+
+    const auto path = directory_ / std::format("match_{}_{:08x}{}", header_.recorded_at, header_.seed, Replay::FILE_EXTENSION);
+
+    Replay::ByteWriter header;
+    Replay::WriteHeader(header, header_);
+
+    // ε  ̺Ʈ  , ε ġ  
+    Replay::ByteWriter footer;
+    Replay::WriteIndex(footer, keyframe_index_, static_cast<uint32_t>(header.GetSize() + events_.GetSize()));
+
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    if (!stream)
+    {
+        LOGGER.Error("Failed to open match replay file: {}", path.string());
+        return false;
+    }
+
+    auto writePart = [&stream](const Replay::ByteWriter& part)
+    {
+        stream.write(reinterpret_cast<const char*>(part.GetBytes().data()), static_cast<std::streamsize>(part.GetSize()));
+    };
+
+    writePart(header);
+    writePart(events_);
+    writePart(footer);
+
+    if (!stream)
+    {
+        LOGGER.Error("Failed to write match replay file: {}", path.string());
+        return false;
+    }
+
+    LOGGER.Info("Match replay saved to {} ({} bytes, {} ticks, {} keyframes)",
+        path.string(), header.GetSize() + events_.GetSize() + footer.GetSize(), tick_, keyframe_index_.size());
+    return true;
+}
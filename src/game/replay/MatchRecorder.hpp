@@ -0,0 +1,81 @@
+#pragma once
+/*
+*
+* :   ġ ÷ (.ppr) 
+* 1. --record-match [dir]  Ѹ ġ dir/match_<ð>_<õ>.ppr  
+* 2. ġ  õ,   Է(̵/ȸ/Ʈ ),  , ܺο    ȭ ϸ ƽ  
+* 3. KEYFRAME_INTERVAL ƽ  ÷̾ 带 Ű    Ž ȭ  
+* 4.  ޸𸮿  ξٰ ġ  ( // Ż)   
+* 5.   
+*
+*/
+
+#include "ReplayFormat.hpp"
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+class BasePlayer;
+
+class MatchRecorder
+{
+public:
+
+    static constexpr const char* DEFAULT_DIRECTORY = "replays";
+
+    static MatchRecorder& GetInstance();
+
+    MatchRecorder(const MatchRecorder&) = delete;
+    MatchRecorder& operator=(const MatchRecorder&) = delete;
+    MatchRecorder(MatchRecorder&&) = delete;
+    MatchRecorder& operator=(MatchRecorder&&) = delete;
+
+    [[nodiscard]] static Replay::BoardSnapshot CaptureBoard(BasePlayer& player);
+
+    void Enable(std::filesystem::path directory);
+    [[nodiscard]] bool IsEnabled() const { return is_enabled_; }
+    [[nodiscard]] bool IsRecording() const { return is_recording_; }
+
+    // ġ  ( ġ  ̸  )
+    void Begin(uint32_t seed, const Replay::PlayerInfo& localPlayer);
+    void AddPlayer(const Replay::PlayerInfo& player);
+    void Finish(uint8_t winnerId = Replay::NO_WINNER);
+
+    //  GameState::Update  ȣ
+    void AdvanceTick();
+    [[nodiscard]] bool IsKeyframeDue() const { return is_recording_ && tick_ >= next_keyframe_tick_; }
+    void RecordKeyframe(uint64_t randomDraws, std::span<BasePlayer* const> players);
+
+    void RecordNextBlock(uint8_t playerId, uint8_t blockType1, uint8_t blockType2);
+    void RecordInput(uint8_t playerId, Replay::InputAction action);
+    void RecordMove(uint8_t playerId, uint8_t moveType);    // Constants::Direction (Left/Right/Bottom)
+    void RecordStart(uint8_t playerId);
+    void RecordGarbageState(uint8_t playerId, int16_t total, bool comboAttack);
+    void RecordGarbageDrop(uint8_t playerId, uint8_t rows, uint8_t columnMask);
+
+private:
+
+    MatchRecorder() = default;
+    ~MatchRecorder() = default;
+
+    [[nodiscard]] int FindPlayerIndex(uint8_t playerId) const;
+    void Write(Replay::Event& event);
+    bool Save() const;
+
+private:
+
+    std::filesystem::path directory_;
+    bool is_enabled_{ false };
+    bool is_recording_{ false };
+
+    Replay::Header header_;
+    Replay::ByteWriter events_;
+    std::vector<Replay::KeyframeIndexEntry> keyframe_index_;
+
+    uint64_t tick_{ 0 };
+    uint64_t last_event_tick_{ 0 };
+    uint64_t next_keyframe_tick_{ 0 };
+};
+
+#define MATCH_RECORDER MatchRecorder::GetInstance()
@@ -0,0 +1,217 @@
+#include "MatchReplay.hpp"
+
+#include "../../utils/Logger.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+
+namespace
+{
+    constexpr std::array<std::string_view, static_cast<size_t>(Replay::EventType::Count)> EVENT_NAMES =
+    {
+        "NextBlock",
+        "Input",
+        "Start",
+        "GarbageState",
+        "GarbageDrop",
+        "Keyframe",
+        "End",
+    };
+}
+
+std::optional<MatchReplayInfoOptions> MatchReplay::ParseCommandLine(int argc, char* argv[])
+{
+    std::optional<MatchReplayInfoOptions> options;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--replay-info" && i + 1 < argc)
+        {
+            options.emplace();
+            options->replay_path = argv[++i];
+        }
+    }
+
+    if (!options)
+    {
+        return std::nullopt;
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--replay-seek" && i + 1 < argc)
+        {
+            const std::string_view value(argv[++i]);
+            uint64_t tick = 0;
+            if (std::from_chars(value.data(), value.data() + value.size(), tick).ec == std::errc{})
+            {
+                options->seek_tick = tick;
+            }
+        }
+    }
+
+    return options;
+}
+
+bool MatchReplay::Load(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        LOGGER.Error("Failed to open match replay: {}", path.string());
+        return false;
+    }
+
+    bytes_.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+    Replay::ByteReader reader(bytes_);
+    if (!Replay::ReadHeader(reader, header_) || !Replay::ReadIndex(bytes_, keyframe_index_, index_offset_) ||
+        reader.GetPosition() > index_offset_)
+    {
+        LOGGER.Error("Invalid match replay file: {}", path.string());
+        bytes_.clear();
+        return false;
+    }
+
+    events_offset_ = reader.GetPosition();
+    return true;
+}
+
+std::span<const uint8_t> MatchReplay::GetEventBytes() const
+{
+    // ̺Ʈ бⰡ ε  Ѿ ʵ ߶ 
+    return std::span<const uint8_t>(bytes_).first(index_offset_);
+}
+
+bool MatchReplay::Next(Cursor& cursor, Replay::Event& event) const
+{
+    if (cursor.position >= index_offset_)
+    {
+        return false;
+    }
+
+    Replay::ByteReader reader(GetEventBytes(), cursor.position);
+    if (!Replay::ReadEvent(reader, event, cursor.tick))
+    {
+        LOGGER.Warning("Corrupted match replay event at offset {}", cursor.position);
+        cursor.position = index_offset_;
+        return false;
+    }
+
+    cursor.position = reader.GetPosition();
+    cursor.tick = event.tick;
+    return true;
+}
+
+bool MatchReplay::Seek(uint64_t tick, Cursor& cursor, Replay::Keyframe& keyframe) const
+{
+    cursor = Begin();
+    keyframe = Replay::Keyframe{};
+
+    auto it = std::upper_bound(keyframe_index_.begin(), keyframe_index_.end(), tick,
+        [](uint64_t value, const Replay::KeyframeIndexEntry& entry)
+        {
+            return value < entry.tick;
+        });
+
+    if (it == keyframe_index_.begin())
+    {
+        return true;
+    }
+
+    const auto& entry = *std::prev(it);
+    Cursor keyframeCursor{ events_offset_ + static_cast<size_t>(entry.offset), 0 };
+
+    // Ű ƽ ̴  ̺Ʈ ̹Ƿ ε ƽ ٷ´
+    Replay::Event event;
+    if (!Next(keyframeCursor, event) || event.type != Replay::EventType::Keyframe)
+    {
+        return false;
+    }
+
+    keyframe = std::move(event.keyframe);
+    keyframe.tick = entry.tick;
+
+    cursor = { keyframeCursor.position, entry.tick };
+    return true;
+}
+
+bool MatchReplay::PrintInfo(const MatchReplayInfoOptions& options)
+{
+    MatchReplay replay;
+    if (!replay.Load(options.replay_path))
+    {
+        return false;
+    }
+
+    const auto& header = replay.GetHeader();
+
+    std::array<uint64_t, static_cast<size_t>(Replay::EventType::Count)> counts{};
+    uint64_t lastTick = 0;
+    uint8_t winner = Replay::NO_WINNER;
+
+    auto cursor = replay.Begin();
+    Replay::Event event;
+    while (replay.Next(cursor, event))
+    {
+        ++counts[static_cast<size_t>(event.type)];
+        lastTick = event.tick;
+
+        if (event.type == Replay::EventType::End)
+        {
+            winner = event.winner;
+        }
+    }
+
+    LOGGER.Info("Match replay {} ({} bytes)", options.replay_path.string(), replay.GetFileSize());
+    LOGGER.Info("  seed {:08x}, recorded at {}, {} ticks ({:.1f} s at {} Hz)",
+        header.seed, header.recorded_at, lastTick, static_cast<double>(lastTick) / header.logic_rate, header.logic_rate);
+
+    for (size_t i = 0; i < header.players.size(); ++i)
+    {
+        LOGGER.Info("  player {}: id {} character {}{}", i, header.players[i].id, header.players[i].character_id,
+            i == winner ? " (winner)" : "");
+    }
+
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+        LOGGER.Info("  {:<14}{}", EVENT_NAMES[i], counts[i]);
+    }
+
+    if (!options.seek_tick)
+    {
+        return true;
+    }
+
+    Replay::Keyframe keyframe;
+    if (!replay.Seek(*options.seek_tick, cursor, keyframe))
+    {
+        LOGGER.Error("Failed to seek to tick {}", *options.seek_tick);
+        return false;
+    }
+
+    // Ű  ǥ ƽ ̺Ʈ 带 ٽ  ʰ ϸ  ش
+    uint64_t pendingEvents = 0;
+    while (replay.Next(cursor, event) && event.tick <= *options.seek_tick)
+    {
+        ++pendingEvents;
+    }
+
+    LOGGER.Info("Seek to tick {}: keyframe at tick {}, {} events until target", *options.seek_tick, keyframe.tick, pendingEvents);
+
+    for (size_t i = 0; i < keyframe.boards.size(); ++i)
+    {
+        const auto& board = keyframe.boards[i];
+        LOGGER.Info("player {} score {} pending garbage {}\n{}", keyframe.players[i], board.score, board.pending_garbage,
+            Replay::ToBoardText(board));
+    }
+
+    return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+/*
+*
+* : ġ ÷ (.ppr) б
+* 1.  ü ޸𸮿 ø    Ű ε  ؼ (̺Ʈ Ŀ ʿ ŭ ڵ)
+* 2. Seek  ε ̺ ŽϿ ǥ ƽ    Ű ϳ ڵ   ġ ̺Ʈ ̾ д´
+* 3. --replay-info <path> [--replay-seek <tick>]  â  (/̺Ʈ /) Ž ƽ 带  ( , 뷮 м)
+*
+*/
+
+#include "ReplayFormat.hpp"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+struct MatchReplayInfoOptions
+{
+    std::filesystem::path replay_path;
+    std::optional<uint64_t> seek_tick;
+};
+
+class MatchReplay
+{
+public:
+
+    struct Cursor
+    {
+        size_t position{ 0 };
+        uint64_t tick{ 0 };
+    };
+
+    // --replay-info <path> [--replay-seek <tick>]
+    [[nodiscard]] static std::optional<MatchReplayInfoOptions> ParseCommandLine(int argc, char* argv[]);
+    static bool PrintInfo(const MatchReplayInfoOptions& options);
+
+    [[nodiscard]] bool Load(const std::filesystem::path& path);
+
+    [[nodiscard]] const Replay::Header& GetHeader() const { return header_; }
+    [[nodiscard]] const std::vector<Replay::KeyframeIndexEntry>& GetKeyframeIndex() const { return keyframe_index_; }
+    [[nodiscard]] size_t GetFileSize() const { return bytes_.size(); }
+
+    [[nodiscard]] Cursor Begin() const { return { events_offset_, 0 }; }
+
+    // Ŀ ġ ̺Ʈ а  ̵, ̰ų ջ  false
+    bool Next(Cursor& cursor, Replay::Event& event) const;
+
+    // tick   Ű ̵ (Ű  ó, keyframe   )
+    bool Seek(uint64_t tick, Cursor& cursor, Replay::Keyframe& keyframe) const;
+
+private:
+
+    [[nodiscard]] std::span<const uint8_t> GetEventBytes() const;
+
+private:
+
+    std::vector<uint8_t> bytes_;
+    Replay::Header header_;
+    std::vector<Replay::KeyframeIndexEntry> keyframe_index_;
+    size_t events_offset_{ 0 };
+    size_t index_offset_{ 0 };
+};
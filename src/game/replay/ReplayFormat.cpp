@@ -0,0 +1,414 @@
+#include "ReplayFormat.hpp"
+
+#include <algorithm>
+
+namespace Replay
+{
+    namespace
+    {
+        constexpr size_t MAX_VARINT_BYTES = 10;
+        constexpr size_t FOOTER_SIZE = 8;
+
+        void WriteBoard(ByteWriter& writer, const BoardSnapshot& board)
+        {
+            WriteCells(writer, board.cells);
+            writer.WriteVarint(board.score);
+            writer.WriteSigned(board.pending_garbage);
+            writer.WriteByte(board.phase);
+        }
+
+        bool ReadBoard(ByteReader& reader, BoardSnapshot& board)
+        {
+            uint64_t score = 0;
+            int64_t pending = 0;
+
+            if (!ReadCells(reader, board.cells) || !reader.ReadVarint(score) || !reader.ReadSigned(pending) || !reader.ReadByte(board.phase))
+            {
+                return false;
+            }
+
+            board.score = static_cast<uint32_t>(score);
+            board.pending_garbage = static_cast<int16_t>(pending);
+            return true;
+        }
+    }
+
+    void ByteWriter::WriteVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            bytes_.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        bytes_.push_back(static_cast<uint8_t>(value));
+    }
+
+    void ByteWriter::WriteSigned(int64_t value)
+    {
+        // zigzag: 밪   1Ʈ 
+        WriteVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void ByteWriter::WriteFixed32(uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            bytes_.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    bool ByteReader::ReadByte(uint8_t& value)
+    {
+        if (!is_valid_ || position_ >= bytes_.size())
+        {
+            is_valid_ = false;
+            return false;
+        }
+
+        value = bytes_[position_++];
+        return true;
+    }
+
+    bool ByteReader::ReadVarint(uint64_t& value)
+    {
+        value = 0;
+        for (size_t i = 0; i < MAX_VARINT_BYTES; ++i)
+        {
+            uint8_t byte = 0;
+            if (!ReadByte(byte))
+            {
+                return false;
+            }
+
+            value |= static_cast<uint64_t>(byte & 0x7F) << (i * 7);
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+
+        is_valid_ = false;
+        return false;
+    }
+
+    bool ByteReader::ReadSigned(int64_t& value)
+    {
+        uint64_t encoded = 0;
+        if (!ReadVarint(encoded))
+        {
+            return false;
+        }
+
+        value = static_cast<int64_t>(encoded >> 1) ^ -static_cast<int64_t>(encoded & 1);
+        return true;
+    }
+
+    bool ByteReader::ReadFixed32(uint32_t& value)
+    {
+        value = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            uint8_t byte = 0;
+            if (!ReadByte(byte))
+            {
+                return false;
+            }
+            value |= static_cast<uint32_t>(byte) << (i * 8);
+        }
+        return true;
+    }
+
+    bool ByteReader::ReadBytes(std::span<uint8_t> out)
+    {
+        if (!is_valid_ || bytes_.size() - position_ < out.size())
+        {
+            is_valid_ = false;
+            return false;
+        }
+
+        std::copy_n(bytes_.begin() + position_, out.size(), out.begin());
+        position_ += out.size();
+        return true;
+    }
+
+    void WriteCells(ByteWriter& writer, const std::array<uint8_t, BOARD_CELLS>& cells)
+    {
+        // ĭ 4Ʈ (BlockType  Ice = 7 )
+        std::array<uint8_t, PACKED_BOARD_SIZE> packed{};
+        for (size_t i = 0; i < BOARD_CELLS; ++i)
+        {
+            packed[i / 2] |= static_cast<uint8_t>((cells[i] & 0x0F) << ((i % 2) * 4));
+        }
+
+        writer.WriteBytes(packed);
+    }
+
+    bool ReadCells(ByteReader& reader, std::array<uint8_t, BOARD_CELLS>& cells)
+    {
+        std::array<uint8_t, PACKED_BOARD_SIZE> packed{};
+        if (!reader.ReadBytes(packed))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < BOARD_CELLS; ++i)
+        {
+            cells[i] = static_cast<uint8_t>((packed[i / 2] >> ((i % 2) * 4)) & 0x0F);
+        }
+        return true;
+    }
+
+    void WriteHeader(ByteWriter& writer, const Header& header)
+    {
+        writer.WriteFixed32(FILE_MAGIC);
+        writer.WriteByte(FILE_VERSION);
+        writer.WriteVarint(header.seed);
+        writer.WriteVarint(header.recorded_at);
+        writer.WriteVarint(header.logic_rate);
+        writer.WriteByte(static_cast<uint8_t>(header.players.size()));
+
+        for (const auto& player : header.players)
+        {
+            writer.WriteByte(player.id);
+            writer.WriteVarint(player.character_id);
+        }
+    }
+
+    bool ReadHeader(ByteReader& reader, Header& header)
+    {
+        uint32_t magic = 0;
+        uint8_t version = 0;
+        uint64_t seed = 0, logicRate = 0;
+        uint8_t playerCount = 0;
+
+        if (!reader.ReadFixed32(magic) || magic != FILE_MAGIC ||
+            !reader.ReadByte(version) || version != FILE_VERSION ||
+            !reader.ReadVarint(seed) || !reader.ReadVarint(header.recorded_at) || !reader.ReadVarint(logicRate) ||
+            !reader.ReadByte(playerCount) || playerCount > MAX_PLAYERS)
+        {
+            return false;
+        }
+
+        header.seed = static_cast<uint32_t>(seed);
+        header.logic_rate = static_cast<uint32_t>(logicRate);
+        header.players.resize(playerCount);
+
+        for (auto& player : header.players)
+        {
+            uint64_t characterId = 0;
+            if (!reader.ReadByte(player.id) || !reader.ReadVarint(characterId))
+            {
+                return false;
+            }
+            player.character_id = static_cast<uint16_t>(characterId);
+        }
+
+        return true;
+    }
+
+    void WriteEvent(ByteWriter& writer, const Event& event, uint64_t previousTick)
+    {
+        writer.WriteByte(MakeTag(event.type, event.player));
+        writer.WriteVarint(event.tick - previousTick);
+
+        switch (event.type)
+        {
+        case EventType::NextBlock:
+            writer.WriteByte(static_cast<uint8_t>((event.block_types[0] & 0x0F) | (event.block_types[1] << 4)));
+            break;
+
+        case EventType::Input:
+            writer.WriteByte(static_cast<uint8_t>(event.action));
+            break;
+
+        case EventType::GarbageState:
+            writer.WriteSigned(event.garbage_total);
+            writer.WriteByte(event.combo_attack ? 1 : 0);
+            break;
+
+        case EventType::GarbageDrop:
+            writer.WriteByte(event.garbage_rows);
+            writer.WriteByte(event.garbage_columns);
+            break;
+
+        case EventType::Keyframe:
+            writer.WriteVarint(event.keyframe.random_draws);
+            writer.WriteByte(static_cast<uint8_t>(event.keyframe.boards.size()));
+            for (size_t i = 0; i < event.keyframe.boards.size(); ++i)
+            {
+                writer.WriteByte(event.keyframe.players[i]);
+                WriteBoard(writer, event.keyframe.boards[i]);
+            }
+            break;
+
+        case EventType::End:
+            writer.WriteByte(event.winner);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    bool ReadEvent(ByteReader& reader, Event& event, uint64_t previousTick)
+    {
+        uint8_t tag = 0;
+        uint64_t delta = 0;
+        if (!reader.ReadByte(tag) || !reader.ReadVarint(delta))
+        {
+            return false;
+        }
+
+        event.type = static_cast<EventType>(tag >> 3);
+        event.player = tag & 0x07;
+        event.tick = previousTick + delta;
+
+        switch (event.type)
+        {
+        case EventType::NextBlock:
+        {
+            uint8_t packed = 0;
+            if (!reader.ReadByte(packed))
+            {
+                return false;
+            }
+            event.block_types = { static_cast<uint8_t>(packed & 0x0F), static_cast<uint8_t>(packed >> 4) };
+            return true;
+        }
+
+        case EventType::Input:
+        {
+            uint8_t action = 0;
+            if (!reader.ReadByte(action) || action >= static_cast<uint8_t>(InputAction::Count))
+            {
+                return false;
+            }
+            event.action = static_cast<InputAction>(action);
+            return true;
+        }
+
+        case EventType::Start:
+            return true;
+
+        case EventType::GarbageState:
+        {
+            int64_t total = 0;
+            uint8_t combo = 0;
+            if (!reader.ReadSigned(total) || !reader.ReadByte(combo))
+            {
+                return false;
+            }
+            event.garbage_total = static_cast<int16_t>(total);
+            event.combo_attack = combo != 0;
+            return true;
+        }
+
+        case EventType::GarbageDrop:
+            return reader.ReadByte(event.garbage_rows) && reader.ReadByte(event.garbage_columns);
+
+        case EventType::Keyframe:
+        {
+            uint8_t boardCount = 0;
+            if (!reader.ReadVarint(event.keyframe.random_draws) || !reader.ReadByte(boardCount) || boardCount > MAX_PLAYERS)
+            {
+                return false;
+            }
+
+            event.keyframe.tick = event.tick;
+            event.keyframe.players.resize(boardCount);
+            event.keyframe.boards.resize(boardCount);
+
+            for (size_t i = 0; i < boardCount; ++i)
+            {
+                if (!reader.ReadByte(event.keyframe.players[i]) || !ReadBoard(reader, event.keyframe.boards[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        case EventType::End:
+            return reader.ReadByte(event.winner);
+
+        default:
+            return false;
+        }
+    }
+
+    void WriteIndex(ByteWriter& writer, std::span<const KeyframeIndexEntry> index, uint32_t indexOffset)
+    {
+        writer.WriteVarint(index.size());
+
+        KeyframeIndexEntry previous;
+        for (const auto& entry : index)
+        {
+            writer.WriteVarint(entry.tick - previous.tick);
+            writer.WriteVarint(entry.offset - previous.offset);
+            previous = entry;
+        }
+
+        writer.WriteFixed32(indexOffset);
+        writer.WriteFixed32(INDEX_MAGIC);
+    }
+
+    bool ReadIndex(std::span<const uint8_t> file, std::vector<KeyframeIndexEntry>& index, size_t& indexOffset)
+    {
+        if (file.size() < FOOTER_SIZE)
+        {
+            return false;
+        }
+
+        ByteReader footer(file, file.size() - FOOTER_SIZE);
+        uint32_t offset = 0, magic = 0;
+        if (!footer.ReadFixed32(offset) || !footer.ReadFixed32(magic) || magic != INDEX_MAGIC ||
+            offset > file.size() - FOOTER_SIZE)
+        {
+            return false;
+        }
+
+        ByteReader reader(file.first(file.size() - FOOTER_SIZE), offset);
+        uint64_t count = 0;
+        if (!reader.ReadVarint(count) || count > file.size())
+        {
+            return false;
+        }
+
+        index.clear();
+        index.reserve(static_cast<size_t>(count));
+
+        KeyframeIndexEntry entry;
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            uint64_t tickDelta = 0, offsetDelta = 0;
+            if (!reader.ReadVarint(tickDelta) || !reader.ReadVarint(offsetDelta))
+            {
+                return false;
+            }
+
+            entry.tick += tickDelta;
+            entry.offset += offsetDelta;
+            index.push_back(entry);
+        }
+
+        indexOffset = offset;
+        return true;
+    }
+
+    std::string ToBoardText(const BoardSnapshot& board)
+    {
+        std::string text;
+        text.reserve(BOARD_CELLS + Constants::Board::BOARD_Y_COUNT);
+
+        for (int y = Constants::Board::BOARD_Y_COUNT - 1; y >= 0; --y)
+        {
+            for (int x = 0; x < Constants::Board::BOARD_X_COUNT; ++x)
+            {
+                text.push_back(static_cast<char>('0' + board.cells[y * Constants::Board::BOARD_X_COUNT + x]));
+            }
+            text.push_back('\n');
+        }
+
+        return text;
+    }
+}
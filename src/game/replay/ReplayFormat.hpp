@@ -0,0 +1,175 @@
+#pragma once
+/*
+*
+* : ġ ÷   (.ppr)
+* 1. : FILE_MAGIC, FILE_VERSION, ġ  õ,  ð,  ֱ, ÷̾  ( varint)
+* 2. ̺Ʈ: ±( << 3 | ÷̾ ε) +  ̺Ʈ ƽ (varint) +  
+*    ƽ ġ   Ϸ GameState::Update Ƚ̸,  ƽ ̺Ʈ  ƽ Update  
+* 3. KEYFRAME_INTERVAL ƽ  (ĭ 4Ʈ), ,    ,   Ƚ Ű 
+* 4.  : Ű ε(ƽ/ ) + ε  ġ(4Ʈ) + INDEX_MAGIC   ƽ Ž  Ű ϳ ڵ
+*
+*/
+
+#include "../../core/common/constants/Constants.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Replay
+{
+    inline constexpr uint32_t FILE_MAGIC = 0x50525050;    // "PPRP"
+    inline constexpr uint32_t INDEX_MAGIC = 0x58525050;   // "PPRX"
+    inline constexpr uint8_t FILE_VERSION = 2;   // 2:    (MatchRandom::GetPiece) 
+    inline constexpr const char* FILE_EXTENSION = ".ppr";
+
+    inline constexpr uint64_t KEYFRAME_INTERVAL = Constants::Time::LOGIC_RATE * 5;
+    inline constexpr size_t MAX_PLAYERS = 8;
+    inline constexpr uint8_t NO_WINNER = 0xFF;
+
+    inline constexpr size_t BOARD_CELLS = Constants::Board::BOARD_X_COUNT * Constants::Board::BOARD_Y_COUNT;
+    inline constexpr size_t PACKED_BOARD_SIZE = (BOARD_CELLS + 1) / 2;
+
+    enum class EventType : uint8_t
+    {
+        NextBlock,      //    (  )
+        Input,          //   Է
+        Start,          // ù   (Ʈũ   Ŷ Ǵ   Ÿ̸)
+        GarbageState,   // ܺ(Ŷ/ Ű) ٲ       
+        GarbageDrop,    //    ( ,    Ʈũ)
+        Keyframe,
+        End,
+        Count
+    };
+
+    enum class InputAction : uint8_t
+    {
+        MoveLeft,
+        MoveRight,
+        SoftDrop,
+        Rotate,
+        Count
+    };
+
+    struct PlayerInfo
+    {
+        uint8_t id{ 0 };
+        uint16_t character_id{ 0 };
+    };
+
+    struct Header
+    {
+        uint32_t seed{ 0 };
+        uint64_t recorded_at{ 0 };  // Unix ð()
+        uint32_t logic_rate{ Constants::Time::LOGIC_RATE };
+        std::vector<PlayerInfo> players;
+    };
+
+    struct BoardSnapshot
+    {
+        std::array<uint8_t, BOARD_CELLS> cells{};   // [y * BOARD_X_COUNT + x], y = 0  ٴ,  BlockType
+        uint32_t score{ 0 };
+        int16_t pending_garbage{ 0 };
+        uint8_t phase{ 0 };
+
+        bool operator==(const BoardSnapshot&) const = default;
+    };
+
+    struct Keyframe
+    {
+        uint64_t tick{ 0 };
+        uint64_t random_draws{ 0 };
+        std::vector<uint8_t> players;           // boards[i]  ÷̾ ε
+        std::vector<BoardSnapshot> boards;
+    };
+
+    struct KeyframeIndexEntry
+    {
+        uint64_t tick{ 0 };
+        uint64_t offset{ 0 };   // ̺Ʈ   
+    };
+
+    struct Event
+    {
+        EventType type{ EventType::End };
+        uint8_t player{ 0 };
+        uint64_t tick{ 0 };
+
+        InputAction action{ InputAction::MoveLeft };
+        std::array<uint8_t, 2> block_types{};
+        int16_t garbage_total{ 0 };
+        bool combo_attack{ false };
+        uint8_t garbage_rows{ 0 };
+        uint8_t garbage_columns{ 0 };
+        uint8_t winner{ NO_WINNER };
+        Keyframe keyframe;
+    };
+
+    class ByteWriter
+    {
+    public:
+
+        void WriteByte(uint8_t value) { bytes_.push_back(value); }
+        void WriteVarint(uint64_t value);
+        void WriteSigned(int64_t value);
+        void WriteFixed32(uint32_t value);
+        void WriteBytes(std::span<const uint8_t> bytes) { bytes_.insert(bytes_.end(), bytes.begin(), bytes.end()); }
+
+        [[nodiscard]] size_t GetSize() const { return bytes_.size(); }
+        [[nodiscard]] const std::vector<uint8_t>& GetBytes() const { return bytes_; }
+        void Clear() { bytes_.clear(); }
+
+    private:
+
+        std::vector<uint8_t> bytes_;
+    };
+
+    //  ų varint  ߸Ǹ  б  
+    class ByteReader
+    {
+    public:
+
+        ByteReader() = default;
+        explicit ByteReader(std::span<const uint8_t> bytes, size_t position = 0) : bytes_(bytes), position_(position) {}
+
+        bool ReadByte(uint8_t& value);
+        bool ReadVarint(uint64_t& value);
+        bool ReadSigned(int64_t& value);
+        bool ReadFixed32(uint32_t& value);
+        bool ReadBytes(std::span<uint8_t> out);
+
+        [[nodiscard]] size_t GetPosition() const { return position_; }
+        [[nodiscard]] bool IsEnd() const { return position_ >= bytes_.size(); }
+        [[nodiscard]] bool IsValid() const { return is_valid_; }
+
+    private:
+
+        std::span<const uint8_t> bytes_;
+        size_t position_{ 0 };
+        bool is_valid_{ true };
+    };
+
+    [[nodiscard]] constexpr uint8_t MakeTag(EventType type, uint8_t player)
+    {
+        return static_cast<uint8_t>((static_cast<uint8_t>(type) << 3) | (player & 0x07));
+    }
+
+    void WriteHeader(ByteWriter& writer, const Header& header);
+    [[nodiscard]] bool ReadHeader(ByteReader& reader, Header& header);
+
+    // ĭ 4Ʈ   ĭ (PACKED_BOARD_SIZE Ʈ)
+    void WriteCells(ByteWriter& writer, const std::array<uint8_t, BOARD_CELLS>& cells);
+    [[nodiscard]] bool ReadCells(ByteReader& reader, std::array<uint8_t, BOARD_CELLS>& cells);
+
+    // previousTick   ̺Ʈ ƽ (ù ̺Ʈ 0)
+    void WriteEvent(ByteWriter& writer, const Event& event, uint64_t previousTick);
+    [[nodiscard]] bool ReadEvent(ByteReader& reader, Event& event, uint64_t previousTick);
+
+    void WriteIndex(ByteWriter& writer, std::span<const KeyframeIndexEntry> index, uint32_t indexOffset);
+    [[nodiscard]] bool ReadIndex(std::span<const uint8_t> file, std::vector<KeyframeIndexEntry>& index, size_t& indexOffset);
+
+    // puyo.txt  ( ٿ  ,  , 0  ĭ)
+    [[nodiscard]] std::string ToBoardText(const BoardSnapshot& board);
+}
@@ -28,12 +28,20 @@
 #include "../../network/player/Player.hpp"
 
 #include "../../utils/Logger.hpp"
+#include "../../resource/AssetPack.hpp"
+#include "../../utils/FrameJobSystem.hpp"
+#include "../../utils/FrameProfiler.hpp"
+#include "../replay/MatchRecorder.hpp"
+#include "../system/MatchRandom.hpp"
+#include "../system/ScoreTable.hpp"
+#include "../system/GarbageEngine.hpp"
 
 #include <stdexcept>
 #include <algorithm>
 #include <format>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 BasePlayer::BasePlayer()
 {
@@ -124,6 +132,8 @@ void BasePlayer::Release()
 
 void BasePlayer::Update(float deltaTime)
 {
+    PROFILE_SCOPE(ProfileZone::PlayerUpdate);
+
     state_info_.play_time += deltaTime;
 
     for (auto* obj : draw_objects_)
@@ -142,9 +152,12 @@ void BasePlayer::Update(float deltaTime)
         }
     }
 
-    UpdateBullets(deltaTime);
+    RemoveDeadBullets();
 
-    GAME_APP.GetParticleManager().Update(deltaTime);
+    FRAME_JOBS.Submit("Bullets", [this, deltaTime]()
+        {
+            UpdateBullets(deltaTime);
+        });
 }
 
 void BasePlayer::Render()
@@ -173,16 +186,20 @@ bool BasePlayer::InitializeGameBoard(float posX, float posY)
         game_board_ = std::make_unique<GameBoard>();
     }
 
-    if (!game_board_->Initialize(posX, posY, block_list_, player_id_))
+    // Reset 에서 보드를 Release 했으므로 아틀라스를 다시 연결 (Initialize 가 보드 전용 렌더 타겟을 만들지 않도록 먼저)
+    game_board_->SetSharedTarget(board_atlas_, board_atlas_cell_);
+
+    if (!game_board_->Initialize(posX, posY, block_list_, player_id_, board_slot_.scale))
     {
-        LOGGER.Error("Failed to initialize game board for player {}", player_id_);
+        LOG_GAMEPLAY(Error, "Failed to initialize game board for player {}", player_id_);
         return false;
     }
 
-    auto texture = ImageTexture::Create("PUYO/puyo_beta.png");
+    static const ResourceHandle blockTexture = ImageTexture::Intern("PUYO/puyo_beta.png");
+    auto texture = ImageTexture::Create(blockTexture);
     if (!texture)
     {
-        LOGGER.Error("Failed to load block texture");
+        LOG_GAMEPLAY(Error, "Failed to load block texture");
         return false;
     }
 
@@ -193,21 +210,37 @@ bool BasePlayer::InitializeGameBoard(float posX, float posY)
     return true;
 }
 
+void BasePlayer::SetBoardAtlas(SDL_Texture* atlas, const SDL_FRect& cell)
+{
+    board_atlas_ = atlas;
+    board_atlas_cell_ = cell;
+
+    if (game_board_)
+    {
+        game_board_->SetSharedTarget(atlas, cell);
+    }
+}
+
 bool BasePlayer::InitializeViews()
 {
     interrupt_view_ = std::make_shared<InterruptBlockView>();    
     interrupt_view_->Initialize();
 
-    float boardPosX = (player_id_ == GAME_APP.GetPlayerManager().GetMyPlayer()->GetId()) ?
-        Constants::Board::POSITION_X : Constants::Board::PLAYER_POSITION_X;
-    
-    interrupt_view_->SetPosition(boardPosX, 0);
+    // 축소 보드는 방해 블록 표시를 보드 위쪽에 겹쳐 그린다
+    interrupt_view_->SetPosition(board_slot_.x, board_slot_.IsCompact() ? board_slot_.y : 0);
+    interrupt_view_->SetDrawScale(board_slot_.scale);
     draw_objects_.push_back(interrupt_view_.get());
 
     combo_view_ = std::make_shared<ComboView>();
     combo_view_->Initialize();
     draw_objects_.push_back(combo_view_.get());    
 
+    if (board_slot_.IsCompact())
+    {
+        result_view_.reset();
+        return true;
+    }
+
     result_view_ = std::make_shared<ResultView>();
     result_view_->Initialize();
     draw_objects_.push_back(result_view_.get());
@@ -291,39 +324,40 @@ void BasePlayer::UpdateLinkState(Block* block)
 
 void BasePlayer::UpdateBullets(float delta_time)
 {
-    auto it = bullet_list_.begin();
-    while (it != bullet_list_.end())
+    for (auto& bullet : bullet_list_)
     {
-        if (auto& bullet = *it)
+        if (bullet)
         {
             bullet->Update(delta_time);
+        }
+    }
+}
 
-            if (!bullet->IsAlive())
-            {
-                bullet->Release();
-                it = bullet_list_.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+void BasePlayer::RemoveDeadBullets()
+{
+    // 텍스처 해제 등 SDL 호출이 따르므로 메인 스레드에서만 정리
+    auto it = bullet_list_.begin();
+    while (it != bullet_list_.end())
+    {
+        if (*it && (*it)->IsAlive())
+        {
+            ++it;
+            continue;
         }
-        else
+
+        if (*it)
         {
-            it = bullet_list_.erase(it);
+            (*it)->Release();
         }
+        it = bullet_list_.erase(it);
     }
 }
 
-void BasePlayer::CreateBlockClearEffect(const std::shared_ptr<Block>& block)
+void BasePlayer::CreateBlockClearEffect(const Block& block)
 {
     //LOGGER.Info("BasePlayer::CreateBlockClearEffect player_id_ = {}", player_id_);
 
-    auto particle_container = std::make_unique<ExplosionContainer>();
-    particle_container->SetBlockType(block->GetBlockType());
-    particle_container->SetPlayerID(player_id_);
-
-    GAME_APP.GetParticleManager().AddParticleContainer(std::move(particle_container), block->GetPosition());
+    GAME_APP.GetParticleManager().SpawnExplosion(block.GetPosition(), block.GetBlockType(), player_id_);
 }
 
 void BasePlayer::RemoveBlock(Block* block, const SDL_Point& pos_idx)
@@ -385,64 +419,22 @@ void BasePlayer::UpdateBlockLinks()
 
 int16_t BasePlayer::GetComboConstant(uint8_t combo_count) const
 {
-    if (combo_count <= 1)
-    {
-        return 0;
-    }
-
-    if (combo_count <= 4)
-    {
-        return static_cast<int16_t>(std::pow(2, combo_count + 1));
-    }
-
-    if (combo_count <= Constants::Game::MAX_COMBO)
-    {
-        return 32 * (combo_count - 3);
-    }
-
-    return 0;
+    return ScoreTable::GetComboConstant(combo_count);
 }
 
 uint8_t BasePlayer::GetLinkBonus(size_t link_count) const
 {
-    static const std::array<uint8_t, 8> LINK_BONUSES = { 0, 0, 0, 0, 2, 3, 4, 5 };
-
-    if (link_count <= 4)
-    {
-        return 0;
-    }
-    else if (link_count <= 10)
-    {
-        return LINK_BONUSES[link_count - 4];
-    }
-    else
-    {
-        return Constants::Game::Score::MAX_LINK_BONUS;
-    }
+    return ScoreTable::GetLinkBonus(link_count);
 }
 
 uint8_t BasePlayer::GetTypeBonus(size_t count) const
 {
-    static const std::array<uint8_t, 6> TYPE_BONUSES =
-    {
-        0, 0, 3, 6, 12, Constants::Game::Score::MAX_TYPE_BONUS
-    };
-    return count < TYPE_BONUSES.size() ? TYPE_BONUSES[count] : TYPE_BONUSES.back();
+    return ScoreTable::GetTypeBonus(count);
 }
 
 uint8_t BasePlayer::GetMargin() const
 {
-    const float play_time = state_info_.play_time;
-
-    for (const auto& margin : Constants::Game::SCORE_MARGINS)
-    {
-        if (play_time <= margin.time)
-        {
-            return margin.margin;
-        }
-    }
-
-    return Constants::Game::SCORE_MARGINS[std::size(Constants::Game::SCORE_MARGINS) - 1].margin;
+    return Garbage::GetMargin(state_info_.play_time);
 }
 
 void BasePlayer::LoseGame(bool isWin)
@@ -457,8 +449,7 @@ void BasePlayer::LoseGame(bool isWin)
     
     if (result_view_)
     {
-        float result_x = (player_id_ == GAME_APP.GetPlayerManager().GetMyPlayer()->GetId()) ?
-            Constants::Board::POSITION_X + 20 : Constants::Board::PLAYER_POSITION_X + 20;
+        float result_x = board_slot_.x + 20;
         float result_y = 100;
         result_view_->UpdateResult(result_x, result_y, isWin);
     }
@@ -518,18 +509,32 @@ void BasePlayer::CreateBlocksFromFile()
     std::string currentPath = std::filesystem::current_path().string();
     std::cout << "���� �۾� ���丮: " << currentPath << std::endl;
 
-    std::ifstream file("./bin/puyo.txt");
-    if (!file)
+    std::string text;
+    if (!ASSET_PACK.ReadText(AssetPack::BOARD_FILE, text))
     {
         throw std::runtime_error("Failed to open puyo.txt");
     }
 
-    auto texture = ImageTexture::Create("PUYO/puyo_beta.png");
+    CreateBlocksFromBoardText(text);
+}
+
+// 블록 텍스처를 읽어 보드 텍스트로 블록 생성 (디버그 보드 파일, 퍼즐 모드)
+void BasePlayer::CreateBlocksFromBoardText(const std::string& text)
+{
+    static const ResourceHandle blockTexture = ImageTexture::Intern("PUYO/puyo_beta.png");
+    auto texture = ImageTexture::Create(blockTexture);
     if (!texture)
     {
         throw std::runtime_error("Failed to load block texture");
     }
 
+    CreateBlocksFromText(text, texture);
+}
+
+// puyo.txt 형식(한 줄에 한 행, 위쪽 행부터, 0 은 빈칸)의 보드를 생성 (텍스처 없이 로직만 검사할 때는 nullptr)
+void BasePlayer::CreateBlocksFromText(const std::string& text, const std::shared_ptr<ImageTexture>& texture)
+{
+    std::istringstream file(text);
     std::string line;
     for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; y++)
     {
@@ -694,15 +699,17 @@ void BasePlayer::GenerateIceBlocks()
         return;
     }
 
-    auto texture = ImageTexture::Create("PUYO/puyo_beta.png");
+    static const ResourceHandle blockTexture = ImageTexture::Intern("PUYO/puyo_beta.png");
+    auto texture = ImageTexture::Create(blockTexture);
     if (!texture) {
-        LOGGER.Error("Failed to get ice block texture");
+        LOG_GAMEPLAY(Error, "Failed to get ice block texture");
         return;
     }
 
     const auto playerID = player_id_;
 
-    if (score_info_.total_interrupt_block_count > 30) 
+    // 한 번에 떨어뜨릴 수 있는 양을 넘으면 최대 행 수만 떨어뜨리고 나머지는 대기
+    if (Garbage::PlanDrop(score_info_.total_interrupt_block_count).remaining > 0) 
     {
         GenerateLargeIceBlockGroup(texture, playerID);
     }
@@ -724,15 +731,18 @@ void BasePlayer::GenerateIceBlocks()
 
 void BasePlayer::GenerateLargeIceBlockGroup(const std::shared_ptr<ImageTexture>& texture, uint8_t playerID) 
 {
-    score_info_.total_interrupt_block_count -= 30;    
+    const Garbage::Drop drop = Garbage::PlanDrop(score_info_.total_interrupt_block_count);
+    score_info_.total_interrupt_block_count = drop.remaining;
 
     if (NETWORK.IsRunning())
     {
         std::span<const uint8_t> empty_span;
-        NETWORK.AddInterruptBlock(5, 0, empty_span);
+        NETWORK.AddInterruptBlock(static_cast<uint8_t>(drop.rows), 0, empty_span);
     }        
 
-    for (int y = 0; y < 5; y++) 
+    MATCH_RECORDER.RecordGarbageDrop(player_id_, static_cast<uint8_t>(drop.rows), 0);
+
+    for (int y = 0; y < drop.rows; y++) 
     {
         for (int x = 0; x < Constants::Board::BOARD_X_COUNT; x++) 
         {
@@ -746,8 +756,9 @@ void BasePlayer::GenerateLargeIceBlockGroup(const std::shared_ptr<ImageTexture>&
 void BasePlayer::GenerateSmallIceBlockGroup(const std::shared_ptr<ImageTexture>& texture, uint8_t playerID,
     const std::span<const uint8_t>& xIdxList) 
 {
-    const auto yCnt = score_info_.total_interrupt_block_count / Constants::Board::BOARD_X_COUNT;
-    const auto xCnt = score_info_.total_interrupt_block_count % Constants::Board::BOARD_X_COUNT;
+    const Garbage::Drop drop = Garbage::PlanDrop(score_info_.total_interrupt_block_count);
+    const auto yCnt = drop.rows;
+    const auto xCnt = drop.columns;
 
     for (int y = 0; y < yCnt; y++) 
     {
@@ -773,33 +784,46 @@ void BasePlayer::GenerateSmallIceBlockGroup(const std::shared_ptr<ImageTexture>&
         }
         else 
         {
-            // 랜덤 인덱스 생성
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_int_distribution<> dist(0, Constants::Board::BOARD_X_COUNT - 1);
-
+            // 랜덤 인덱스 생성 (리플레이에서 같은 열이 나오도록 매치 난수 사용)
             while (positions.size() < xCnt) 
             {
-                positions.insert(dist(gen));
+                positions.insert(MATCH_RANDOM.NextInt(0, Constants::Board::BOARD_X_COUNT - 1));
             }
         }
 
+        std::vector<uint8_t> xIndices;
+        uint8_t columnMask = 0;
+
         for (int pos : positions) 
         {
             auto iceBlock = std::make_shared<IceBlock>();
             InitializeIceBlock(iceBlock.get(), texture, pos, yCnt, playerID);
             block_list_.push_back(iceBlock);
+
+            xIndices.push_back(static_cast<uint8_t>(pos));
+            columnMask |= static_cast<uint8_t>(1u << pos);
         }
 
+        // 상대 화면에도 같은 열에 놓이도록 실제로 정한 위치를 전송
+        if (NETWORK.IsRunning())
+        {
+            NETWORK.AddInterruptBlock(yCnt, xCnt, xIndices);
+        }
 
+        MATCH_RECORDER.RecordGarbageDrop(player_id_, static_cast<uint8_t>(yCnt), columnMask);
+    }
+    else if (yCnt > 0)
+    {
+        // 가득 찬 행만 떨어지는 경우도 상대 화면에 같은 행 수가 놓이도록 전송
         if (NETWORK.IsRunning())
         {
-            NETWORK.AddInterruptBlock(yCnt, xCnt, xIdxList);
+            NETWORK.AddInterruptBlock(static_cast<uint8_t>(yCnt), 0, {});
         }
 
+        MATCH_RECORDER.RecordGarbageDrop(player_id_, static_cast<uint8_t>(yCnt), 0);
     }
 
-    score_info_.total_interrupt_block_count = 0;
+    score_info_.total_interrupt_block_count = drop.remaining;
 }
 
 void BasePlayer::InitializeIceBlock(IceBlock* block, const std::shared_ptr<ImageTexture>& texture, int x, int y, uint8_t playerID) 
@@ -938,7 +962,7 @@ void BasePlayer::HandleClearedBlockGroup(std::list<BlockVector>::iterator& group
         SDL_FPoint pos{ block->GetX(), block->GetY() };
         SDL_Point idx{ block->GetPosIdx_X(), block->GetPosIdx_Y() };
 
-        CreateBlockClearEffect(std::shared_ptr<Block>(block, [](Block*) {}));
+        CreateBlockClearEffect(*block);
 
         board_blocks_[idx.y][idx.x] = nullptr;
 
@@ -988,7 +1012,7 @@ void BasePlayer::UpdateAfterBlocksCleared()
         {
             SetGamePhase(GamePhase::Playing);
 
-            if (score_info_.total_interrupt_block_count > 0 && !state_info_.is_combo_attack && !state_info_.is_defending)
+            if (Garbage::ShouldDrop(score_info_.total_interrupt_block_count, state_info_.is_combo_attack, state_info_.is_defending))
             {
                 GenerateIceBlocks();
             }
@@ -11,11 +11,13 @@
 #include <memory>
 #include <array>
 #include <span>
+#include <string>
 #include "../RenderableObject.hpp"
 #include "../../core/common/constants/Constants.hpp"
 #include "../../core/common/types/GameTypes.hpp"
 #include "../../states/GameState.hpp"
 #include "../event/PlayerEvent.hpp"
+#include "BoardLayout.hpp"
 
 class Block;
 class GameBackground;
@@ -49,12 +51,11 @@ public:
     void ReleaseContainer(Container& container);
 
     // ʱȭ  
-    virtual bool Initialize(const std::span<const uint8_t>& blocktype1,
-        const std::span<const uint8_t>& blocktype2,
-        uint8_t playerIdx,
+    //   MATCH_RANDOM    Ƿ ġ õ带  ؾ Ѵ
+    virtual bool Initialize(uint8_t playerIdx,
         uint16_t characterIdx,
         const std::shared_ptr<GameBackground>& background) = 0;
-    virtual bool Restart(const std::span<const uint8_t>& blockType1 = {}, const std::span<const uint8_t>& blockType2 = {}) = 0;
+    virtual bool Restart() = 0;
 
     //  
     virtual void CreateNextBlock() = 0;
@@ -82,8 +83,12 @@ public:
     //  ȸ
     GamePhase GetGameState() const { return state_info_.current_phase; }
     uint8_t GetPlayerID() const { return player_id_; }
+    int16_t GetCharacterID() const { return character_id_; }
     int16_t GetTotalInterruptBlockCount() const { return score_info_.total_interrupt_block_count; }
     int16_t GetTotalEnemyInterruptBlockCount() const { return score_info_.total_enemy_interrupt_block_count; }
+    uint32_t GetTotalScore() const { return score_info_.total_score; }
+    uint8_t GetComboCount() const { return score_info_.combo_count; }
+    bool IsComboAttack() const { return state_info_.is_combo_attack; }
     std::shared_ptr<GameBoard> GetGameBoard() const { return game_board_; }
     Block* (*GetGameBlocks())[Constants::Board::BOARD_X_COUNT] { return board_blocks_; }
 
@@ -104,6 +109,15 @@ public:
     void SetBackGround(const std::shared_ptr<GameBackground>& backGround) { background_ = backGround; }
     void SetGameBoardState(BoardState bordState);
 
+    //  ȭ ġ (Initialize/Restart  ؾ Ѵ)
+    void SetBoardSlot(const BoardLayout::Slot& slot) { board_slot_ = slot; }
+    [[nodiscard]] const BoardLayout::Slot& GetBoardSlot() const { return board_slot_; }
+    [[nodiscard]] bool IsCompact() const { return board_slot_.IsCompact(); }
+
+    //  带  ׸ GameState  Ʋ󽺿   ڸ (nullptr ̸ 尡 ڱ  Ÿ )
+    void SetBoardAtlas(SDL_Texture* atlas, const SDL_FRect& cell);
+    [[nodiscard]] const SDL_FRect& GetBoardAtlasCell() const { return board_atlas_cell_; }
+
     void SetComboAttackState(bool enable) { state_info_.is_combo_attack = enable; }
     void SetTotalInterruptBlockCount(uint16_t count) 
     { 
@@ -120,7 +134,7 @@ protected:
 
     //    ޼
     void UpdateLinkState(Block* block);
-    void CreateBlockClearEffect(const std::shared_ptr<Block>& block);
+    void CreateBlockClearEffect(const Block& block);
 
     //    ޼
     void RemoveBlock(Block* block, const SDL_Point& pos_idx);
@@ -136,11 +150,14 @@ protected:
     // Ѿ  Ʈ  ޼
     virtual void CreateBullet(Block* block) = 0;
     void UpdateBullets(float delta_time);
+    void RemoveDeadBullets();
     void NotifyEvent(const std::shared_ptr<BasePlayerEvent>& event);
 
 
     //  Ϸ  
     void CreateBlocksFromFile();
+    void CreateBlocksFromBoardText(const std::string& text);
+    void CreateBlocksFromText(const std::string& text, const std::shared_ptr<ImageTexture>& texture);
 
     //   ڵ鸵 (ø ޼ )
     virtual bool FindMatchedBlocks(std::list<BlockVector>& matchedGroups);
@@ -207,6 +224,9 @@ protected:
     uint8_t player_id_{ 0 };
     int16_t character_id_{ 0 };
     bool is_game_quit_{ false };   
+    BoardLayout::Slot board_slot_{ BoardLayout::GetLocalSlot() };
+    SDL_Texture* board_atlas_{ nullptr };
+    SDL_FRect board_atlas_cell_{};
 
     //  
     GameStateInfo state_info_;
@@ -0,0 +1,82 @@
+#pragma once
+/*
+*
+* : ÷̾    ġ
+* 1.   ׻ ʿ  ũ,     ڸ(PLAYER_POSITION_X) ڷ   ġ
+* 2. 밡  ̸  1x1,   (1:1  ȭ )
+* 3. 밡  ̸   = ceil(sqrt(n)),   = ceil(n / ),   = 1 / max(, )
+* 4. ҵ(compact)    ִϸ̼ǰ  ǥø ϰ    ǥø ׸
+*
+*/
+
+#include "../../core/common/constants/Constants.hpp"
+
+#include <algorithm>
+
+namespace BoardLayout
+{
+    struct Slot
+    {
+        float x{ Constants::Board::POSITION_X };
+        float y{ Constants::Board::POSITION_Y };
+        float scale{ 1.0f };
+
+        [[nodiscard]] constexpr bool operator==(const Slot&) const = default;
+        [[nodiscard]] constexpr bool IsCompact() const { return scale < 1.0f; }
+        [[nodiscard]] constexpr float GetWidth() const { return Constants::Board::WIDTH * scale; }
+        [[nodiscard]] constexpr float GetHeight() const { return Constants::Board::HEIGHT * scale; }
+
+        //   ǥ( Ÿ ) ȭ ǥ
+        [[nodiscard]] constexpr SDL_FPoint ToScreen(float boardX, float boardY) const
+        {
+            return { x + boardX * scale, y + boardY * scale };
+        }
+    };
+
+    struct Grid
+    {
+        int columns{ 1 };
+        int rows{ 1 };
+    };
+
+    [[nodiscard]] constexpr Slot GetLocalSlot()
+    {
+        return {};
+    }
+
+    [[nodiscard]] constexpr Grid GetOpponentGrid(int opponentCount)
+    {
+        int columns = 1;
+        while (columns * columns < opponentCount)
+        {
+            ++columns;
+        }
+
+        return { columns, std::max(1, (opponentCount + columns - 1) / columns) };
+    }
+
+    // index °   ڸ (0 <= index < opponentCount)
+    [[nodiscard]] constexpr Slot GetOpponentSlot(int index, int opponentCount)
+    {
+        const Grid grid = GetOpponentGrid(opponentCount);
+        const float scale = 1.0f / static_cast<float>(std::max(grid.columns, grid.rows));
+
+        //    á  
+        const int row = index / grid.columns;
+        const int column = index % grid.columns;
+        const int rowCount = std::min(grid.columns, opponentCount - row * grid.columns);
+
+        const float cellWidth = Constants::Board::WIDTH * scale;
+        const float cellHeight = Constants::Board::HEIGHT * scale;
+        const float offsetX = (Constants::Board::WIDTH - cellWidth * rowCount) * 0.5f;
+        const float offsetY = (Constants::Board::HEIGHT - cellHeight * grid.rows) * 0.5f;
+
+        return {
+            Constants::Board::PLAYER_POSITION_X + offsetX + cellWidth * column,
+            Constants::Board::PLAYER_POSITION_Y + offsetY + cellHeight * row,
+            scale };
+    }
+
+    static_assert(GetOpponentSlot(0, 1).x == Constants::Board::PLAYER_POSITION_X && !GetOpponentSlot(0, 1).IsCompact());
+    static_assert(GetOpponentGrid(7).columns == 3 && GetOpponentGrid(7).rows == 3);
+}
@@ -0,0 +1,292 @@
+#include "FfaMatch.hpp"
+#include "GarbageEngine.hpp"
+
+#include "../../utils/Logger.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    // MATCH_RANDOM  ٸ   õ忡  
+    constexpr uint64_t TARGET_SEED_SALT = 0xFFA0'7A26'E75E'ED00ull;
+
+    struct PolicyName
+    {
+        FfaMatch::TargetPolicy policy;
+        std::string_view name;
+    };
+
+    constexpr PolicyName POLICY_NAMES[] =
+    {
+        { FfaMatch::TargetPolicy::Random, "random" },
+        { FfaMatch::TargetPolicy::Even, "even" },
+        { FfaMatch::TargetPolicy::Counter, "counter" },
+        { FfaMatch::TargetPolicy::KnockOut, "ko" }
+    };
+}
+
+FfaMatch& FfaMatch::GetInstance()
+{
+    static FfaMatch instance;
+    return instance;
+}
+
+std::optional<FfaMatch::TargetPolicy> FfaMatch::ParseCommandLine(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) != "--ffa-target" || i + 1 >= argc)
+        {
+            continue;
+        }
+
+        const std::string_view value(argv[i + 1]);
+        for (const auto& entry : POLICY_NAMES)
+        {
+            if (entry.name == value)
+            {
+                return entry.policy;
+            }
+        }
+
+        LOGGER.Warning("Unknown --ffa-target value: {}", value);
+    }
+    return std::nullopt;
+}
+
+std::string_view FfaMatch::GetPolicyName(TargetPolicy policy)
+{
+    for (const auto& entry : POLICY_NAMES)
+    {
+        if (entry.policy == policy)
+        {
+            return entry.name;
+        }
+    }
+    return "unknown";
+}
+
+void FfaMatch::Begin(uint32_t seed, std::span<const uint8_t> playerIds)
+{
+    End();
+
+    count_ = std::min(playerIds.size(), MAX_PLAYERS);
+    for (size_t i = 0; i < count_; ++i)
+    {
+        entries_[i].player_id = playerIds[i];
+        entries_[i].is_alive = true;
+    }
+
+    engine_.Seed(seed ^ TARGET_SEED_SALT);
+    is_active_ = count_ > 2;
+
+    if (is_active_)
+    {
+        LOG_GAMEPLAY(Info, "Free-for-all match with {} players, target policy {}", count_, GetPolicyName(policy_));
+    }
+}
+
+void FfaMatch::End()
+{
+    entries_ = {};
+    count_ = 0;
+    is_active_ = false;
+}
+
+std::optional<FfaMatch::Route> FfaMatch::RouteAttack(uint8_t attackerId, int16_t count)
+{
+    const int attacker = FindSlot(attackerId);
+    if (!is_active_ || attacker < 0 || count <= 0)
+    {
+        return std::nullopt;
+    }
+
+    const int target = SelectTarget(attacker);
+    if (target < 0)
+    {
+        return std::nullopt;
+    }
+
+    // ϰ  ŭ Ƿ     0
+    entries_[attacker].pending = 0;
+    entries_[attacker].combo_targets |= static_cast<uint8_t>(1u << target);
+
+    Entry& entry = entries_[target];
+    entry.pending = static_cast<int16_t>(std::min<int>(entry.pending + count, std::numeric_limits<int16_t>::max()));
+    entry.last_attacker = static_cast<uint8_t>(attacker + 1);
+
+    return Route{ entry.player_id, entry.pending };
+}
+
+int16_t FfaMatch::Defend(uint8_t playerId, int16_t count)
+{
+    const int slot = FindSlot(playerId);
+    if (slot < 0)
+    {
+        return 0;
+    }
+
+    Entry& entry = entries_[slot];
+    entry.pending = Garbage::Cancel(entry.pending, count).pending;
+    return entry.pending;
+}
+
+int16_t FfaMatch::Drop(uint8_t playerId, int16_t count)
+{
+    const int slot = FindSlot(playerId);
+    if (slot < 0)
+    {
+        return 0;
+    }
+
+    Entry& entry = entries_[slot];
+    entry.pending = static_cast<int16_t>(std::max(entry.pending - count, 0));
+    return entry.pending;
+}
+
+size_t FfaMatch::TakeComboTargets(uint8_t attackerId, std::array<uint8_t, MAX_PLAYERS>& targets)
+{
+    const int attacker = FindSlot(attackerId);
+    if (attacker < 0)
+    {
+        return 0;
+    }
+
+    size_t count = 0;
+    const uint8_t mask = entries_[attacker].combo_targets;
+    for (size_t i = 0; i < count_; ++i)
+    {
+        if (mask & (1u << i))
+        {
+            targets[count++] = entries_[i].player_id;
+        }
+    }
+
+    entries_[attacker].combo_targets = 0;
+    return count;
+}
+
+std::optional<uint8_t> FfaMatch::Eliminate(uint8_t playerId)
+{
+    const int slot = FindSlot(playerId);
+    if (!is_active_ || slot < 0 || !entries_[slot].is_alive)
+    {
+        return std::nullopt;
+    }
+
+    entries_[slot].is_alive = false;
+
+    int survivor = -1;
+    for (size_t i = 0; i < count_; ++i)
+    {
+        if (entries_[i].is_alive)
+        {
+            if (survivor >= 0)
+            {
+                return std::nullopt;
+            }
+            survivor = static_cast<int>(i);
+        }
+    }
+
+    if (survivor < 0)
+    {
+        return std::nullopt;
+    }
+    return entries_[survivor].player_id;
+}
+
+bool FfaMatch::ShouldRelayPositionSync(uint8_t playerId)
+{
+    const int slot = FindSlot(playerId);
+    if (!is_active_ || slot < 0)
+    {
+        return true;
+    }
+
+    return entries_[slot].sync_count++ % POSITION_SYNC_INTERVAL == 0;
+}
+
+int16_t FfaMatch::GetPending(uint8_t playerId) const
+{
+    const int slot = FindSlot(playerId);
+    return slot < 0 ? 0 : entries_[slot].pending;
+}
+
+int FfaMatch::FindSlot(uint8_t playerId) const
+{
+    for (size_t i = 0; i < count_; ++i)
+    {
+        if (entries_[i].player_id == playerId)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int FfaMatch::SelectTarget(int attackerSlot)
+{
+    Entry& attacker = entries_[attackerSlot];
+
+    switch (policy_)
+    {
+    case TargetPolicy::Even:
+        for (size_t step = 1; step <= count_; ++step)
+        {
+            const size_t slot = (attacker.even_cursor + step) % count_;
+            if (static_cast<int>(slot) != attackerSlot && entries_[slot].is_alive)
+            {
+                attacker.even_cursor = static_cast<uint8_t>(slot);
+                return static_cast<int>(slot);
+            }
+        }
+        return -1;
+
+    case TargetPolicy::Counter:
+        if (attacker.last_attacker > 0 && entries_[attacker.last_attacker - 1].is_alive)
+        {
+            return attacker.last_attacker - 1;
+        }
+        return SelectRandom(attackerSlot);
+
+    case TargetPolicy::KnockOut:
+    {
+        int best = -1;
+        for (size_t i = 0; i < count_; ++i)
+        {
+            if (static_cast<int>(i) != attackerSlot && entries_[i].is_alive &&
+                (best < 0 || entries_[i].pending > entries_[best].pending))
+            {
+                best = static_cast<int>(i);
+            }
+        }
+        return best;
+    }
+
+    case TargetPolicy::Random:
+    default:
+        return SelectRandom(attackerSlot);
+    }
+}
+
+int FfaMatch::SelectRandom(int attackerSlot)
+{
+    std::array<int, MAX_PLAYERS> candidates{};
+    size_t candidateCount = 0;
+
+    for (size_t i = 0; i < count_; ++i)
+    {
+        if (static_cast<int>(i) != attackerSlot && entries_[i].is_alive)
+        {
+            candidates[candidateCount++] = static_cast<int>(i);
+        }
+    }
+
+    if (candidateCount == 0)
+    {
+        return -1;
+    }
+    return candidates[engine_() % candidateCount];
+}
@@ -0,0 +1,111 @@
+#pragma once
+/*
+*
+* : 3 ̻  (FFA)    ( )
+* 1. 1:1  ó  LocalPlayer    Բ ϰ, 3 ̸̻  Ŭ ں    
+* 2. ڰ ϰ     å(--ffa-target)    ,
+*     TargetInterruptPacket ϳ      ڿ ˸
+* 3. Ⱑ   StopComboAttack   ⿡ ݹ ڿԸ 
+* 4.  θ ̴   ġ ȭ POSITION_SYNC_INTERVAL    ߰
+* 5.    ġ õ忡  MATCH_RANDOM       
+* 6.   
+*
+*/
+
+#include "MatchRandom.hpp"
+#include "../../core/common/constants/Constants.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+class FfaMatch
+{
+public:
+
+    static constexpr size_t MAX_PLAYERS = Constants::Network::MAX_CLIENT;
+    static constexpr uint32_t POSITION_SYNC_INTERVAL = 4;
+
+    enum class TargetPolicy : uint8_t
+    {
+        Random,     //  ִ   
+        Even,       // ڸ 븦 ʷ ư
+        Counter,    //     ( )
+        KnockOut    //      
+    };
+
+    struct Route
+    {
+        uint8_t target_id{ 0 };
+        int16_t target_pending{ 0 };
+    };
+
+    static FfaMatch& GetInstance();
+
+    FfaMatch(const FfaMatch&) = delete;
+    FfaMatch& operator=(const FfaMatch&) = delete;
+    FfaMatch(FfaMatch&&) = delete;
+    FfaMatch& operator=(FfaMatch&&) = delete;
+
+    // --ffa-target <random|even|counter|ko>
+    [[nodiscard]] static std::optional<TargetPolicy> ParseCommandLine(int argc, char* argv[]);
+    [[nodiscard]] static std::string_view GetPolicyName(TargetPolicy policy);
+
+    void SetPolicy(TargetPolicy policy) { policy_ = policy; }
+    [[nodiscard]] TargetPolicy GetPolicy() const { return policy_; }
+
+    // ġ /    ȣ (2 ̸ Ȱ)
+    void Begin(uint32_t seed, std::span<const uint8_t> playerIds);
+    void End();
+    [[nodiscard]] bool IsActive() const { return is_active_; }
+
+    // ڰ     ϰ    Ѵ ( ִ 밡  nullopt)
+    [[nodiscard]] std::optional<Route> RouteAttack(uint8_t attackerId, int16_t count);
+
+    // () / Ϸ پ   
+    int16_t Defend(uint8_t playerId, int16_t count);
+    int16_t Drop(uint8_t playerId, int16_t count);
+
+    //  ̹ ⿡ ݹ  ID  targets ʿ ä  ȯ (ȣ  )
+    size_t TakeComboTargets(uint8_t attackerId, std::array<uint8_t, MAX_PLAYERS>& targets);
+
+    // Ż ó,      ID
+    [[nodiscard]] std::optional<uint8_t> Eliminate(uint8_t playerId);
+
+    [[nodiscard]] bool ShouldRelayPositionSync(uint8_t playerId);
+    [[nodiscard]] int16_t GetPending(uint8_t playerId) const;
+
+private:
+
+    FfaMatch() = default;
+    ~FfaMatch() = default;
+
+    struct Entry
+    {
+        uint8_t player_id{ 0 };
+        uint8_t last_attacker{ 0 };     //  ȣ + 1 (0  )
+        uint8_t combo_targets{ 0 };     // ̹ ⿡   Ʈ ũ
+        uint8_t even_cursor{ 0 };
+        int16_t pending{ 0 };
+        uint32_t sync_count{ 0 };
+        bool is_alive{ false };
+    };
+
+    static_assert(MAX_PLAYERS <= 8, "combo_targets is an 8-bit slot mask");
+
+    [[nodiscard]] int FindSlot(uint8_t playerId) const;
+    [[nodiscard]] int SelectTarget(int attackerSlot);
+    [[nodiscard]] int SelectRandom(int attackerSlot);
+
+private:
+
+    std::array<Entry, MAX_PLAYERS> entries_{};
+    size_t count_{ 0 };
+    TargetPolicy policy_{ TargetPolicy::Random };
+    MatchEngine engine_;
+    bool is_active_{ false };
+};
+
+#define FFA_MATCH FfaMatch::GetInstance()
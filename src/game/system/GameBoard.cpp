@@ -9,6 +9,7 @@
 #include "../../core/manager/ParticleManager.hpp"
 
 #include "../../texture/ImageTexture.hpp"
+#include "../../texture/RenderRecorder.hpp"
 #include "../../states/GameState.hpp"
 #include "../../network/NetworkController.hpp"
 
@@ -25,12 +26,13 @@ GameBoard::~GameBoard()
     Release();
 }
 
-bool GameBoard::Initialize(float xPos, float yPos, std::list<std::shared_ptr<Block>>& blockList, uint8_t playerId)
+bool GameBoard::Initialize(float xPos, float yPos, std::list<std::shared_ptr<Block>>& blockList, uint8_t playerId, float scale)
 {
     try
     {
         block_list_ = &blockList;
         player_id_ = playerId;
+        scale_ = scale;
 
         source_block_ = ImageTexture::Create("FIELD/BG_00.png");
         if (!source_block_)
@@ -52,7 +54,7 @@ bool GameBoard::Initialize(float xPos, float yPos, std::list<std::shared_ptr<Blo
 
 void GameBoard::InitializeRenderTarget() 
 {
-    if (!target_render_texture_) 
+    if (!target_render_texture_ && !shared_target_) 
     {
         target_render_texture_ = SDL_CreateTexture(
             GAME_APP.GetRenderer(),
@@ -79,8 +81,8 @@ void GameBoard::InitializePositions(float xPos, float yPos)
     target_render_rect_ = {
         xPos,
         yPos,
-        Constants::Board::WIDTH,
-        Constants::Board::HEIGHT
+        Constants::Board::WIDTH * scale_,
+        Constants::Board::HEIGHT * scale_
     };
 
     //  ҽ rect ʱȭ
@@ -95,6 +97,19 @@ void GameBoard::InitializePositions(float xPos, float yPos)
     SetScale(Constants::Board::WIDTH, Constants::Board::HEIGHT);
 }
 
+void GameBoard::SetSharedTarget(SDL_Texture* atlas, const SDL_FRect& cell)
+{
+    shared_target_ = atlas;
+    shared_source_rect_ = cell;
+
+    // Ʋ󽺸  帶  Ÿ  ʿ䰡 
+    if (shared_target_ && target_render_texture_)
+    {
+        SDL_DestroyTexture(target_render_texture_);
+        target_render_texture_ = nullptr;
+    }
+}
+
 void GameBoard::SetBlockInfoTexture(const std::shared_ptr<ImageTexture>& texture) 
 {
     source_texture_ = texture;
@@ -225,8 +240,8 @@ void GameBoard::ResetRenderTargetPosition()
 {
     target_render_rect_.x = renderTargetPos_.x;
     target_render_rect_.y = renderTargetPos_.y;
-    target_render_rect_.w = Constants::Board::WIDTH;
-    target_render_rect_.h = Constants::Board::HEIGHT;
+    target_render_rect_.w = Constants::Board::WIDTH * scale_;
+    target_render_rect_.h = Constants::Board::HEIGHT * scale_;
 }
 
 void GameBoard::SetState(BoardState newState) 
@@ -258,7 +273,7 @@ void GameBoard::SetState(BoardState newState)
 
 void GameBoard::Render() 
 {
-    if (!is_visible_ || !target_render_texture_) 
+    if (!is_visible_ || (!target_render_texture_ && !shared_target_)) 
     {
         return;
     }
@@ -268,9 +283,41 @@ void GameBoard::Render()
         return;
     }
 
+    //    GameState  Ʋ󽺿   ׷ ξ
+    if (shared_target_)
+    {
+        RENDER_RECORDER.DrawTexture(
+            GAME_APP.GetRenderer(),
+            shared_target_,
+            &shared_source_rect_,
+            &target_render_rect_,
+            angle_,
+            nullptr,
+            flip_
+        );
+        return;
+    }
+
     //  Ÿ 
-    SDL_SetRenderTarget(GAME_APP.GetRenderer(), target_render_texture_);
+    RENDER_RECORDER.SetRenderTarget(GAME_APP.GetRenderer(), target_render_texture_);
+
+    RenderContents();
+
+    RENDER_RECORDER.SetRenderTarget(GAME_APP.GetRenderer(), nullptr);
+
+    RENDER_RECORDER.DrawTexture(
+        GAME_APP.GetRenderer(),
+        target_render_texture_,
+        nullptr,
+        &target_render_rect_,
+        angle_,
+        nullptr,
+        flip_
+    );
+}
 
+void GameBoard::RenderContents()
+{
     //  
     RenderBackground();
 
@@ -286,18 +333,6 @@ void GameBoard::Render()
     RenderFixedBlocks();
 
     GAME_APP.GetParticleManager().RenderForPlayer(player_id_);
-
-    SDL_SetRenderTarget(GAME_APP.GetRenderer(), nullptr);
-
-    SDL_RenderTextureRotated(
-        GAME_APP.GetRenderer(),
-        target_render_texture_,
-        nullptr,
-        &target_render_rect_,
-        angle_,
-        nullptr,
-        flip_
-    );
 }
 
 void GameBoard::RenderBackground() 
@@ -339,6 +374,9 @@ void GameBoard::Release()
             target_render_texture_ = nullptr;
         }
 
+        shared_target_ = nullptr;
+        scale_ = 1.0f;
+
         block_list_->clear();
         active_group_block_.reset();
         source_texture_.reset();
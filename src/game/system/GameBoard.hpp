@@ -50,7 +50,7 @@ public:
     GameBoard(GameBoard&&) noexcept = delete;
     GameBoard& operator=(GameBoard&&) noexcept = delete;
 
-    bool Initialize(float xPos, float yPos, std::list<std::shared_ptr<Block>>& blockList, uint8_t playerId = 0);
+    bool Initialize(float xPos, float yPos, std::list<std::shared_ptr<Block>>& blockList, uint8_t playerId = 0, float scale = 1.0f);
     void Update(float deltaTime) override;
     void Render() override;
     void Release() override;
@@ -61,6 +61,13 @@ public:
     void UpdateTargetBlockMark(const std::array<BlockTargetMark, 2>& markInfo);
     void ResetGroupBlock();
 
+    //    : ڱ  Ÿ  GameState  Ʋ cell  ׸     ȭ鿡 
+    void SetSharedTarget(SDL_Texture* atlas, const SDL_FRect& cell);
+    [[nodiscard]] bool HasSharedTarget() const { return shared_target_ != nullptr; }
+
+    //   Ÿ(Ʈ)  븸 ׸
+    void RenderContents();
+
     void SetRenderTargetMark(bool render) { is_target_mark_ = render; }
     void SetState(BoardState state);
     [[nodiscard]] BoardState GetState() const { return state_; }
@@ -92,6 +99,10 @@ private:
     SDL_Texture* target_render_texture_{ nullptr };
     SDL_FRect target_render_rect_{};
 
+    SDL_Texture* shared_target_{ nullptr };     // GameState 
+    SDL_FRect shared_source_rect_{};
+    float scale_{ 1.0f };
+
     bool is_scaled_{ false };
     bool is_target_mark_{ false };
     uint8_t player_id_{ 0 };
@@ -0,0 +1,288 @@
+#include "GarbageEngine.hpp"
+
+#include "../../utils/Logger.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <random>
+#include <string_view>
+
+namespace
+{
+    constexpr uint64_t MAX_REPORTED_MISMATCHES = 8;
+    constexpr uint32_t MAX_STEP_SCORE = 20'000;     //  1  int16   ʴ 
+    constexpr size_t MAX_CHAIN_STEPS = 19;
+
+    // ÷̾ Ŭ ִ  ״ ű  ڵ
+    namespace Legacy
+    {
+        struct ScoreState
+        {
+            uint32_t rest_score{ 0 };
+            int16_t total_interrupt_block_count{ 0 };
+            int16_t total_enemy_interrupt_block_count{ 0 };
+            int16_t add_interrupt_block_count{ 0 };
+        };
+
+        uint8_t GetMargin(float play_time)
+        {
+            for (const auto& margin : Constants::Game::SCORE_MARGINS)
+            {
+                if (play_time <= margin.time)
+                {
+                    return margin.margin;
+                }
+            }
+
+            return Constants::Game::SCORE_MARGINS[std::size(Constants::Game::SCORE_MARGINS) - 1].margin;
+        }
+
+        // LocalPlayer::CalculateScore + LocalPlayer::UpdateInterruptBlockState
+        void AddChainStep(ScoreState& score_info_, uint32_t currentScore, uint8_t margin, bool isServer)
+        {
+            score_info_.add_interrupt_block_count = (currentScore + score_info_.rest_score) / margin;
+            score_info_.rest_score = (currentScore + score_info_.rest_score) % margin;
+
+            if (score_info_.total_interrupt_block_count > 0)
+            {
+                score_info_.total_interrupt_block_count -= score_info_.add_interrupt_block_count;
+
+                if (score_info_.total_interrupt_block_count <= 0)
+                {
+                    score_info_.add_interrupt_block_count = std::abs(score_info_.total_interrupt_block_count);
+                    score_info_.total_interrupt_block_count = 0;
+
+                    if (isServer)
+                    {
+                        if (score_info_.add_interrupt_block_count > 0)
+                        {
+                            score_info_.total_enemy_interrupt_block_count += score_info_.add_interrupt_block_count;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                if (isServer)
+                {
+                    if (score_info_.add_interrupt_block_count > 0)
+                    {
+                        score_info_.total_enemy_interrupt_block_count += score_info_.add_interrupt_block_count;
+                    }
+                }
+                score_info_.total_interrupt_block_count = 0;
+            }
+        }
+
+        // LocalPlayer::DefenseInterruptBlockCount
+        int16_t Defend(int16_t total_enemy_interrupt_block_count, int16_t count)
+        {
+            total_enemy_interrupt_block_count -= count;
+
+            if (total_enemy_interrupt_block_count < 0)
+            {
+                total_enemy_interrupt_block_count = 0;
+            }
+            return total_enemy_interrupt_block_count;
+        }
+
+        // BasePlayer::GenerateIceBlocks (ū ׷ /  ׷)
+        Garbage::Drop PlanDrop(int16_t total_interrupt_block_count)
+        {
+            if (total_interrupt_block_count > 30)
+            {
+                return { 5, 0, static_cast<int16_t>(total_interrupt_block_count - 30) };
+            }
+
+            const auto yCnt = total_interrupt_block_count / Constants::Board::BOARD_X_COUNT;
+            const auto xCnt = total_interrupt_block_count % Constants::Board::BOARD_X_COUNT;
+            return { static_cast<int16_t>(yCnt), static_cast<int16_t>(xCnt), 0 };
+        }
+
+        bool ShouldDrop(int16_t total_interrupt_block_count, bool is_combo_attack, bool is_defending)
+        {
+            return total_interrupt_block_count > 0 && !is_combo_attack && !is_defending;
+        }
+    }
+
+    class Checker
+    {
+    public:
+
+        explicit Checker(uint32_t seed) : engine_(seed) {}
+
+        void CheckMargin()
+        {
+            const float play_time = std::uniform_real_distribution<float>(0.0f, 320.0f)(engine_);
+            Expect(Garbage::GetMargin(play_time) == Legacy::GetMargin(play_time), "margin", play_time);
+        }
+
+        void CheckChain()
+        {
+            const bool is_server = Next(0, 1) == 1;
+            const uint8_t margin = Legacy::GetMargin(std::uniform_real_distribution<float>(0.0f, 320.0f)(engine_));
+
+            Legacy::ScoreState legacy;
+            legacy.total_interrupt_block_count = static_cast<int16_t>(Next(-5, 400));
+            legacy.total_enemy_interrupt_block_count = static_cast<int16_t>(Next(0, 2'000));
+
+            const Garbage::Ledger initial{ std::max<int16_t>(legacy.total_interrupt_block_count, 0) };
+            Garbage::Ledger ledger = initial;
+            int16_t enemy = legacy.total_enemy_interrupt_block_count;
+
+            std::array<uint32_t, MAX_CHAIN_STEPS> scores{};
+            const size_t steps = static_cast<size_t>(Next(1, static_cast<int>(MAX_CHAIN_STEPS)));
+
+            int canceled = 0;
+            int sent = 0;
+
+            for (size_t i = 0; i < steps; ++i)
+            {
+                scores[i] = static_cast<uint32_t>(Next(0, static_cast<int>(MAX_STEP_SCORE)));
+
+                Legacy::AddChainStep(legacy, scores[i], margin, is_server);
+                const Garbage::Offset offset = ledger.AddChainStep(scores[i], margin);
+
+                if (is_server && offset.sent > 0)
+                {
+                    enemy += offset.sent;
+                }
+
+                canceled += offset.canceled;
+                sent += offset.sent;
+
+                Expect(ledger.pending == legacy.total_interrupt_block_count, "pending", scores[i]);
+                Expect(ledger.carry == legacy.rest_score, "carry", scores[i]);
+                Expect(Garbage::GetBulletCount(offset) == legacy.add_interrupt_block_count, "bullet", scores[i]);
+                Expect(enemy == legacy.total_enemy_interrupt_block_count, "enemy", scores[i]);
+            }
+
+            //  Է ġ Լ óص  ƾ Ѵ
+            Garbage::Ledger batch = initial;
+            const Garbage::Offset total = Garbage::ResolveChain(batch, std::span(scores.data(), steps), margin);
+
+            constexpr int limit = std::numeric_limits<int16_t>::max();
+            Expect(total.pending == ledger.pending && total.canceled == std::min(canceled, limit) && total.sent == std::min(sent, limit) && batch.carry == 0,
+                "resolve", static_cast<float>(steps));
+        }
+
+        void CheckDefense()
+        {
+            const auto enemy = static_cast<int16_t>(Next(-5, 400));
+            const auto count = static_cast<int16_t>(Next(0, 400));
+            Expect(Garbage::Cancel(enemy, count).pending == Legacy::Defend(enemy, count), "defense", enemy);
+        }
+
+        void CheckDrop()
+        {
+            const auto pending = static_cast<int16_t>(Next(-5, 400));
+            const Garbage::Drop drop = Garbage::PlanDrop(pending);
+
+            if (pending > 0)
+            {
+                const Garbage::Drop legacy = Legacy::PlanDrop(pending);
+                Expect(drop.rows == legacy.rows && drop.columns == legacy.columns && drop.remaining == legacy.remaining, "drop", pending);
+                Expect(drop.GetCount() + drop.remaining == pending, "drop count", pending);
+            }
+
+            const bool is_combo_attack = Next(0, 1) == 1;
+            const bool is_defending = Next(0, 1) == 1;
+            Expect(Garbage::ShouldDrop(pending, is_combo_attack, is_defending) == Legacy::ShouldDrop(pending, is_combo_attack, is_defending),
+                "should drop", pending);
+        }
+
+        [[nodiscard]] uint64_t GetMismatches() const { return mismatches_; }
+
+    private:
+
+        int Next(int min, int max)
+        {
+            return std::uniform_int_distribution<int>(min, max)(engine_);
+        }
+
+        void Expect(bool isSame, std::string_view name, float input)
+        {
+            if (isSame)
+            {
+                return;
+            }
+
+            if (++mismatches_ <= MAX_REPORTED_MISMATCHES)
+            {
+                LOGGER.Error("Garbage check mismatch: {} (input {})", name, input);
+            }
+        }
+
+    private:
+
+        std::mt19937 engine_;
+        uint64_t mismatches_{ 0 };
+    };
+}
+
+namespace Garbage
+{
+    std::optional<CheckCommandLine> ParseCommandLine(int argc, char* argv[])
+    {
+        CheckCommandLine commandLine;
+        bool is_check = false;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg(argv[i]);
+            const bool has_value = i + 1 < argc;
+
+            if (arg == "--garbage-check")
+            {
+                is_check = true;
+                if (has_value && std::string_view(argv[i + 1]).substr(0, 2) != "--")
+                {
+                    const std::string_view value(argv[++i]);
+                    if (std::from_chars(value.data(), value.data() + value.size(), commandLine.iterations).ec != std::errc{} || commandLine.iterations == 0)
+                    {
+                        LOGGER.Warning("Invalid --garbage-check value: {}", value);
+                        commandLine.iterations = CheckCommandLine{}.iterations;
+                    }
+                }
+            }
+            else if (arg == "--garbage-seed" && has_value)
+            {
+                const std::string_view value(argv[++i]);
+                if (std::from_chars(value.data(), value.data() + value.size(), commandLine.seed).ec != std::errc{})
+                {
+                    LOGGER.Warning("Invalid --garbage-seed value: {}", value);
+                }
+            }
+        }
+
+        if (!is_check)
+        {
+            return std::nullopt;
+        }
+
+        return commandLine;
+    }
+
+    bool RunCheck(const CheckCommandLine& commandLine)
+    {
+        Checker checker(commandLine.seed);
+
+        for (uint64_t i = 0; i < commandLine.iterations; ++i)
+        {
+            checker.CheckMargin();
+            checker.CheckChain();
+            checker.CheckDefense();
+            checker.CheckDrop();
+        }
+
+        if (checker.GetMismatches() > 0)
+        {
+            LOGGER.Error("Garbage check failed: {} mismatches in {} cases (seed {})", checker.GetMismatches(), commandLine.iterations, commandLine.seed);
+            return false;
+        }
+
+        LOGGER.Info("Garbage check passed: {} cases (seed {})", commandLine.iterations, commandLine.seed);
+        return true;
+    }
+}
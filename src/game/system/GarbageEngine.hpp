@@ -0,0 +1,182 @@
+#pragma once
+/*
+*
+* :  ()  ( Ӱ ġ ùķ̼  Ģ    д)
+* 1.  ܰ  + ̿ (carry)  ð       ,  Ⱑ   ̿
+* 2.         ϰ  ŭ 뿡  (     پ)
+* 3.      ޴  ƴϰ  İ ƴ     ,
+*      ִ MAX_DROP_ROWS ,  ̸    +  ĭ ŭ   
+* 4.  Լ Ҵ   Լ̰ Ledger   ÷̾ ¸   Ÿ (ӿ BasePlayer::ScoreInfo    )
+* 5. --garbage-check [n] [--garbage-seed s]    ű  ڵ  Է n   ˻  
+*
+*/
+
+#include "../../core/common/constants/Constants.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+
+namespace Garbage
+{
+    inline constexpr int16_t MAX_DROP_ROWS = 5;
+    inline constexpr int16_t MAX_DROP_COUNT = MAX_DROP_ROWS * Constants::Board::BOARD_X_COUNT;
+
+    //  ð()    1 
+    [[nodiscard]] constexpr uint8_t GetMargin(float playTime)
+    {
+        for (const auto& margin : Constants::Game::SCORE_MARGINS)
+        {
+            if (playTime <= margin.time)
+            {
+                return margin.margin;
+            }
+        }
+
+        return Constants::Game::SCORE_MARGINS[std::size(Constants::Game::SCORE_MARGINS) - 1].margin;
+    }
+
+    struct Conversion
+    {
+        int16_t count{ 0 };     //    
+        uint32_t carry{ 0 };    //   ܰ ̿ 
+    };
+
+    //   ܰ    ȯ (int16   ִ밪 )
+    [[nodiscard]] constexpr Conversion Convert(uint32_t score, uint32_t carry, uint8_t margin)
+    {
+        const uint64_t total = static_cast<uint64_t>(score) + carry;
+        const uint64_t divisor = std::max<uint8_t>(margin, 1);
+        const uint64_t count = std::min<uint64_t>(total / divisor, std::numeric_limits<int16_t>::max());
+
+        return { static_cast<int16_t>(count), static_cast<uint32_t>(total % divisor) };
+    }
+
+    struct Offset
+    {
+        int16_t pending{ 0 };   //      
+        int16_t canceled{ 0 };  //  
+        int16_t sent{ 0 };      // ϰ  뿡  
+    };
+
+    // generated ŭ pending   (pending  0 ̸  )
+    [[nodiscard]] constexpr Offset Cancel(int16_t pending, int16_t generated)
+    {
+        generated = std::max<int16_t>(generated, 0);
+        if (pending <= 0)
+        {
+            return { 0, 0, generated };
+        }
+
+        const int16_t canceled = std::min(pending, generated);
+        return { static_cast<int16_t>(pending - canceled), canceled, static_cast<int16_t>(generated - canceled) };
+    }
+
+    //  Ʈ   Ǿ   ( Ŀ      , ƴϸ  )
+    [[nodiscard]] constexpr int16_t GetBulletCount(const Offset& offset)
+    {
+        return offset.pending > 0 ? offset.canceled : offset.sent;
+    }
+
+    struct Drop
+    {
+        int16_t rows{ 0 };          //  ä  
+        int16_t columns{ 0 };       //   ࿡  ĭ  ( MATCH_RANDOM  Ѵ)
+        int16_t remaining{ 0 };     // ߸    
+
+        [[nodiscard]] constexpr int16_t GetCount() const
+        {
+            return static_cast<int16_t>(rows * Constants::Board::BOARD_X_COUNT + columns);
+        }
+    };
+
+    //     ̹ ߸ 
+    [[nodiscard]] constexpr Drop PlanDrop(int16_t pending)
+    {
+        if (pending <= 0)
+        {
+            return {};
+        }
+
+        if (pending > MAX_DROP_COUNT)
+        {
+            return { MAX_DROP_ROWS, 0, static_cast<int16_t>(pending - MAX_DROP_COUNT) };
+        }
+
+        return {
+            static_cast<int16_t>(pending / Constants::Board::BOARD_X_COUNT),
+            static_cast<int16_t>(pending % Constants::Board::BOARD_X_COUNT),
+            0 };
+    }
+
+    //       ߸
+    [[nodiscard]] constexpr bool ShouldDrop(int16_t pending, bool isComboAttack, bool isDefending)
+    {
+        return pending > 0 && !isComboAttack && !isDefending;
+    }
+
+    //  ÷̾   
+    struct Ledger
+    {
+        int16_t pending{ 0 };
+        uint32_t carry{ 0 };
+
+        //   ܰ  ȯϿ 
+        constexpr Offset AddChainStep(uint32_t score, uint8_t margin)
+        {
+            const Conversion conversion = Convert(score, carry, margin);
+            carry = conversion.carry;
+
+            const Offset offset = Cancel(pending, conversion.count);
+            pending = offset.pending;
+            return offset;
+        }
+
+        constexpr void EndChain() { carry = 0; }
+
+        constexpr void Receive(int16_t count)
+        {
+            pending = static_cast<int16_t>(std::clamp<int>(pending + count, 0, std::numeric_limits<int16_t>::max()));
+        }
+
+        constexpr Drop TakeDrop()
+        {
+            const Drop drop = PlanDrop(pending);
+            pending = drop.remaining;
+            return drop;
+        }
+    };
+
+    //  ܰ  ʷ óϰ ⸦   / հ踦 ȯ (ġ ùķ̼ǿ)
+    constexpr Offset ResolveChain(Ledger& ledger, std::span<const uint32_t> stepScores, uint8_t margin)
+    {
+        int canceled = 0;
+        int sent = 0;
+
+        for (const uint32_t score : stepScores)
+        {
+            const Offset offset = ledger.AddChainStep(score, margin);
+            canceled += offset.canceled;
+            sent += offset.sent;
+        }
+        ledger.EndChain();
+
+        constexpr int limit = std::numeric_limits<int16_t>::max();
+        return { ledger.pending, static_cast<int16_t>(std::min(canceled, limit)), static_cast<int16_t>(std::min(sent, limit)) };
+    }
+
+    struct CheckCommandLine
+    {
+        uint64_t iterations{ 1'000'000 };
+        uint32_t seed{ 0x6A7B };
+    };
+
+    // --garbage-check [n] [--garbage-seed s]
+    [[nodiscard]] std::optional<CheckCommandLine> ParseCommandLine(int argc, char* argv[]);
+
+    //  (÷̾ Ŭ  ִ )  Է , ٸ   true
+    bool RunCheck(const CheckCommandLine& commandLine);
+}
@@ -11,6 +11,8 @@
 #include "../block/GroupBlock.hpp"
 
 #include "../system/GameBoard.hpp"
+#include "../system/ScoreTable.hpp"
+#include "../system/GarbageEngine.hpp"
 #include "../view/InterruptBlockView.hpp"
 #include "../view/ComboView.hpp"
 #include "../view/ResultView.hpp"
@@ -19,17 +21,29 @@
 #include "../effect/BulletEffect.hpp"
 #include "../../texture/ImageTexture.hpp"
 #include "../../utils/Logger.hpp"
+#include "../replay/MatchRecorder.hpp"
+#include "../puzzle/PuzzleMode.hpp"
 
 #include <algorithm>
 #include <random>
 
+namespace
+{
+    void RecordNextBlock(uint8_t playerId, GroupBlock& groupBlock)
+    {
+        auto& blocks = groupBlock.GetBlocks();
+        MATCH_RECORDER.RecordNextBlock(playerId,
+            static_cast<uint8_t>(blocks[0]->GetBlockType()),
+            static_cast<uint8_t>(blocks[1]->GetBlockType()));
+    }
+}
+
 LocalPlayer::~LocalPlayer()
 {
     Release();
 }
 
-bool LocalPlayer::Initialize(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-    uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
+bool LocalPlayer::Initialize(uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
 {
     Reset();
 
@@ -58,8 +72,15 @@ bool LocalPlayer::Initialize(const std::span<const uint8_t>& blockType1, const s
             interrupt_view_->SetPosition(Constants::Board::POSITION_X, 0);
         }
 
+        if (PUZZLE_MODE.IsActive())
+        {
+            CreateBlocksFromBoardText(PUZZLE_MODE.GetPuzzle().board.ToText());
+        }
 #ifdef _APP_DEBUG_
-        CreateBlocksFromFile();
+        else
+        {
+            CreateBlocksFromFile();
+        }
 #endif
         state_info_ = GameStateInfo{};
         score_info_ = ScoreInfo{};
@@ -67,25 +88,13 @@ bool LocalPlayer::Initialize(const std::span<const uint8_t>& blockType1, const s
         state_info_.current_phase = GamePhase::Playing;
         state_info_.previous_phase = GamePhase::Playing;
 
-
-        std::array<uint8_t, 2> first_block_types{};
-        std::array<uint8_t, 2> second_block_types{};
-
-        auto& first_blocks = next_blocks_[0]->GetBlocks();
-        first_block_types[0] = static_cast<uint8_t>(first_blocks[0]->GetBlockType());
-        first_block_types[1] = static_cast<uint8_t>(first_blocks[1]->GetBlockType());
-
-        auto& second_blocks = next_blocks_[1]->GetBlocks();
-        second_block_types[0] = static_cast<uint8_t>(second_blocks[0]->GetBlockType());
-        second_block_types[1] = static_cast<uint8_t>(second_blocks[1]->GetBlockType());
-
-        NETWORK.GameInitialize(first_block_types, second_block_types);
+        NETWORK.GameInitialize();
 
         return true;
     }
     catch (const std::exception& e)
     {
-        LOGGER.Error("LocalPlayer initialization failed: {}", e.what());
+        LOG_GAMEPLAY(Error, "LocalPlayer initialization failed: {}", e.what());
         return false;
     }
 }
@@ -95,11 +104,15 @@ void LocalPlayer::InitializeNextBlocks()
     auto nextBlock1 = std::make_shared<GroupBlock>();
     auto nextBlock2 = std::make_shared<GroupBlock>();
 
-    if (nextBlock1->Create() == false || nextBlock2->Create() == false)
+    next_piece_index_ = 0;
+    if (nextBlock1->Create(next_piece_index_++) == false || nextBlock2->Create(next_piece_index_++) == false)
     {
         throw std::runtime_error("Failed to create next blocks");
     }
 
+    RecordNextBlock(player_id_, *nextBlock1);
+    RecordNextBlock(player_id_, *nextBlock2);
+
     nextBlock1->SetPosXY(Constants::GroupBlock::NEXT_BLOCK_POS_X, Constants::GroupBlock::NEXT_BLOCK_POS_Y);
     nextBlock1->SetScale(Constants::Block::SIZE, Constants::Block::SIZE);
     nextBlock2->SetPosXY(Constants::GroupBlock::NEXT_BLOCK_POS_SMALL_X, Constants::GroupBlock::NEXT_BLOCK_POS_SMALL_Y);
@@ -208,7 +221,7 @@ void LocalPlayer::UpdateShatteringPhase(float deltaTime)
                     SDL_FPoint pos{ block->GetX(), block->GetY() };
                     SDL_Point idx{ block->GetPosIdx_X(), block->GetPosIdx_Y() };
 
-                    CreateBlockClearEffect(std::shared_ptr<Block>(block, [](Block*) {}));
+                    CreateBlockClearEffect(*block);
 
                     board_blocks_[idx.y][idx.x] = nullptr;
 
@@ -274,7 +287,7 @@ void LocalPlayer::UpdateShatteringPhase(float deltaTime)
                 {
                     if (!state_info_.should_quit)
                     {
-                        if (score_info_.total_interrupt_block_count > 0 && !state_info_.is_combo_attack && !state_info_.is_defending)
+                        if (Garbage::ShouldDrop(score_info_.total_interrupt_block_count, state_info_.is_combo_attack, state_info_.is_defending))
                         {
                             GenerateIceBlocks();
                         }
@@ -292,6 +305,10 @@ void LocalPlayer::UpdateShatteringPhase(float deltaTime)
             {
                 SetGamePhase(GamePhase::GameOver);                
             }
+            else if (ProcessPuzzleOutcome())
+            {
+                SetGamePhase(GamePhase::GameOver);
+            }
             else
             {
                 if (NETWORK.IsRunning())
@@ -302,7 +319,7 @@ void LocalPlayer::UpdateShatteringPhase(float deltaTime)
                 state_info_.current_phase = GamePhase::Playing;
                 state_info_.previous_phase = GamePhase::Playing;
 
-                if (score_info_.total_interrupt_block_count > 0 && !state_info_.is_combo_attack && !state_info_.is_defending)
+                if (Garbage::ShouldDrop(score_info_.total_interrupt_block_count, state_info_.is_combo_attack, state_info_.is_defending))
                 {
                     GenerateIceBlocks();
                 }
@@ -322,13 +339,17 @@ void LocalPlayer::CreateNextBlock()
         return;
     }
 
+    const uint32_t pieceIndex = next_piece_index_++;
+
     auto nextBlock = std::make_shared<GroupBlock>();
-    if (!nextBlock->Create())
+    if (!nextBlock->Create(pieceIndex))
     {
-        LOGGER.Error("Failed to create next block");
+        LOG_GAMEPLAY(Error, "Failed to create next block");
         return;
     }
 
+    RecordNextBlock(player_id_, *nextBlock);
+
     nextBlock->SetPosXY(Constants::GroupBlock::NEXT_BLOCK_POS_SMALL_X, 100);
     nextBlock->SetScale(Constants::GroupBlock::NEXT_BLOCK_SMALL_SIZE, Constants::GroupBlock::NEXT_BLOCK_SMALL_SIZE);
 
@@ -343,18 +364,10 @@ void LocalPlayer::CreateNextBlock()
         game_board_->SetRenderTargetMark(false);
     }
 
+    // 색은 상대도 같은 시드로 알고 있으므로 순번만 보낸다
     if (NETWORK.IsRunning())
     {
-        if (auto lastBlock = next_blocks_.back().get())
-        {
-            auto blocks = lastBlock->GetBlocks();
-            std::array<uint8_t, 2> blockTypes{
-                static_cast<uint8_t>(blocks[0]->GetBlockType()),
-                static_cast<uint8_t>(blocks[1]->GetBlockType())
-            };
-
-            NETWORK.AddNewBlock(blockTypes);
-        }
+        NETWORK.AddNewBlock(static_cast<uint16_t>(pieceIndex));
     }
 }
 
@@ -390,6 +403,8 @@ void LocalPlayer::MoveBlock(uint8_t moveType, float position)
         return;
     }
 
+    MATCH_RECORDER.RecordMove(player_id_, moveType);
+
     switch (static_cast<Constants::Direction>(moveType))
     {
     case Constants::Direction::Left:
@@ -416,6 +431,7 @@ void LocalPlayer::RotateBlock(uint8_t rotateType, bool horizontalMoving)
 {
     if (control_block_ && control_block_->GetState() == BlockState::Playing)
     {
+        MATCH_RECORDER.RecordInput(player_id_, Replay::InputAction::Rotate);
         control_block_->Rotate();
     }
 }
@@ -443,7 +459,7 @@ bool LocalPlayer::PushBlockInGame(GameGroupBlock* groupBlock)
 {
     if (!groupBlock)
     {
-        LOGGER.Error("PushBlockInGame called with null block");
+        LOG_GAMEPLAY(Error, "PushBlockInGame called with null block");
         return false;
     }
 
@@ -478,7 +494,7 @@ bool LocalPlayer::PushBlockInGame(GameGroupBlock* groupBlock)
             state_info_.defense_count = 0;
         }
 
-        if (score_info_.total_interrupt_block_count > 0 && !state_info_.is_combo_attack && !state_info_.is_defending)
+        if (Garbage::ShouldDrop(score_info_.total_interrupt_block_count, state_info_.is_combo_attack, state_info_.is_defending))
         {
             GenerateIceBlocks();
         }
@@ -515,18 +531,13 @@ void LocalPlayer::AttackInterruptBlock(float x, float y, uint8_t type)
 
 void LocalPlayer::DefenseInterruptBlockCount(int16_t count, float x, float y, uint8_t type)
 {
-    score_info_.total_enemy_interrupt_block_count -= count;
-
-    if (score_info_.total_enemy_interrupt_block_count < 0)
-    {
-        score_info_.total_enemy_interrupt_block_count = 0;
-    }
+    score_info_.total_enemy_interrupt_block_count = Garbage::Cancel(score_info_.total_enemy_interrupt_block_count, count).pending;
        
     NotifyEvent(std::make_shared<DefenseBlockEvent>(player_id_, count, x, y, type));
 }
 
 
-bool LocalPlayer::Restart(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2)
+bool LocalPlayer::Restart()
 {
     Reset();
 
@@ -535,13 +546,13 @@ bool LocalPlayer::Restart(const std::span<const uint8_t>& blockType1, const std:
 
         if (!InitializeGameBoard(Constants::Board::POSITION_X, Constants::Board::POSITION_Y))
         {
-            LOGGER.Error("Failed to initialize game board during restart");
+            LOG_GAMEPLAY(Error, "Failed to initialize game board during restart");
             return false;
         }
 
         if (!InitializeControlBlock())
         {
-            LOGGER.Error("Failed to initialize control block during restart");
+            LOG_GAMEPLAY(Error, "Failed to initialize control block during restart");
             return false;
         }
 
@@ -559,7 +570,7 @@ bool LocalPlayer::Restart(const std::span<const uint8_t>& blockType1, const std:
         return true;
     }
     catch (const std::exception& e) {
-        LOGGER.Error("Error restarting local player: {}", e.what());
+        LOG_GAMEPLAY(Error, "Error restarting local player: {}", e.what());
         return false;
     }
 }
@@ -625,7 +636,7 @@ void LocalPlayer::CreateBullet(Block* block)
 {
     if (!block)
     {
-        LOGGER.Error("LocalPlayer::CreateBullet - block is NULL");
+        LOG_GAMEPLAY(Error, "LocalPlayer::CreateBullet - block is NULL");
         return;
     }
 
@@ -692,7 +703,7 @@ void LocalPlayer::CreateBullet(Block* block)
     auto bullet = std::make_shared<BulletEffect>();
     if (!bullet->Initialize(startPos, endPos, block->GetBlockType()))
     {
-        LOGGER.Error("Failed to create bullet effect");
+        LOG_GAMEPLAY(Error, "Failed to create bullet effect");
         return;
     }
 
@@ -770,6 +781,24 @@ bool LocalPlayer::ProcessGameOver()
     return false;
 }
 
+// 퍼즐 모드에서 연쇄가 끝난 보드로 목표 달성/블록 소진을 확인하여 게임 종료
+bool LocalPlayer::ProcessPuzzleOutcome()
+{
+    const auto outcome = PUZZLE_MODE.OnBoardSettled(*this);
+    if (outcome == PuzzleMode::Outcome::None)
+    {
+        return false;
+    }
+
+    const bool isSolved = outcome == PuzzleMode::Outcome::Solved;
+    ResetComboState();
+    LoseGame(isSolved);
+
+    NotifyEvent(std::make_shared<GameOverEvent>(player_id_, isSolved));
+
+    return true;
+}
+
 void LocalPlayer::AddInterruptBlockCount(int16_t count, float x, float y, uint8_t type)
 {
     if (NETWORK.IsServer())
@@ -799,6 +828,12 @@ bool LocalPlayer::CheckGameBlockState()
 
     if (block_list_.size() < Constants::Game::MIN_MATCH_COUNT)
     {
+        if (ProcessPuzzleOutcome())
+        {
+            SetGamePhase(GamePhase::GameOver);
+            return true;
+        }
+
         SetGamePhase(GamePhase::Playing);
         ResetComboState();
         return false;
@@ -823,6 +858,11 @@ bool LocalPlayer::CheckGameBlockState()
         }
         return true;
     }
+    else if (ProcessPuzzleOutcome())
+    {
+        SetGamePhase(GamePhase::GameOver);
+        return true;
+    }
     else
     {
         ResetComboState();
@@ -862,10 +902,11 @@ void LocalPlayer::CalculateScore()
         blockCount += static_cast<uint8_t>(group.size());
     }
 
-    int currentScore = ((blockCount * Constants::Game::Score::BASE_MATCH_SCORE) * (comboBonus + linkBonus + typeBonus + 1));
+    int currentScore = ScoreTable::GetStepScore(blockCount, comboBonus + linkBonus + typeBonus);
 
-    score_info_.add_interrupt_block_count = (currentScore + score_info_.rest_score) / GetMargin();
-    score_info_.rest_score = (currentScore + score_info_.rest_score) % GetMargin();
+    const Garbage::Conversion conversion = Garbage::Convert(currentScore, score_info_.rest_score, GetMargin());
+    score_info_.add_interrupt_block_count = conversion.count;
+    score_info_.rest_score = conversion.carry;
     score_info_.total_score += currentScore;
 
     UpdateInterruptBlockState();
@@ -874,34 +915,15 @@ void LocalPlayer::CalculateScore()
 // 방해 블록 상태 업데이트
 void LocalPlayer::UpdateInterruptBlockState()
 {
-    if (score_info_.total_interrupt_block_count > 0)
-    {
-        score_info_.total_interrupt_block_count -= score_info_.add_interrupt_block_count;
+    const Garbage::Offset offset = Garbage::Cancel(score_info_.total_interrupt_block_count, score_info_.add_interrupt_block_count);
 
-        if (score_info_.total_interrupt_block_count <= 0)
-        {
-            score_info_.add_interrupt_block_count = std::abs(score_info_.total_interrupt_block_count);
-            score_info_.total_interrupt_block_count = 0;
+    score_info_.total_interrupt_block_count = offset.pending;
+    score_info_.add_interrupt_block_count = Garbage::GetBulletCount(offset);
 
-            if (NETWORK.IsServer())
-            {
-                if (score_info_.add_interrupt_block_count > 0)
-                {
-                    score_info_.total_enemy_interrupt_block_count += score_info_.add_interrupt_block_count;
-                }
-            }
-        }       
-    }
-    else
+    // 상대의 대기 방해 블록 수는 서버가 관리
+    if (NETWORK.IsServer() && offset.sent > 0)
     {
-        if (NETWORK.IsServer())
-        {
-            if (score_info_.add_interrupt_block_count > 0)
-            {
-                score_info_.total_enemy_interrupt_block_count += score_info_.add_interrupt_block_count;
-            }
-        }
-        score_info_.total_interrupt_block_count = 0;
+        score_info_.total_enemy_interrupt_block_count += offset.sent;
     }
 
     state_info_.has_ice_block = score_info_.total_interrupt_block_count > 0;
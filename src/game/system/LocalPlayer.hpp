@@ -21,16 +21,14 @@ public:
     LocalPlayer() = default;
     ~LocalPlayer() override;
 
-    bool Initialize(const std::span<const uint8_t>& blockType1,
-        const std::span<const uint8_t>& blockType2,
-        uint8_t playerIdx,
+    bool Initialize(uint8_t playerIdx,
         uint16_t characterIdx,
         const std::shared_ptr<GameBackground>& background) override;
 
     void Update(float deltaTime) override;
     void Release() override;
     void Reset() override;
-    bool Restart(const std::span<const uint8_t>& blockType1 = {}, const std::span<const uint8_t>& blockType2 = {}) override;
+    bool Restart() override;
     void CreateNextBlock() override;
     void PlayNextBlock() override;
     void MoveBlock(uint8_t moveType, float position) override;
@@ -60,9 +58,11 @@ private:
     void InitializeNextBlocks();
     void ResetComboState() override;
     bool ProcessGameOver() override;
+    bool ProcessPuzzleOutcome();
 
 private:
 
     //  
     uint64_t last_inputTime_{ 0 };
+    uint32_t next_piece_index_{ 0 };    //    ġ   
 };
\ No newline at end of file
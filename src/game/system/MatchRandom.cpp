@@ -0,0 +1,124 @@
+#include "MatchRandom.hpp"
+#include "../block/Block.hpp"
+#include "../../core/GameUtils.hpp"
+
+#include <bit>
+#include <cassert>
+#include <random>
+
+namespace
+{
+    //    Ϲ  ٸ splitmix64  ģ
+    constexpr uint64_t PIECE_STREAM = 0x5049454345000000;   // "PIECE"
+
+    uint64_t SplitMix64(uint64_t& state)
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+
+    //  ҷ [min, max]    ϳ 
+    int Scale(uint32_t value, int min, int max)
+    {
+        const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+        return min + static_cast<int>((static_cast<uint64_t>(value) * range) >> 32);
+    }
+}
+
+void MatchEngine::Seed(uint64_t seed)
+{
+    for (size_t i = 0; i < state_.size(); i += 2)
+    {
+        const uint64_t value = SplitMix64(seed);
+        state_[i] = static_cast<uint32_t>(value);
+        state_[i + 1] = static_cast<uint32_t>(value >> 32);
+    }
+}
+
+uint32_t MatchEngine::operator()()
+{
+    const uint32_t result = std::rotl(state_[1] * 5, 7) * 9;
+    const uint32_t t = state_[1] << 9;
+
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = std::rotl(state_[3], 11);
+
+    return result;
+}
+
+MatchRandom& MatchRandom::GetInstance()
+{
+    static MatchRandom instance;
+    return instance;
+}
+
+MatchRandom::MatchRandom()
+{
+    Reset(CreateSeed());
+}
+
+uint32_t MatchRandom::CreateSeed()
+{
+    const uint32_t fixedSeed = GameUtils::Random::GetFixedSeed().load();
+    return fixedSeed != 0 ? fixedSeed : std::random_device{}();
+}
+
+void MatchRandom::Reset(uint32_t seed, uint64_t draws)
+{
+    seed_ = seed;
+    draw_count_ = draws;
+
+    engine_.Seed(seed);
+    for (uint64_t i = 0; i < draws; ++i)
+    {
+        (void)engine_();
+    }
+
+    piece_engine_.Seed(seed ^ PIECE_STREAM);
+    pieces_.clear();
+}
+
+int MatchRandom::NextInt(int min, int max)
+{
+    assert(min <= max);
+
+    // uniform_int_distribution     Ƚ ޶  ҷ   
+    ++draw_count_;
+    return Scale(engine_(), min, max);
+}
+
+MatchRandom::Piece MatchRandom::GetPiece(uint32_t index)
+{
+    if (!fixed_pieces_.empty())
+    {
+        return fixed_pieces_[index % fixed_pieces_.size()];
+    }
+
+    while (index >= pieces_.size())
+    {
+        GeneratePieces();
+    }
+
+    return pieces_[index];
+}
+
+void MatchRandom::GeneratePieces()
+{
+    constexpr int MIN_COLOR = static_cast<int>(BlockType::Red);
+    constexpr int MAX_COLOR = static_cast<int>(BlockType::Purple);
+
+    pieces_.reserve(pieces_.size() + PIECE_BATCH_SIZE);
+
+    for (size_t i = 0; i < PIECE_BATCH_SIZE; ++i)
+    {
+        pieces_.push_back({
+            static_cast<uint8_t>(Scale(piece_engine_(), MIN_COLOR, MAX_COLOR)),
+            static_cast<uint8_t>(Scale(piece_engine_(), MIN_COLOR, MAX_COLOR)) });
+    }
+}
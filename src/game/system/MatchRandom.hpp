@@ -0,0 +1,86 @@
+#pragma once
+/*
+*
+* : ġ   ִ  (  ,    ġ)  
+* 1. ġ   õ ʱȭϰ ÷ Ͽ õ带 Ͽ  Է  ġ 
+* 2. NextInt    Ȯ   ϹǷ  Ƚ(GetDrawCount)  ¸  
+* 3.     PIECE_BATCH_SIZE  ̸  ΰ (GetPiece) ȸ
+*     GameInitPacket/RestartGamePacket   õ带   Ƿ  ÷̾   ,
+*         ޾   
+*      SetFixedPieces      
+* 4.  (ƼŬ ) GameUtils::Random  Ͽ     
+* 5.   
+*
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// xoshiro128** (32Ʈ ), õ splitmix64   ¸ ä
+class MatchEngine
+{
+public:
+
+    void Seed(uint64_t seed);
+    [[nodiscard]] uint32_t operator()();
+
+private:
+
+    std::array<uint32_t, 4> state_{};
+};
+
+class MatchRandom
+{
+public:
+
+    static constexpr size_t PIECE_BATCH_SIZE = 64;
+
+    using Piece = std::array<uint8_t, 2>;     //   BlockType
+
+    static MatchRandom& GetInstance();
+
+    MatchRandom(const MatchRandom&) = delete;
+    MatchRandom& operator=(const MatchRandom&) = delete;
+    MatchRandom(MatchRandom&&) = delete;
+    MatchRandom& operator=(MatchRandom&&) = delete;
+
+    //  õ(帮 --seed)   ,  random_device   õ带 
+    [[nodiscard]] static uint32_t CreateSeed();
+
+    // draws ŭ  · ʱȭ (Űӿ ̾   ),   õθ 
+    void Reset(uint32_t seed, uint64_t draws = 0);
+
+    // [min, max]  
+    [[nodiscard]] int NextInt(int min, int max);
+
+    // ġ index °  (NextInt  Ƚ )
+    [[nodiscard]] Piece GetPiece(uint32_t index);
+
+    // õ      (Reset  ϰ ,  ),   Ĵ ó ݺ
+    void SetFixedPieces(std::vector<Piece> pieces) { fixed_pieces_ = std::move(pieces); }
+    [[nodiscard]] bool HasFixedPieces() const { return !fixed_pieces_.empty(); }
+
+    [[nodiscard]] uint32_t GetSeed() const { return seed_; }
+    [[nodiscard]] uint64_t GetDrawCount() const { return draw_count_; }
+
+private:
+
+    MatchRandom();
+    ~MatchRandom() = default;
+
+    void GeneratePieces();
+
+private:
+
+    MatchEngine engine_;
+    MatchEngine piece_engine_;
+    std::vector<Piece> pieces_;
+    std::vector<Piece> fixed_pieces_;
+    uint32_t seed_{ 0 };
+    uint64_t draw_count_{ 0 };
+};
+
+#define MATCH_RANDOM MatchRandom::GetInstance()
@@ -11,6 +11,8 @@
 #include "../block/GroupBlock.hpp"
 
 #include "../system/GameBoard.hpp"
+#include "../system/MatchRandom.hpp"
+#include "../system/GarbageEngine.hpp"
 #include "../view/InterruptBlockView.hpp"
 #include "../view/ComboView.hpp"
 #include "../view/ResultView.hpp"
@@ -25,6 +27,7 @@
 
 RemotePlayer::RemotePlayer() : BasePlayer()
 {
+    board_slot_ = BoardLayout::GetOpponentSlot(0, 1);
 }
 
 RemotePlayer::~RemotePlayer()
@@ -32,8 +35,7 @@ RemotePlayer::~RemotePlayer()
     Release();
 }
 
-bool RemotePlayer::Initialize(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-    uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
+bool RemotePlayer::Initialize(uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
 {
     Reset();
 
@@ -43,25 +45,21 @@ bool RemotePlayer::Initialize(const std::span<const uint8_t>& blockType1, const
         character_id_ = characterIdx;
         background_ = background;
 
-        InitializeNextBlocks(blockType1, blockType2);
+        InitializeNextBlocks();
 
-        if (!InitializeGameBoard(Constants::Board::PLAYER_POSITION_X, Constants::Board::POSITION_Y))
+        if (!InitializeGameBoard(board_slot_.x, board_slot_.y))
         {
-            LOGGER.Error("Failed to initialize remote player game board");
+            LOG_GAMEPLAY(Error, "Failed to initialize remote player game board");
             return false;
         }
 
         if (!InitializeControlBlock())
         {
-            LOGGER.Error("Failed to initialize remote player control block");
+            LOG_GAMEPLAY(Error, "Failed to initialize remote player control block");
             return false;
         }
 
         InitializeViews();
-        if (interrupt_view_) 
-        {
-            interrupt_view_->SetPosition(Constants::Board::PLAYER_POSITION_X, 0);
-        }
 
 #ifdef _APP_DEBUG_
         CreateBlocksFromFile();
@@ -74,18 +72,22 @@ bool RemotePlayer::Initialize(const std::span<const uint8_t>& blockType1, const
         return true;
     }
     catch (const std::exception& e) {
-        LOGGER.Error("Error restarting remote player: {}", e.what());
+        LOG_GAMEPLAY(Error, "Error restarting remote player: {}", e.what());
         return false;
     }
 }
 
-void RemotePlayer::InitializeNextBlocks(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2)
+void RemotePlayer::InitializeNextBlocks()
 {
     auto next_block1 = std::make_unique<GroupBlock>();
     auto next_block2 = std::make_unique<GroupBlock>();
 
-    if (!next_block1->Create(static_cast<BlockType>(blockType1[0]), static_cast<BlockType>(blockType1[1])) ||
-        !next_block2->Create(static_cast<BlockType>(blockType2[0]), static_cast<BlockType>(blockType2[1])))
+    // 상대의 첫 두 블록은 매치 블록 순서의 0, 1 번
+    const auto piece1 = MATCH_RANDOM.GetPiece(0);
+    const auto piece2 = MATCH_RANDOM.GetPiece(1);
+
+    if (!next_block1->Create(static_cast<BlockType>(piece1[0]), static_cast<BlockType>(piece1[1])) ||
+        !next_block2->Create(static_cast<BlockType>(piece2[0]), static_cast<BlockType>(piece2[1])))
     {
         throw std::runtime_error("Failed to create next blocks");
     }
@@ -98,22 +100,23 @@ void RemotePlayer::InitializeNextBlocks(const std::span<const uint8_t>& blockTyp
     next_blocks_.emplace_back(std::move(next_block1));
     next_blocks_.emplace_back(std::move(next_block2));
 
-    if (background_)
+    // 축소 보드는 배경의 다음 블록 애니메이션 자리를 쓰지 않는다
+    if (background_ && !IsCompact())
     {
         background_->SetPlayerNextBlock(next_blocks_[0]);
         background_->SetPlayerNextBlock(next_blocks_[1]);
     }
 }
 
-bool RemotePlayer::Restart(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2)
+bool RemotePlayer::Restart()
 {
     Reset();
 
     try
     {
-        InitializeNextBlocks(blockType1, blockType2);
+        InitializeNextBlocks();
 
-        if (!InitializeGameBoard(Constants::Board::PLAYER_POSITION_X, Constants::Board::POSITION_Y))
+        if (!InitializeGameBoard(board_slot_.x, board_slot_.y))
         {
             return false;
         }
@@ -132,7 +135,7 @@ bool RemotePlayer::Restart(const std::span<const uint8_t>& blockType1, const std
     }
     catch (const std::exception& e)
     {
-        LOGGER.Error("Failed to restart remote player: %s", e.what());
+        LOG_GAMEPLAY(Error, "Failed to restart remote player: %s", e.what());
         return false;
     }
 }
@@ -285,7 +288,7 @@ void RemotePlayer::HandleClearedBlockGroup(std::list<BlockVector>::iterator& gro
         pos_idx = { block->GetPosIdx_X(), block->GetPosIdx_Y() };
 
         UpdateComboDisplay(pos);
-        CreateBlockClearEffect(std::shared_ptr<Block>(block, [](Block*) {}));
+        CreateBlockClearEffect(*block);
         RemoveBlock(block, pos_idx);
 
         x_index_list.push_back(pos_idx);
@@ -300,7 +303,9 @@ void RemotePlayer::UpdateComboDisplay(const SDL_FPoint& pos)
 {	
     if (combo_view_ && score_info_.combo_count > 0)
     {
-        combo_view_->UpdateComboCount(pos.x + Constants::Board::PLAYER_POSITION_X, pos.y, score_info_.combo_count);
+        // 콤보 뷰의 y 는 보드 기준이므로 보드 위치(POSITION_Y)를 뺀다
+        const SDL_FPoint screen = board_slot_.ToScreen(pos.x, pos.y);
+        combo_view_->UpdateComboCount(screen.x, screen.y - Constants::Board::POSITION_Y, score_info_.combo_count);
     }
 }
 
@@ -549,7 +554,8 @@ void RemotePlayer::AddInterruptBlock(uint8_t y_row_cnt, const std::span<const ui
         return;
     }
 
-    auto texture = ImageTexture::Create("PUYO/puyo_beta.png");
+    static const ResourceHandle blockTexture = ImageTexture::Intern("PUYO/puyo_beta.png");
+    auto texture = ImageTexture::Create(blockTexture);
     if (!texture)
     {
         throw std::runtime_error("Failed to load block texture for interrupt blocks");
@@ -557,7 +563,7 @@ void RemotePlayer::AddInterruptBlock(uint8_t y_row_cnt, const std::span<const ui
 
     try
     {
-        if (y_row_cnt == 5)
+        if (y_row_cnt == Garbage::MAX_DROP_ROWS)
         {
             CreateFullRowInterruptBlocks(texture);
         }
@@ -576,7 +582,7 @@ void RemotePlayer::AddInterruptBlock(uint8_t y_row_cnt, const std::span<const ui
     }
     catch (const std::exception& e)
     {
-        LOGGER.Error("Failed to add interrupt blocks: %s", e.what());
+        LOG_GAMEPLAY(Error, "Failed to add interrupt blocks: %s", e.what());
     }
 }
 
@@ -600,14 +606,14 @@ void RemotePlayer::AddInterruptBlockCnt(short cnt, float x, float y, unsigned ch
 
 void RemotePlayer::CreateFullRowInterruptBlocks(std::shared_ptr<ImageTexture>& texture)
 {
-    for (int y = 0; y < 5; y++)
+    for (int y = 0; y < Garbage::MAX_DROP_ROWS; y++)
     {
         for (int x = 0; x < Constants::Board::BOARD_X_COUNT; x++)
         {
             CreateSingleIceBlock(x, y, texture);
         }
     }
-    score_info_.total_interrupt_block_count -= 30;
+    score_info_.total_interrupt_block_count -= Garbage::MAX_DROP_COUNT;
 }
 
 void RemotePlayer::CreatePartialRowInterruptBlocks(uint8_t y_row_cnt, const std::span<const uint8_t>& x_idx, std::shared_ptr<ImageTexture>& texture)
@@ -625,7 +631,8 @@ void RemotePlayer::CreatePartialRowInterruptBlocks(uint8_t y_row_cnt, const std:
         CreateSingleIceBlock(x_idx[i], y_row_cnt, texture);
     }
 
-    score_info_.total_interrupt_block_count -= static_cast<uint16_t>(y_row_cnt * Constants::Board::BOARD_X_COUNT + x_idx.size());
+    const Garbage::Drop drop{ y_row_cnt, static_cast<int16_t>(x_idx.size()) };
+    score_info_.total_interrupt_block_count -= drop.GetCount();
 }
 
 void RemotePlayer::CreateSingleIceBlock(int x, int y, std::shared_ptr<ImageTexture>& texture)
@@ -678,7 +685,7 @@ void RemotePlayer::AttackInterruptBlock(float x, float y, uint8_t type)
         return;
     }
 
-    LOGGER.Error("1111111 RemotePlayer::AttackInterruptBlock");
+    LOG_GAMEPLAY(Error, "1111111 RemotePlayer::AttackInterruptBlock");
 
     bullet->SetAttacking(true);
     bullet_list_.push_back(bullet);*/
@@ -691,7 +698,7 @@ void RemotePlayer::AttackInterruptBlock(float x, float y, uint8_t type)
 
 void RemotePlayer::DefenseInterruptBlockCount(int16_t count, float x, float y, uint8_t type)
 {
-    score_info_.total_interrupt_block_count = std::max<uint16_t>(0, score_info_.total_interrupt_block_count - count);
+    score_info_.total_interrupt_block_count = Garbage::Cancel(score_info_.total_interrupt_block_count, count).pending;
     state_info_.has_ice_block = score_info_.total_interrupt_block_count > 0;    
 
     if (interrupt_view_)
@@ -699,25 +706,18 @@ void RemotePlayer::DefenseInterruptBlockCount(int16_t count, float x, float y, u
         interrupt_view_->UpdateInterruptBlock(score_info_.total_interrupt_block_count);
     }
 
-    const SDL_FPoint start_pos
-    {
-        Constants::Board::PLAYER_POSITION_X + Constants::Board::WIDTH_MARGIN + x + Constants::Block::SIZE / 2,
-        Constants::Board::PLAYER_POSITION_Y + y + Constants::Block::SIZE / 2
-    };
-
+    const SDL_FPoint start_pos = board_slot_.ToScreen(
+        Constants::Board::WIDTH_MARGIN + x + Constants::Block::SIZE / 2,
+        y + Constants::Block::SIZE / 2);
 
-    const SDL_FPoint end_pos
-    {
-        Constants::Board::PLAYER_POSITION_X + (Constants::Board::WIDTH / 2),
-        Constants::Board::PLAYER_POSITION_Y
-    };
+    const SDL_FPoint end_pos = board_slot_.ToScreen(Constants::Board::WIDTH / 2, 0);
 
     auto bullet = std::make_shared<BulletEffect>();
     if (!bullet->Initialize(start_pos, end_pos, static_cast<BlockType>(type)))
     {
         return;
     }
-    LOGGER.Error("1111111 RemotePlayer::DefenseInterruptBlockCount");
+    LOG_GAMEPLAY(Error, "1111111 RemotePlayer::DefenseInterruptBlockCount");
 
     bullet->SetAttacking(false);
     bullet_list_.push_back(bullet);
@@ -728,7 +728,7 @@ void RemotePlayer::DefenseInterruptBlockCount(int16_t count, float x, float y, u
     }
 }
 
-void RemotePlayer::AddNewBlock(const std::span<const uint8_t, 2>& block_type)
+void RemotePlayer::AddNewBlock(uint16_t pieceIndex)
 {
     // 최대 큐 크기 제한 상수 추가
     static constexpr size_t MAX_NEXT_BLOCKS = 3;
@@ -736,12 +736,14 @@ void RemotePlayer::AddNewBlock(const std::span<const uint8_t, 2>& block_type)
     // 큐 크기 검사 및 초과 블록 제거
     if (next_blocks_.size() >= MAX_NEXT_BLOCKS) 
     {
-        LOGGER.Info("RemotePlayer::AddNewBlock - Maximum block count reached ({}/{}), removing oldest block", next_blocks_.size(), MAX_NEXT_BLOCKS);
+        LOG_GAMEPLAY(Info, "RemotePlayer::AddNewBlock - Maximum block count reached ({}/{}), removing oldest block", next_blocks_.size(), MAX_NEXT_BLOCKS);
         next_blocks_.pop_front();
     }
 
+    const auto piece = MATCH_RANDOM.GetPiece(pieceIndex);
+
     auto next_block = std::make_shared<GroupBlock>();
-    if (!next_block->Create(static_cast<BlockType>(block_type[0]), static_cast<BlockType>(block_type[1])))
+    if (!next_block->Create(static_cast<BlockType>(piece[0]), static_cast<BlockType>(piece[1])))
     {
         throw std::runtime_error("Failed to create next block");
     }
@@ -755,7 +757,15 @@ void RemotePlayer::AddNewBlock(const std::span<const uint8_t, 2>& block_type)
 
         //LOGGER.Info("RemotePlayer::AddNewBlock - Added block, current queue size: {}", next_blocks_.size());
 
-        background_->SetPlayerNextBlock(next_block);
+        if (IsCompact())
+        {
+            // 축소 보드는 다음 블록 애니메이션 없이 바로 꺼낸다
+            PlayNextBlock();
+        }
+        else
+        {
+            background_->SetPlayerNextBlock(next_block);
+        }
     }
 }
 
@@ -781,15 +791,13 @@ void RemotePlayer::CreateBullet(Block* block)
 {
     if (!block)
     {
-        LOGGER.Error("CreateBullet: block is null");
+        LOG_GAMEPLAY(Error, "CreateBullet: block is null");
         return;
     }
 
-    SDL_FPoint startPos
-    {
-        Constants::Board::PLAYER_POSITION_X + Constants::Board::WIDTH_MARGIN + block->GetX() + Constants::Block::SIZE / 2,
-        Constants::Board::POSITION_Y + block->GetY() + Constants::Block::SIZE / 2
-    };
+    SDL_FPoint startPos = board_slot_.ToScreen(
+        Constants::Board::WIDTH_MARGIN + block->GetX() + Constants::Block::SIZE / 2,
+        block->GetY() + Constants::Block::SIZE / 2);
 
     SDL_FPoint endPos;
     if (state_info_.has_ice_block)
@@ -812,7 +820,7 @@ void RemotePlayer::CreateBullet(Block* block)
     auto bullet = std::make_shared<BulletEffect>();
     if (!bullet->Initialize(startPos, endPos, block->GetBlockType()))
     {
-        LOGGER.Error("Failed to create bullet effect");
+        LOG_GAMEPLAY(Error, "Failed to create bullet effect");
         return;
     }
 
@@ -832,8 +840,17 @@ void RemotePlayer::SyncPositionY(float targetY, float velocity)
     if (!control_block_)
         return;
 
+    // 보정을 권장 입력 지연(편도 지연 + 지터) 구간보다 짧게 끝내지 않아 지연이 흔들려도 위치가 튀지 않게 한다
+    const float delay_window = NETWORK.GetInputDelayFrames(GetPlayerID()) * Constants::Time::FIXED_STEP;
+    sync_lerp_factor_ = delay_window > 0.0f
+        ? std::min(base_sync_lerp_factor_, (1.0f / 60.0f) / delay_window)
+        : base_sync_lerp_factor_;
+
     // 현재 위치와 목표 위치의 차이가 크면 동기화 시작
     float current_y = control_block_->GetPosition().y;
+
+    // 동기화 오차 (--log-levels network=trace 로 켜고 링크 에뮬레이터 프로필별로 비교)
+    LOG_NETWORK(Trace, "Remote {} sync error {:.2f} lerp {:.3f}", GetPlayerID(), targetY - current_y, sync_lerp_factor_);
     if (std::abs(targetY - current_y) > 3.0f ||
         std::abs(velocity - control_block_->GetAddForceVelocityY()) > 0.5f)
     {
@@ -23,15 +23,13 @@ public:
     RemotePlayer();
     ~RemotePlayer() override;
 
-    bool Initialize(const std::span<const uint8_t>& blocktype1,
-        const std::span<const uint8_t>& blocktype2,
-        uint8_t playerIdx,
+    bool Initialize(uint8_t playerIdx,
         uint16_t characterIdx,
         const std::shared_ptr<GameBackground>& background) override;
 
     void Release() override;
     void Reset() override;
-    bool Restart(const std::span<const uint8_t>& blockType1 = {}, const std::span<const uint8_t>& blockType2 = {}) override;
+    bool Restart() override;
     void CreateNextBlock() override;
     void PlayNextBlock() override;
     bool CheckGameBlockState() override;
@@ -43,7 +41,7 @@ public:
     void UpdateFallingBlock(uint8_t fallingIdx, bool falling) override;
     void ChangeBlockState(uint8_t state) override;
     bool PushBlockInGame(const std::span<const float>& pos1, const std::span<const float>& pos2);
-    void AddNewBlock(const std::span<const uint8_t, 2>& block_type);
+    void AddNewBlock(uint16_t pieceIndex);
     void AttackInterruptBlock(float x, float y, uint8_t type) override;
     void DefenseInterruptBlockCount(int16_t count, float x, float y, uint8_t type) override;
 
@@ -62,9 +60,12 @@ public:
     //  ġ
     void SyncPositionY(float targetY, float velocity);
 
+    // --sync-lerp <factor>: ũ ķͷ     ⺻  
+    static void SetBaseSyncLerpFactor(float factor) { base_sync_lerp_factor_ = factor; }
+
 private:
     // ʱȭ ޼
-    void InitializeNextBlocks(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2);
+    void InitializeNextBlocks();
 
     //    ޼
     void CreateFullRowInterruptBlocks(std::shared_ptr<ImageTexture>& texture);
@@ -82,9 +83,13 @@ private:
     void UpdateComboDisplay(const SDL_FPoint& pos);
 
 private:
+    // 60Hz Ӵ   (ũ ų 鸮 SyncPositionY  δ)
+    static constexpr float DEFAULT_SYNC_LERP_FACTOR = 0.15f;
+    static inline float base_sync_lerp_factor_{ DEFAULT_SYNC_LERP_FACTOR };
+
     // ȭ 
     float target_y_position_{ 0.0f };
     float current_sync_velocity_{ 0.0f };
     bool is_syncing_position_{ false };
-    float sync_lerp_factor_{ 0.15f };
+    float sync_lerp_factor_{ DEFAULT_SYNC_LERP_FACTOR };
 };
\ No newline at end of file
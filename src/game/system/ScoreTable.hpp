@@ -0,0 +1,70 @@
+#pragma once
+/*
+*
+* :   ǥ (÷̾    м      д)
+* 1.   ܰ  =    * BASE_MATCH_SCORE * ( ʽ +  ʽ  + ׷  ʽ + 1)
+* 2.   ù ܰ谡 1 (BasePlayer::UpdateComboState  )
+*
+*/
+
+#include "../../core/common/constants/Constants.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ScoreTable
+{
+    [[nodiscard]] constexpr int16_t GetComboConstant(uint8_t comboCount)
+    {
+        if (comboCount <= 1)
+        {
+            return 0;
+        }
+
+        if (comboCount <= 4)
+        {
+            return static_cast<int16_t>(1 << (comboCount + 1));
+        }
+
+        if (comboCount <= Constants::Game::MAX_COMBO)
+        {
+            return static_cast<int16_t>(32 * (comboCount - 3));
+        }
+
+        return 0;
+    }
+
+    [[nodiscard]] constexpr uint8_t GetLinkBonus(size_t linkCount)
+    {
+        constexpr std::array<uint8_t, 8> LINK_BONUSES = { 0, 0, 0, 0, 2, 3, 4, 5 };
+
+        if (linkCount <= 4)
+        {
+            return 0;
+        }
+        else if (linkCount <= 10)
+        {
+            return LINK_BONUSES[linkCount - 4];
+        }
+        else
+        {
+            return Constants::Game::Score::MAX_LINK_BONUS;
+        }
+    }
+
+    [[nodiscard]] constexpr uint8_t GetTypeBonus(size_t groupCount)
+    {
+        constexpr std::array<uint8_t, 6> TYPE_BONUSES =
+        {
+            0, 0, 3, 6, 12, Constants::Game::Score::MAX_TYPE_BONUS
+        };
+        return groupCount < TYPE_BONUSES.size() ? TYPE_BONUSES[groupCount] : TYPE_BONUSES.back();
+    }
+
+    // bonus =  ʽ +  ʽ  + ׷  ʽ
+    [[nodiscard]] constexpr int GetStepScore(int blockCount, int bonus)
+    {
+        return (blockCount * Constants::Game::Score::BASE_MATCH_SCORE) * (bonus + 1);
+    }
+}
@@ -127,6 +127,18 @@ void InterruptBlockView::Render()
 
     const float startX = GetX();
 
+    if (draw_scale_ < 1.0f)
+    {
+        const float size = Constants::Block::SIZE * draw_scale_;
+
+        for (size_t i = 0; i < viewCount_; ++i)
+        {
+            const SDL_FRect destRect{ startX + size * i, GetY() + blocks_[i].height * draw_scale_, size, size };
+            blockTexture_->RenderScaled(&blocks_[i].rect, &destRect);
+        }
+        return;
+    }
+
     for (size_t i = 0; i < viewCount_; ++i) 
     {
         blockTexture_->Render(startX + (Constants::Block::SIZE * i),blocks_[i].height, &blocks_[i].rect);
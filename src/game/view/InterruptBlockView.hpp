@@ -76,6 +76,9 @@ public:
     void Render() override;
     void Release() override;
 
+    //      ׸  
+    void SetDrawScale(float scale) { draw_scale_ = scale; }
+
 private:
     void UpdateBlockRect(size_t index, InterruptBlockType type);
     SDL_Point GetBlockTexturePosition(InterruptBlockType type) const;
@@ -83,5 +86,6 @@ private:
     std::array<InterruptBlock, MAX_BLOCKS> blocks_{};
     std::shared_ptr<ImageTexture> blockTexture_;
     uint8_t viewCount_{ 0 };
+    float draw_scale_{ 1.0f };
     InterruptViewState state_{ InterruptViewState::Normal };
 };
@@ -11,14 +11,228 @@
 
 #include <SDL3/SDL_main.h>
 #include "./core/GameApp.hpp"
+#include "./core/MicroBenchmark.hpp"
+#include "./game/effect/ParticleBenchmark.hpp"
+#include "./game/analysis/ChainEvaluator.hpp"
+#include "./game/replay/MatchRecorder.hpp"
+#include "./game/replay/MatchReplay.hpp"
+#include "./game/replay/MatchPlayback.hpp"
+#include "./game/puzzle/NazoSolver.hpp"
+#include "./game/puzzle/PuzzleMode.hpp"
+#include "./game/system/GarbageEngine.hpp"
+#include "./game/system/FfaMatch.hpp"
+#include "./network/NetworkController.hpp"
+#include "./texture/RenderRecorder.hpp"
+#include "./resource/AssetPack.hpp"
+#include "./utils/LoggerBenchmark.hpp"
+#include "./utils/StartupProfiler.hpp"
+#include "./utils/FrameProfiler.hpp"
+#include "./network/link/LinkMonitor.hpp"
+#include "./network/link/LinkEmulator.hpp"
+#include "./game/system/RemotePlayer.hpp"
+
+#include <charconv>
+#include <string_view>
+#include <utility>
 
 
 SDL_AppResult SDL_AppInit(void** appState, int argc, char* argv[])
 {
+	// ù ӱ ð   
+	StartupProfiler::GetInstance();
+
+	const char* record_path = nullptr;
+	const char* spectate_address = nullptr;
+	int record_frames = RenderRecorder::DEFAULT_CAPTURE_FRAMES;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg(argv[i]);
+
+		if (arg == "--bench-particles")
+		{
+			ParticleBenchmark::LogResults(ParticleBenchmark::Run());
+			return SDL_APP_SUCCESS;
+		}
+		else if (arg == "--bench-logger")
+		{
+			LoggerBenchmark::LogResults(LoggerBenchmark::Run());
+			return SDL_APP_SUCCESS;
+		}
+		else if (arg == "--pack-assets")
+		{
+			const char* output = (i + 1 < argc) ? argv[i + 1] : AssetPack::DEFAULT_PACK_FILE;
+			return AssetPack::Build(output) ? SDL_APP_SUCCESS : SDL_APP_FAILURE;
+		}
+		else if (arg == "--log-levels" && i + 1 < argc)
+		{
+			LOGGER.ApplyLevelSpec(argv[++i]);
+		}
+		else if (arg == "--startup-trace")
+		{
+			const bool has_path = (i + 1 < argc) && std::string_view(argv[i + 1]).substr(0, 2) != "--";
+			STARTUP_PROFILER.SetOutputPath(has_path ? argv[++i] : StartupProfiler::DEFAULT_TRACE_FILE);
+		}
+		else if (arg == "--frame-stats" && i + 1 < argc)
+		{
+			FRAME_PROFILER.OpenStatsCsv(argv[++i]);
+		}
+		else if (arg == "--link-stats" && i + 1 < argc)
+		{
+			LINK_MONITOR.OpenStatsCsv(argv[++i]);
+		}
+		else if (arg == "--net-emu" && i + 1 < argc)
+		{
+			if (!LINK_EMULATOR.Configure(argv[++i]))
+			{
+				return SDL_APP_FAILURE;
+			}
+		}
+		else if (arg == "--net-emu-script" && i + 1 < argc)
+		{
+			if (!LINK_EMULATOR.LoadScript(argv[++i]))
+			{
+				return SDL_APP_FAILURE;
+			}
+		}
+		else if (arg == "--sync-lerp" && i + 1 < argc)
+		{
+			const std::string_view value(argv[++i]);
+			float factor = 0.0f;
+			if (std::from_chars(value.data(), value.data() + value.size(), factor).ec == std::errc() && factor > 0.0f)
+			{
+				RemotePlayer::SetBaseSyncLerpFactor(factor);
+			}
+		}
+		else if (arg == "--frame-trace")
+		{
+			const bool has_path = (i + 1 < argc) && std::string_view(argv[i + 1]).substr(0, 2) != "--";
+			FRAME_PROFILER.StartTraceCapture(FrameProfiler::DEFAULT_TRACE_FRAMES, has_path ? argv[++i] : FrameProfiler::DEFAULT_TRACE_FILE);
+		}
+		else if (arg == "--record-match")
+		{
+			const bool has_path = (i + 1 < argc) && std::string_view(argv[i + 1]).substr(0, 2) != "--";
+			MATCH_RECORDER.Enable(has_path ? argv[++i] : MatchRecorder::DEFAULT_DIRECTORY);
+		}
+		else if (arg == "--spectate" && i + 1 < argc)
+		{
+			spectate_address = argv[++i];
+		}
+		else if (arg == "--render-driver" && i + 1 < argc)
+		{
+			GAME_APP.SetRenderDriver(argv[++i]);
+		}
+		else if (arg == "--resource-budget" && i + 1 < argc)
+		{
+			const std::string_view value(argv[++i]);
+			size_t budget_mb = 0;
+			std::from_chars(value.data(), value.data() + value.size(), budget_mb);
+			GAME_APP.SetResourceBudget(budget_mb * 1024 * 1024);
+		}
+		else if (arg == "--record-render" && i + 1 < argc)
+		{
+			record_path = argv[++i];
+		}
+		else if (arg == "--record-frames" && i + 1 < argc)
+		{
+			const std::string_view value(argv[++i]);
+			std::from_chars(value.data(), value.data() + value.size(), record_frames);
+		}
+	}
+
+	if (auto bench = MicroBenchmark::ParseCommandLine(argc, argv))
+	{
+		const auto results = MicroBenchmark::Run(*bench);
+		MicroBenchmark::LogResults(results);
+
+		if (!bench->output_path.empty() && !MicroBenchmark::WriteJson(results, bench->output_path))
+		{
+			return SDL_APP_FAILURE;
+		}
+		return SDL_APP_SUCCESS;
+	}
+
+	if (auto info = MatchReplay::ParseCommandLine(argc, argv))
+	{
+		return MatchReplay::PrintInfo(*info) ? SDL_APP_SUCCESS : SDL_APP_FAILURE;
+	}
+
+	if (auto chain = ChainEvaluator::ParseCommandLine(argc, argv))
+	{
+		return ChainEvaluator::PrintReport(*chain) ? SDL_APP_SUCCESS : SDL_APP_FAILURE;
+	}
+
+	if (auto nazo = NazoSolver::ParseCommandLine(argc, argv))
+	{
+		return NazoSolver::Run(*nazo) ? SDL_APP_SUCCESS : SDL_APP_FAILURE;
+	}
+
+	if (auto garbage = Garbage::ParseCommandLine(argc, argv))
+	{
+		return Garbage::RunCheck(*garbage) ? SDL_APP_SUCCESS : SDL_APP_FAILURE;
+	}
+
+	if (auto match = MatchPlayback::ParseCommandLine(argc, argv))
+	{
+		if (!MATCH_PLAYBACK.Open(*match))
+		{
+			return SDL_APP_FAILURE;
+		}
+	}
+	else if (auto puzzle = PuzzleMode::ParseCommandLine(argc, argv))
+	{
+		if (!PUZZLE_MODE.Open(*puzzle))
+		{
+			return SDL_APP_FAILURE;
+		}
+	}
+
+	if (auto policy = FfaMatch::ParseCommandLine(argc, argv))
+	{
+		FFA_MATCH.SetPolicy(*policy);
+	}
+
+	if (auto replay = RenderReplay::ParseCommandLine(argc, argv))
+	{
+		GAME_APP.EnableRenderReplay(std::move(*replay));
+	}
+	else if (auto headless = HeadlessRunner::ParseCommandLine(argc, argv))
+	{
+		GAME_APP.EnableHeadless(std::move(*headless));
+	}
+
 	if (!GAME_APP.Initialize()) 
 	{
 		return SDL_APP_FAILURE;
 	}
+
+	if (MATCH_PLAYBACK.IsActive())
+	{
+		MATCH_PLAYBACK.EnterGame();
+	}
+	else if (PUZZLE_MODE.IsActive())
+	{
+		PUZZLE_MODE.EnterGame();
+	}
+
+	// 濡  ʰ   äο 
+	if (spectate_address)
+	{
+		NETWORK.Initialize(NetworkRole::Client);
+		NETWORK.SetAddress(spectate_address);
+		NETWORK.SetSpectator(true);
+
+		if (!NETWORK.Start())
+		{
+			return SDL_APP_FAILURE;
+		}
+	}
+
+	// ù Ӻ  Ŀǵ带 
+	if (record_path && !GAME_APP.IsRenderReplay())
+	{
+		RENDER_RECORDER.StartCapture(record_frames, record_path);
+	}
 	return SDL_APP_CONTINUE;
 }
 
@@ -38,6 +252,12 @@ SDL_AppResult SDL_AppIterate(void* appState)
 {
 	GAME_APP.MainLoop();
 
+	// 帮 ũƮ/  Ǵ    
+	if (!GAME_APP.IsGameRunning())
+	{
+		return SDL_APP_SUCCESS;
+	}
+
 	return SDL_APP_CONTINUE;
 }
 
@@ -5,6 +5,7 @@
 #include "../network/player/Player.hpp"
 #include "../core/manager/PlayerManager.hpp"
 #include "../core/GameApp.hpp"
+#include "./link/LinkMonitor.hpp"
 
 #include <format>
 #include <algorithm>
@@ -27,6 +28,22 @@ void GameClient::Exit()
     NetClient::Exit();
 }
 
+void GameClient::Update()
+{
+    PongPacket pong;
+    while (pong_queue_.try_pop(pong))
+    {
+        LINK_MONITOR.StampPong(pong);
+        SendPacketInternal(pong);
+    }
+
+    PingPacket packet;
+    if (IsConnected() && LINK_MONITOR.PollPing(LinkMonitor::SERVER_LINK, packet))
+    {
+        SendPacketInternal(packet);
+    }
+}
+
 void GameClient::ProcessConnectExit()
 {
     NetClient::ProcessConnectExit();
@@ -73,17 +90,17 @@ void GameClient::DecideCharacter(uint8_t x, uint8_t y)
     SendPacketInternal(packet);
 }
 
-void GameClient::AddNewBlock(std::span<const uint8_t> block)
+void GameClient::AddNewBlock(uint16_t pieceIndex)
 {
     AddNewBlockPacket packet;
 
     packet.player_id = GAME_APP.GetPlayerManager().GetMyPlayer()->GetId();
-    std::copy_n(block.begin(), std::min<size_t>(block.size(), 2), packet.block_type.begin());
+    packet.piece_index = pieceIndex;
 
     SendPacketInternal(packet);
 }
 
-void GameClient::GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2) 
+void GameClient::GameInitialize() 
 {
     if (const auto& myPlayer = GAME_APP.GetPlayerManager().GetMyPlayer(); myPlayer != nullptr)
     {
@@ -91,16 +108,6 @@ void GameClient::GameInitialize(std::span<const uint8_t> block1, std::span<const
         packet.player_id = myPlayer->GetId();
         packet.character_idx = myPlayer->GetCharacterId();
 
-        if (block1.size() >= 2) 
-        {
-            std::copy_n(block1.data(), 2, packet.block_type1.begin());
-        }
-
-        if (block2.size() >= 2) 
-        {
-            std::copy_n(block2.data(), 2, packet.block_type2.begin());
-        }
-
         SendPacketInternal(packet);
     }
 }
@@ -255,20 +262,11 @@ void GameClient::LoseGame()
     SendPacketInternal(packet);
 }
 
-void GameClient::ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2) {
+void GameClient::ReStartGame(uint32_t seed) {
 
     RestartGamePacket packet;
     packet.player_id = GAME_APP.GetPlayerManager().GetMyPlayer()->GetId();
-
-    if (block1.size() >= 2) 
-    {
-        std::copy_n(block1.data(), 2, packet.block1.begin());
-    }
-
-    if (block2.size() >= 2) 
-    {
-        std::copy_n(block2.data(), 2, packet.block2.begin());
-    }
+    packet.seed = seed;
 
     SendPacketInternal(packet);
 }
@@ -278,9 +276,65 @@ void GameClient::ProcessPacket(std::span<const char> packet)
     if (packet.size() < sizeof(PacketBase))
         return;
 
+    //   ¿   信 
+    const auto* basePacket = reinterpret_cast<const PacketBase*>(packet.data());
+    if (basePacket->type == static_cast<uint16_t>(PacketType::SpectatorFrame))
+    {
+        ProcessSpectatorFrame(*reinterpret_cast<const SpectatorFramePacket*>(packet.data()));
+        return;
+    }
+
+    // ũ   ó ġ ʰ  忡  ð ´ (Pong  Update  )
+    if (basePacket->type == static_cast<uint16_t>(PacketType::Ping) && packet.size() == sizeof(PingPacket))
+    {
+        pong_queue_.push(LINK_MONITOR.MakePong(*reinterpret_cast<const PingPacket*>(packet.data())));
+        return;
+    }
+
+    if (basePacket->type == static_cast<uint16_t>(PacketType::Pong) && packet.size() == sizeof(PongPacket))
+    {
+        LINK_MONITOR.OnPong(*reinterpret_cast<const PongPacket*>(packet.data()));
+        return;
+    }
+
     std::string_view message(packet.data(), packet.size());
     uint8_t connectionId = 0;
     uint32_t length = static_cast<uint32_t>(packet.size());
 
     GAME_APP.GetStateManager().HandleNetworkMessage(connectionId, message, length);
 }
+
+void GameClient::ProcessSpectatorFrame(const SpectatorFramePacket& packet)
+{
+    const bool wasSynced = spectator_view_.IsSynced();
+
+    if (!spectator_view_.Apply(packet.GetFrame(), spectator_markers_))
+    {
+        LOG_NETWORK(Warning, "Invalid spectator frame ({} bytes)", packet.GetFrame().size());
+        return;
+    }
+
+    if (spectator_view_.IsSynced() != wasSynced)
+    {
+        LOG_NETWORK(Info, "Spectator view {} at tick {}", spectator_view_.IsSynced() ? "synced" : "waiting for keyframe", spectator_view_.GetTick());
+    }
+
+    for (const auto& marker : spectator_markers_)
+    {
+        switch (marker.type)
+        {
+        case Spectator::MarkerType::ChainStart:
+        case Spectator::MarkerType::ChainStep:
+            LOG_NETWORK(Info, "[Spectate] player {} chain {}", marker.player_id, marker.value);
+            break;
+        case Spectator::MarkerType::GarbageSent:
+            LOG_NETWORK(Info, "[Spectate] player {} sent {} garbage", marker.player_id, marker.value);
+            break;
+        case Spectator::MarkerType::GameOver:
+            LOG_NETWORK(Info, "[Spectate] player {} game over", marker.player_id);
+            break;
+        default:
+            break;
+        }
+    }
+}
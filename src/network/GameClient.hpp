@@ -9,8 +9,10 @@
 #include "CriticalSection.hpp"
 #include "../network/packets/PacketBase.hpp"
 #include "../network/packets/GamePackets.hpp"
+#include "spectator/SpectatorFrame.hpp"
 
 #include <concepts>
+#include <concurrent_queue.h>
 
 
 class GameClient final : public NetClient 
@@ -27,12 +29,15 @@ public:
     bool Start(HWND hwnd) override;
     void Exit() override;
 
+    //    :  ũ ƮƮ
+    void Update();
+
     //   Ŷ  Լ
     void ChatMessage(std::string_view msg);
     void ChangeCharSelect(uint8_t x, uint8_t y);
     void DecideCharacter(uint8_t x, uint8_t y);
-    void GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
-    void AddNewBlock(std::span<const uint8_t> block);
+    void GameInitialize();
+    void AddNewBlock(uint16_t pieceIndex);
     void MoveBlock(uint8_t moveType, float position);
     void RotateBlock(uint8_t rotateType, bool isHorizontalMoving);
     void CheckBlockState();
@@ -49,7 +54,10 @@ public:
     void AddInterruptBlock(uint8_t yRowCnt, uint8_t xCnt, std::span<const uint8_t> xIdx);
     void StopComboAttack();
     void LoseGame();
-    void ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
+    void ReStartGame(uint32_t seed);
+
+    //     (--spectate)
+    [[nodiscard]] const Spectator::FrameDecoder& GetSpectatorView() const { return spectator_view_; }
 
 protected:
     void ProcessPacket(std::span<const char> packet) override;
@@ -63,6 +71,13 @@ private:
         SendData(std::span<const char>(packetBytes.data(), packetBytes.size()));
     }
 
+    void ProcessSpectatorFrame(const SpectatorFramePacket& packet);
+
     CriticalSection critical_section_{};
     uint8_t player_id_{ 0 };
+
+    Concurrency::concurrent_queue<PongPacket> pong_queue_{};
+
+    Spectator::FrameDecoder spectator_view_;
+    std::vector<Spectator::Marker> spectator_markers_;
 };
@@ -14,6 +14,11 @@
 #include "./packets/processors/BlockPacketProcessors.hpp"
 #include "./packets/processors/CombatPacketProcessors.hpp"
 #include "./packets/processors/GameInitPacketProcessors.hpp"
+#include "./packets/processors/SpectatorPacketProcessors.hpp"
+#include "./spectator/SpectatorBroadcaster.hpp"
+#include "../game/system/FfaMatch.hpp"
+#include "./link/LinkMonitor.hpp"
+#include "./link/LinkEmulator.hpp"
 
 #include <format>
 #include <unordered_map>
@@ -62,6 +67,9 @@ void GameServer::InitializePacketProcessors()
     packet_processors_.emplace(PacketType::InitializePlayer, std::make_unique<InitializePlayerProcessor>());
     packet_processors_.emplace(PacketType::RestartGame, std::make_unique<RestartGameProcessor>());
 
+    //   μ
+    packet_processors_.emplace(PacketType::SpectateRequest, std::make_unique<SpectateRequestProcessor>());
+
     //  μ ʱȭ
     for (auto& [_, processor] : packet_processors_) 
     {
@@ -71,6 +79,21 @@ void GameServer::InitializePacketProcessors()
 
 void GameServer::Update()
 {
+    SendHeartbeats();
+
+    // ķͰ   Ŷ Deliver   Ƿ ť ġ ʰ ٷ óѴ
+    if (LINK_EMULATOR.IsEnabled())
+    {
+        LINK_EMULATOR.Deliver([this](uintptr_t source, std::span<const char> packet)
+            {
+                auto* client = reinterpret_cast<ClientInfo*>(source);
+                if (!ProcessLinkPacket(client, packet))
+                {
+                    ProcessPacket(ProcessEvent(packet, client));
+                }
+            });
+    }
+
     ProcessEvent event;
     while (msg_queue_.try_pop(event))
     {
@@ -89,11 +112,35 @@ void GameServer::Update()
     }
 }
 
+void GameServer::SendHeartbeats()
+{
+    std::pair<ClientInfo*, PongPacket> pending;
+    while (pong_queue_.try_pop(pending))
+    {
+        auto& [client, pong] = pending;
+        LINK_MONITOR.StampPong(pong);
+        (void)SendMsg(client, std::span<const char>{ reinterpret_cast<const char*>(&pong), pong.size });
+    }
+
+    auto& playerManager = GAME_APP.GetPlayerManager();
+    CriticalSection::Lock lock(playerManager.GetCriticalSection());
+
+    for (const auto& [id, player] : playerManager.GetPlayers())
+    {
+        //  ڽ NetInfo  
+        PingPacket packet;
+        if (player && player->GetNetInfo() && LINK_MONITOR.PollPing(id, packet))
+        {
+            (void)SendMsg(player->GetNetInfo(), std::span<const char>{ reinterpret_cast<const char*>(&packet), packet.size });
+        }
+    }
+}
+
 void GameServer::ProcessPacket(const ProcessEvent& event)
 {
     if (event.packet_data.empty() || event.packet_data.size() < sizeof(PacketBase))
     {
-        LOGGER.Warning("Invalid packet data");
+        LOG_NETWORK(Warning, "Invalid packet data");
         return;
     }
 
@@ -104,14 +151,14 @@ void GameServer::ProcessPacket(const ProcessEvent& event)
     // Ŷ Ÿ 
     if (!IsValidPacketType(packetType))
     {
-        LOGGER.Warning("Invalid packet type: {}", static_cast<int>(packetType));
+        LOG_NETWORK(Warning, "Invalid packet type: {}", static_cast<int>(packetType));
         return;
     }
 
     // Ŷ ũ 
     if (event.packet_data.size() != basePacket->size)
     {
-        LOGGER.Warning("Invalid packet size. Expected: {}, Actual: {}",
+        LOG_NETWORK(Warning, "Invalid packet size. Expected: {}, Actual: {}",
             basePacket->size, event.packet_data.size());
         return;
     }
@@ -120,14 +167,47 @@ void GameServer::ProcessPacket(const ProcessEvent& event)
     auto it = packet_processors_.find(packetType);
     if (it == packet_processors_.end())
     {
-        LOGGER.Warning("No processor found for packet type: {}", static_cast<int>(packetType));
+        LOG_NETWORK(Warning, "No processor found for packet type: {}", static_cast<int>(packetType));
         return;
     }
 
+    LOG_NETWORK(Trace, "Server process type={} size={}", static_cast<int>(packetType), basePacket->size);
+
     // Ŷ ó
     it->second->Process(*basePacket, event.client_info);
 }
 
+//  ڽ  Ŷ Ŭ̾Ʈ  Ŷ  μ ó
+void GameServer::ProcessLocalPacket(const PacketBase& packet)
+{
+    auto it = packet_processors_.find(static_cast<PacketType>(packet.type));
+    if (it != packet_processors_.end())
+    {
+        it->second->Process(packet, nullptr);
+    }
+}
+
+void GameServer::SendPacketTo(const PacketBase& packet, std::span<const uint8_t> playerIds)
+{
+    if (playerIds.empty())
+    {
+        return;
+    }
+
+    auto send_data = std::make_shared<SendQueueData>(std::span<const char>{ reinterpret_cast<const char*>(&packet), packet.size });
+
+    auto& playerManager = GAME_APP.GetPlayerManager();
+    CriticalSection::Lock lock(playerManager.GetCriticalSection());
+
+    for (const uint8_t id : playerIds)
+    {
+        if (auto player = playerManager.FindPlayer(id))
+        {
+            (void)SendShared(player->GetNetInfo(), send_data);
+        }
+    }
+}
+
 bool GameServer::StartServer() 
 {
     //  ÷̾  (ID: 1)
@@ -148,10 +228,24 @@ bool GameServer::ExitServer()
 {
     unique_player_id_ = 1;
 
+    spectator_relay_.Clear();
     GAME_APP.GetPlayerManager().Release();
     return NetServer::ExitServer();
 }
 
+uint8_t GameServer::GenerateUniqueId()
+{
+    // ڵ Ӹ ID  Ƿ    0( ڽ) 濡 ִ ÷̾ ID  ǳʶڴ
+    auto& playerManager = GAME_APP.GetPlayerManager();
+
+    uint8_t id = unique_player_id_++;
+    while (id == 0 || playerManager.FindPlayer(id))
+    {
+        id = unique_player_id_++;
+    }
+    return id;
+}
+
 bool GameServer::ConnectProcess(ClientInfo* client)
 {
     // ο Ŭ̾Ʈ ӽ ID ο
@@ -172,10 +266,13 @@ bool GameServer::DisconnectProcess(ClientInfo* client)
         return false;
     }
         
+    spectator_relay_.Unsubscribe(client);
+    LINK_EMULATOR.DiscardSource(reinterpret_cast<uintptr_t>(client));
     CloseSocket(client);
 
 
     uint8_t player_id = GAME_APP.GetPlayerManager().RemovePlayerInRoom(client);
+    LINK_MONITOR.RemoveLink(player_id);
 
     msg_queue_.push(ProcessEvent(player_id));
 
@@ -226,6 +323,18 @@ void GameServer::ProcessDisconnectEvent(uint8_t player_id)
 
 bool GameServer::PacketProcess(ClientInfo* client, std::span<const char> packet_data) 
 {
+    // ũ ķͰ    ð  ξٰ Update  ó
+    if (LINK_EMULATOR.IsEnabled())
+    {
+        LINK_EMULATOR.Push(reinterpret_cast<uintptr_t>(client), packet_data);
+        return true;
+    }
+
+    if (ProcessLinkPacket(client, packet_data))
+    {
+        return true;
+    }
+
     ProcessEvent event;
     event.packet_data = packet_data;
     event.client_info = client;
@@ -235,6 +344,31 @@ bool GameServer::PacketProcess(ClientInfo* client, std::span<const char> packet_
     return true;
 }
 
+bool GameServer::ProcessLinkPacket(ClientInfo* client, std::span<const char> packet_data)
+{
+    // ũ  ޽ ť ġ ʰ  ð ٷ ´ (Pong  Update  )
+    if (packet_data.size() < sizeof(PacketBase))
+    {
+        return false;
+    }
+
+    const auto* basePacket = reinterpret_cast<const PacketBase*>(packet_data.data());
+
+    if (basePacket->type == static_cast<uint16_t>(PacketType::Ping) && packet_data.size() == sizeof(PingPacket))
+    {
+        pong_queue_.push({ client, LINK_MONITOR.MakePong(*reinterpret_cast<const PingPacket*>(packet_data.data())) });
+        return true;
+    }
+
+    if (basePacket->type == static_cast<uint16_t>(PacketType::Pong) && packet_data.size() == sizeof(PongPacket))
+    {
+        LINK_MONITOR.OnPong(*reinterpret_cast<const PongPacket*>(packet_data.data()));
+        return true;
+    }
+
+    return false;
+}
+
 // ĳ  
 void GameServer::StartCharacterSelect() 
 {
@@ -295,7 +429,7 @@ void GameServer::StartGame()
     BroadcastPacket(packet);
 }
 
-void GameServer::ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx)
+void GameServer::ReStartGame(uint32_t seed, uint8_t map_idx)
 {
     CriticalSection::Lock lock(critical_section_);
 
@@ -309,14 +443,12 @@ void GameServer::ReStartGame(std::span<const uint8_t> block1, std::span<const ui
     RestartGamePacket packet;
     packet.player_id = myPlayer->GetId();
     packet.map_id = map_idx;
-
-    std::copy_n(block1.begin(), packet.block1.size(), packet.block1.begin());
-    std::copy_n(block2.begin(), packet.block2.size(), packet.block2.begin());
+    packet.seed = seed;
 
     BroadcastPacket(packet);
 }
 
-void GameServer::GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx)
+void GameServer::GameInitialize(uint32_t seed, uint8_t map_idx)
 {
     CriticalSection::Lock lock(critical_section_);
 
@@ -331,9 +463,7 @@ void GameServer::GameInitialize(std::span<const uint8_t> block1, std::span<const
     packet.player_id = myPlayer->GetId();
     packet.character_id = myPlayer->GetCharacterId();
     packet.map_id = map_idx;
-
-    std::copy_n(block1.begin(), packet.block1.size(), packet.block1.begin());
-    std::copy_n(block2.begin(), packet.block2.size(), packet.block2.begin());
+    packet.seed = seed;
 
     BroadcastPacket(packet);
 }
@@ -351,12 +481,18 @@ void GameServer::LoseGame()
     LoseGamePacket packet;
     packet.player_id = myPlayer->GetId();
 
+    if (FFA_MATCH.IsActive())
+    {
+        ProcessLocalPacket(packet);
+        return;
+    }
+
     BroadcastPacket(packet);
 }
 
 
 //   
-void GameServer::AddNewBlock(std::span<const uint8_t> block)
+void GameServer::AddNewBlock(uint16_t pieceIndex)
 {
     CriticalSection::Lock lock(critical_section_);
 
@@ -368,9 +504,7 @@ void GameServer::AddNewBlock(std::span<const uint8_t> block)
 
     AddNewBlockPacket packet;
     packet.player_id = myPlayer->GetId();
-
-    std::copy_n(block.begin(), packet.block_type.size(), packet.block_type.begin());
-        
+    packet.piece_index = pieceIndex;
 
     BroadcastPacket(packet);
 }
@@ -505,7 +639,7 @@ void GameServer::SyncPositionY(float positionY, float velocity)
 
     auto& playerManager = GAME_APP.GetPlayerManager();
     auto myPlayer = playerManager.GetMyPlayer();
-    if (!myPlayer) {
+    if (!myPlayer || !FFA_MATCH.ShouldRelayPositionSync(myPlayer->GetId())) {
         return;
     }
 
@@ -537,7 +671,16 @@ void GameServer::AttackInterruptBlock(int16_t count, float x, float y, uint8_t t
     packet.position_y = y;
     packet.block_type = type;
 
+    //    ڽ Ŷ Ŭ̾Ʈ Ŷ  η /  ó
+    if (FFA_MATCH.IsActive())
+    {
+        ProcessLocalPacket(packet);
+        return;
+    }
+
     BroadcastPacket(packet);
+
+    SPECTATOR_BROADCASTER.MarkGarbageSent(packet.player_id, count);
 }
 
 void GameServer::DefenseInterruptBlock(int16_t count, float x, float y, uint8_t type)
@@ -557,6 +700,12 @@ void GameServer::DefenseInterruptBlock(int16_t count, float x, float y, uint8_t
     packet.position_y = y;
     packet.block_type = type;
 
+    if (FFA_MATCH.IsActive())
+    {
+        ProcessLocalPacket(packet);
+        return;
+    }
+
     BroadcastPacket(packet);
 }
 
@@ -580,6 +729,12 @@ void GameServer::AddInterruptBlock(uint8_t yRowCnt, uint8_t xCnt, std::span<cons
         std::copy_n(xIdx.begin(), packet.x_indices.size(), packet.x_indices.begin());
     }
 
+    if (FFA_MATCH.IsActive())
+    {
+        ProcessLocalPacket(packet);
+        return;
+    }
+
     BroadcastPacket(packet);
 }
 
@@ -596,6 +751,12 @@ void GameServer::StopComboAttack()
     StopComboPacket packet;
     packet.player_id = myPlayer->GetId();
 
+    if (FFA_MATCH.IsActive())
+    {
+        ProcessLocalPacket(packet);
+        return;
+    }
+
     BroadcastPacket(packet);
 }
 
@@ -617,4 +778,16 @@ void GameServer::ChatMessage(std::string_view msg)
     BroadcastPacket(packet);
 }
 
+//  
+void GameServer::PublishSpectatorFrame(std::span<const uint8_t> frame, bool isKeyframe)
+{
+    SpectatorFramePacket packet;
+    if (!packet.SetFrame(frame))
+    {
+        LOG_NETWORK(Warning, "Spectator frame too large: {} bytes", frame.size());
+        return;
+    }
 
+    // Ŷ Ʈ    ̰  ڿ  ۸ 
+    spectator_relay_.Publish(std::span<const char>(reinterpret_cast<const char*>(&packet), packet.size), isKeyframe);
+}
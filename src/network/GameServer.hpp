@@ -7,6 +7,7 @@
 
 #include "./NetServer.hpp"
 #include "./CriticalSection.hpp"
+#include "./spectator/SpectatorRelay.hpp"
 #include "./packets/GamePackets.hpp"
 #include "./packets/processors/IPacketProcessor.hpp"
 #include "./packets/PacketType.hpp"
@@ -17,6 +18,7 @@
 
 #include <queue>
 #include <memory>
+#include <utility>
 #include <unordered_map>
 #include <string_view>
 
@@ -63,15 +65,16 @@ public:
     bool ExitServer();
     void Update();
 
-    // Ŷ   Լ
+    // Ŷ   Լ (Ŷ Ʈ    ޴ ÷̾   ۸ )
     template<typename PacketType> requires std::derived_from<PacketType, PacketBase>
     void BroadcastPacket(const PacketType& packet, uint8_t exclude_id = 0);
+    void SendPacketTo(const PacketBase& packet, std::span<const uint8_t> playerIds);
                 
 
     //  /ʱȭ 
     void StartGame();
-    void GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx);
-    void ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx);
+    void GameInitialize(uint32_t seed, uint8_t map_idx);
+    void ReStartGame(uint32_t seed, uint8_t map_idx);
     void LoseGame();
 
     // ĳ  
@@ -81,7 +84,7 @@ public:
 
 
     //   
-    void AddNewBlock(std::span<const uint8_t> block);
+    void AddNewBlock(uint16_t pieceIndex);
     void MoveBlock(uint8_t moveType, float position);
     void RotateBlock(uint8_t rotateType, bool bHorizontalMoving);
     void CheckBlockState();
@@ -98,6 +101,10 @@ public:
     void StopComboAttack();
     void ChatMessage(std::string_view msg);
 
+    //  
+    [[nodiscard]] SpectatorRelay& GetSpectatorRelay() { return spectator_relay_; }
+    void PublishSpectatorFrame(std::span<const uint8_t> frame, bool isKeyframe);
+
 protected:
     // NetServer ̽ 
     bool ConnectProcess(ClientInfo* client) override;
@@ -108,33 +115,35 @@ protected:
 private:
 
     void ProcessPacket(const ProcessEvent& event);
+    void ProcessLocalPacket(const PacketBase& packet);
     void InitializePacketProcessors();        
     void ProcessDisconnectEvent(uint8_t player_id);
-    uint8_t GenerateUniqueId() { return unique_player_id_++; }
+    void SendHeartbeats();
+    bool ProcessLinkPacket(ClientInfo* client, std::span<const char> packet_data);
+    uint8_t GenerateUniqueId();
 
     CriticalSection critical_section_{};
     uint8_t unique_player_id_{ 1 };  // 0  ڽ
     Concurrency::concurrent_queue<ProcessEvent> msg_queue_{};
+    Concurrency::concurrent_queue<std::pair<ClientInfo*, PongPacket>> pong_queue_{};
     PacketProcessorMap packet_processors_{};
+    SpectatorRelay spectator_relay_{ *this };
 };
 
 template<typename PacketType> requires std::derived_from<PacketType, PacketBase>
 void GameServer::BroadcastPacket(const PacketType& packet, uint8_t exclude_id)
 {
+    auto send_data = std::make_shared<SendQueueData>(std::span<const char>{ reinterpret_cast<const char*>(&packet), packet.size });
+
     auto& playerManager = GAME_APP.GetPlayerManager();
-    PlayerManager::PlayerMap players = playerManager.GetPlayers();
+    CriticalSection::Lock lock(playerManager.GetCriticalSection());
 
-    for (auto it = players.begin(); it != players.end(); ++it)
+    for (const auto& [id, player] : playerManager.GetPlayers())
     {
-        const auto& player = it->second;
-        if (player && player->GetId() != exclude_id)
+        //  ڽ NetInfo  Ƿ SendShared  ǳʶڴ
+        if (player && id != exclude_id)
         {
-            auto packetBytes = packet.ToBytes();
-            auto packet_data = std::span<const char>{ packetBytes.data(), packetBytes.size()};
-
-            if (SendMsg(player->GetNetInfo(), packet_data) == false)
-            {
-            }
+            (void)SendShared(player->GetNetInfo(), send_data);
         }
     }
 }
@@ -5,6 +5,7 @@
 #include <format>
 #include <span>
 #include "NetworkController.hpp"
+#include "./link/LinkEmulator.hpp"
 #include "../utils/Logger.hpp"
 
 NetClient::~NetClient()
@@ -174,6 +175,8 @@ void NetClient::Disconnect(bool force)
 
     socket_.close();
     is_connected_ = false;
+
+    LINK_EMULATOR.DiscardSource(SERVER_SOURCE);
 }
 
 bool NetClient::ProcessRecv(WPARAM wParam, LPARAM lParam)
@@ -246,8 +249,15 @@ bool NetClient::ProcessRecv(WPARAM wParam, LPARAM lParam)
                 break; //    ʿ
             }
 
-            // Ŷ ó
-            ProcessPacket(std::span<const char>(packet, packetBase.size));
+            // Ŷ ó (ũ ķͰ    ð ̷)
+            if (LINK_EMULATOR.IsEnabled())
+            {
+                LINK_EMULATOR.Push(SERVER_SOURCE, std::span<const char>(packet, packetBase.size));
+            }
+            else
+            {
+                ProcessPacket(std::span<const char>(packet, packetBase.size));
+            }
 
             //     ũ Ʈ
             recv_remain_size_ -= packetBase.size;
@@ -291,7 +301,8 @@ void NetClient::EventPollingThreadFunc()
 {
     while (polling_thread_running_) 
     {
-        DWORD result = WSAWaitForMultipleEvents(1, &event_handle_, FALSE, 100, FALSE);
+        const DWORD timeout = LINK_EMULATOR.IsEnabled() ? LINK_EMULATOR.GetWaitMs(100) : 100;
+        DWORD result = WSAWaitForMultipleEvents(1, &event_handle_, FALSE, timeout, FALSE);
 
         if (result == WSA_WAIT_EVENT_0) 
         {
@@ -305,7 +316,7 @@ void NetClient::EventPollingThreadFunc()
                         // б ̺Ʈ ó
                         if (ProcessRecv(static_cast<WPARAM>(socket_.get()), static_cast<LPARAM>(FD_READ)) == false)
                         {
-                            LOGGER.Error("ProcessRecv Failed");
+                            LOG_NETWORK(Error, "ProcessRecv Failed");
                         }
                     }
                 }
@@ -315,7 +326,7 @@ void NetClient::EventPollingThreadFunc()
                     //   ̺Ʈ ó
                     if (ProcessRecv(static_cast<WPARAM>(socket_.get()), static_cast<LPARAM>(FD_CLOSE)) == false)
                     {
-						LOGGER.Error("ProcessRecv Failed");
+						LOG_NETWORK(Error, "ProcessRecv Failed");
                     }
                 }
                 //// SDL ̺Ʈ 
@@ -334,5 +345,10 @@ void NetClient::EventPollingThreadFunc()
                 //WSAResetEvent(event_handle_);
             }
         }
+
+        if (LINK_EMULATOR.IsEnabled())
+        {
+            LINK_EMULATOR.Deliver([this](uintptr_t, std::span<const char> packet) { ProcessPacket(packet); });
+        }
     }
 }
@@ -33,6 +33,7 @@ public:
     void Disconnect(bool force = false);
 
     void SendData(std::span<const char> data);
+    [[nodiscard]] bool IsConnected() const { return is_connected_; }
     [[nodiscard]] bool ProcessRecv(WPARAM wParam, LPARAM lParam);    
     
 protected:
@@ -43,6 +44,9 @@ protected:
     //void HandleNetworkEvent(SOCKET socket, LONG event_type);
 
 private:
+    // ũ ķͿ   Ŷ ϴ 
+    static constexpr uintptr_t SERVER_SOURCE = 0;
+
     // Ŀ   
     //static unsigned int CALLBACK WorkerThread(void* arg);
     //[[nodiscard]] bool CreateWorkerThread();
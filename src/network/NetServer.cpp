@@ -5,7 +5,7 @@
 #include "../utils/Logger.hpp"
 
 NetServer::NetServer() :
-    clients_(std::make_unique<ClientInfo[]>(Constants::Network::MAX_CLIENT))
+    clients_(std::make_unique<ClientInfo[]>(Constants::Network::MAX_CONNECTION))
 {
 }
 
@@ -272,7 +272,7 @@ void NetServer::ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD
     {
         if (BindRecv(client, processed_pos, overlapped->receive_size) == false)
         {
-            LOGGER.Error("BindRecv Failed");
+            LOG_NETWORK(Error, "BindRecv Failed");
         }
         return;
     }
@@ -337,7 +337,7 @@ void NetServer::ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD
     //   ۾ 
     if (BindRecv(client, processed_pos, remain_size) == false)
     {
-		LOGGER.Error("BindRecv Failed");
+		LOG_NETWORK(Error, "BindRecv Failed");
     }
 }
 
@@ -465,7 +465,15 @@ bool NetServer::SendMsg(ClientInfo* client, std::span<const char> msg)
     }
 
     //   
-    auto send_data = std::make_shared<SendQueueData>(msg);
+    return SendShared(client, std::make_shared<SendQueueData>(msg));
+}
+
+bool NetServer::SendShared(ClientInfo* client, const std::shared_ptr<SendQueueData>& send_data)
+{
+    if (!client || !client->socket.is_valid() || !send_data || send_data->buffer.empty())
+    {
+        return false;
+    }
 
     //  ü 
     client->send_overlapped.operation = OperationType::Send;
@@ -539,7 +547,7 @@ bool NetServer::ExitServer()
 {
     DestroyThread();
 
-    for (size_t i = 0; i < Constants::Network::MAX_CLIENT; ++i) 
+    for (size_t i = 0; i < Constants::Network::MAX_CONNECTION; ++i) 
     {
         if (clients_[i].socket.is_valid()) 
         {
@@ -589,7 +597,7 @@ void NetServer::DestroyThread() {
 
 ClientInfo* NetServer::GetEmptyClientInfo() 
 {
-    for (size_t i = 0; i < Constants::Network::MAX_CLIENT; ++i)
+    for (size_t i = 0; i < Constants::Network::MAX_CONNECTION; ++i)
     {
         if (!clients_[i].socket.is_valid()) 
         {
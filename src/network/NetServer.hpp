@@ -53,6 +53,9 @@ public:
 
     [[nodiscard]] bool SendMsg(ClientInfo* client, std::span<const char> msg);
 
+    //  ۸  Ŭ̾Ʈ ۽ ť  (  Ҿƿ)
+    [[nodiscard]] bool SendShared(ClientInfo* client, const std::shared_ptr<SendQueueData>& send_data);
+
 protected:
     virtual bool ConnectProcess(ClientInfo* client) = 0;
     virtual bool DisconnectProcess(ClientInfo* client) = 0;
@@ -7,6 +7,9 @@
 
 #include "../states/GameState.hpp"
 #include "../game/map/GameBackground.hpp"
+#include "../game/system/MatchRandom.hpp"
+#include "./link/LinkMonitor.hpp"
+#include "./link/LinkEmulator.hpp"
 
 #include "./packets/PacketBase.hpp"
 
@@ -40,6 +43,14 @@ void NetworkController::Shutdown()
 
     role_ = NetworkRole::None;
     is_running_ = false;
+    is_spectator_ = false;
+
+    LINK_MONITOR.Clear();
+
+    if (LINK_EMULATOR.IsEnabled())
+    {
+        LINK_EMULATOR.LogSummary();
+    }
 }
 
 bool NetworkController::Start() 
@@ -89,6 +100,22 @@ bool NetworkController::SendToClient(ClientInfo* client, const PacketBase& packe
     return server_->SendMsg(client, packet_data);
 }
 
+void NetworkController::SendToPlayers(const PacketBase& packet, std::span<const uint8_t> playerIds)
+{
+    if (IsServer() && server_)
+    {
+        server_->SendPacketTo(packet, playerIds);
+    }
+}
+
+//  ÷̾   ÷̾ ߰
+void NetworkController::RelayToPlayers(const PacketBase& packet, uint8_t sourceId)
+{
+    if (IsServer() && server_)
+    {
+        server_->BroadcastPacket(packet, sourceId);
+    }
+}
 
 void NetworkController::Update() 
 {
@@ -96,25 +123,37 @@ void NetworkController::Update()
     {
         server_->Update();
     }
+    else if (role_ == NetworkRole::Client && client_)
+    {
+        client_->Update();
+    }
+
+    LINK_MONITOR.Update();
+}
+
+int NetworkController::GetInputDelayFrames(uint8_t playerId) const
+{
+    // Ŭ̾Ʈ  Է      ִ   ũ̴
+    return LINK_MONITOR.GetInputDelayFrames(IsServer() ? playerId : LinkMonitor::SERVER_LINK);
 }
 
 //    Լ 
-void NetworkController::GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2) 
+void NetworkController::GameInitialize() 
 {
-        
+    // ġ õ   GameInitPacket  
     if (role_ == NetworkRole::Server && server_) 
     {
         if (auto* game_state = dynamic_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
         {
             if (auto* background = game_state->GetBackGround()) 
             {
-                server_->GameInitialize(block1, block2, background->GetMapIndex());
+                server_->GameInitialize(MATCH_RANDOM.GetSeed(), background->GetMapIndex());
             }
         }
     }
     else if (role_ == NetworkRole::Client && client_) 
     {
-        client_->GameInitialize(block1, block2);
+        client_->GameInitialize();
     }
 }
 
@@ -151,15 +190,15 @@ void NetworkController::DecideCharacter(uint8_t x, uint8_t y)
 }
 
 //   
-void NetworkController::AddNewBlock(std::span<const uint8_t> block) 
+void NetworkController::AddNewBlock(uint16_t pieceIndex) 
 {
     if (role_ == NetworkRole::Server && server_) 
     {
-        server_->AddNewBlock(block);
+        server_->AddNewBlock(pieceIndex);
     }
     else if (role_ == NetworkRole::Client && client_) 
     {
-        client_->AddNewBlock(block);
+        client_->AddNewBlock(pieceIndex);
     }
 }
 
@@ -225,7 +264,7 @@ void NetworkController::AddInterruptBlock(uint8_t y_row_count, uint8_t x_count,
 }
 
 //   
-void NetworkController::ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2) 
+void NetworkController::ReStartGame(uint32_t seed) 
 {
     if (role_ == NetworkRole::Server && server_) 
     {
@@ -233,13 +272,13 @@ void NetworkController::ReStartGame(std::span<const uint8_t> block1, std::span<c
         {
             if (auto* background = game_state->GetBackGround()) 
             {
-                server_->ReStartGame(block1, block2, background->GetMapIndex());
+                server_->ReStartGame(seed, background->GetMapIndex());
             }
         }
     }
     else if (role_ == NetworkRole::Client && client_) 
     {
-        client_->ReStartGame(block1, block2);
+        client_->ReStartGame(seed);
     }
 }
 
@@ -359,6 +398,19 @@ void NetworkController::LoseGame()
     }
 }
 
+SpectatorRelay* NetworkController::GetSpectatorRelay()
+{
+    return (role_ == NetworkRole::Server && server_) ? &server_->GetSpectatorRelay() : nullptr;
+}
+
+void NetworkController::PublishSpectatorFrame(std::span<const uint8_t> frame, bool isKeyframe)
+{
+    if (role_ == NetworkRole::Server && server_)
+    {
+        server_->PublishSpectatorFrame(frame, isKeyframe);
+    }
+}
+
 bool NetworkController::ProcessRecv(WPARAM wParam, LPARAM lParam)
 {
      if (role_ == NetworkRole::Client && client_)
@@ -25,6 +25,7 @@ enum class NetworkRole
 
 struct ClientInfo;
 class GameServer;
+class SpectatorRelay;
 
 class NetworkController 
 {
@@ -55,16 +56,20 @@ public:
     void SendData(const T& packet);
     bool SendToClient(ClientInfo* client, const PacketBase& packet);
 
+    //  : Ŷ Ʈ     ÷̾  ۷ 
+    void SendToPlayers(const PacketBase& packet, std::span<const uint8_t> playerIds);
+    void RelayToPlayers(const PacketBase& packet, uint8_t sourceId);
+
 
     //    Լ
     void StartCharacterSelect();
     void StartGame();
-    void GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
+    void GameInitialize();
     void ChangeCharSelect(uint8_t x, uint8_t y);
     void DecideCharacter(uint8_t x, uint8_t y);
 
     //   Լ
-    void AddNewBlock(std::span<const uint8_t> block);
+    void AddNewBlock(uint16_t pieceIndex);
     void MoveBlock(uint8_t move_type, float position);
     void RotateBlock(uint8_t rotate_type, bool horizontal_moving);
     void CheckBlockState();
@@ -80,11 +85,20 @@ public:
     void AddInterruptBlock(uint8_t y_row_count, uint8_t x_count, std::span<const uint8_t> xIdx);
     void StopComboAttack();
     void LoseGame();
-    void ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
+    void ReStartGame(uint32_t seed);
 
     // ä
     void ChatMessage(std::string_view msg);    
 
+    //  (: ̷  , Ŭ̾Ʈ: --spectate  ϸ    äο )
+    [[nodiscard]] SpectatorRelay* GetSpectatorRelay();
+    void PublishSpectatorFrame(std::span<const uint8_t> frame, bool isKeyframe);
+    void SetSpectator(bool spectator) { is_spectator_ = spectator; }
+    [[nodiscard]] bool IsSpectator() const { return is_spectator_; }
+
+    // ũ    Է  (:  ÷̾ ũ, Ŭ̾Ʈ:  ũ,  ̸ 0)
+    [[nodiscard]] int GetInputDelayFrames(uint8_t playerId) const;
+
     bool ProcessRecv(WPARAM wParam, LPARAM lParam);    
 
 private:
@@ -100,6 +114,7 @@ private:
 
     NetworkRole role_{ NetworkRole::None };
     bool is_running_{ false };
+    bool is_spectator_{ false };
     std::string ip_address_;
 };
 
@@ -1,11 +1,12 @@
 #include "PacketProcessor.hpp"
 #include "../utils/Logger.hpp"
+#include "../utils/FrameProfiler.hpp"
 
 void PacketProcessor::ProcessPacket(uint8_t connectionId, std::span<const char> data, uint32_t length)
 {
     if (length < sizeof(PacketBase))
     {
-        LOGGER.Warning("Invalid packet: too small");
+        LOG_NETWORK(Warning, "Invalid packet: too small");
         return;
     }
 
@@ -14,7 +15,7 @@ void PacketProcessor::ProcessPacket(uint8_t connectionId, std::span<const char>
     // Ŷ ũ 
     if (basePacket->size != length)
     {
-        LOGGER.Warning("Packet size mismatch: expected {}, got {}",
+        LOG_NETWORK(Warning, "Packet size mismatch: expected {}, got {}",
             basePacket->size, static_cast<unsigned int>(length));
         return;
     }
@@ -23,19 +24,23 @@ void PacketProcessor::ProcessPacket(uint8_t connectionId, std::span<const char>
     PacketType packetType = static_cast<PacketType>(basePacket->type);
     if (!IsValidPacketType(packetType))
     {
-        LOGGER.Warning("Invalid packet type: {}", static_cast<int>(packetType));
+        LOG_NETWORK(Warning, "Invalid packet type: {}", static_cast<int>(packetType));
         return;
     }
 
+    LOG_NETWORK(Trace, "Client process connection={} type={} size={}",
+        connectionId, static_cast<int>(packetType), static_cast<unsigned int>(length));
+
     // ڵ鷯 ȣ
     auto it = handlers_.find(packetType);
     if (it != handlers_.end())
     {
+        PROFILE_SCOPE(ProfileZone::PacketDispatch);
         it->second(connectionId, data);
     }
     else
     {
-        LOGGER.Warning("No handler registered for packet type: {}", static_cast<int>(packetType));
+        LOG_NETWORK(Warning, "No handler registered for packet type: {}", static_cast<int>(packetType));
     }
 }
 
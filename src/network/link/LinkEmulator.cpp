@@ -0,0 +1,363 @@
+#include "LinkEmulator.hpp"
+#include "../packets/PacketBase.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    const LinkEmulator::Profile PASS_THROUGH{};
+
+    bool ParseNumber(std::string_view text, double& value)
+    {
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return ec == std::errc() && ptr == text.data() + text.size() && value >= 0.0;
+    }
+}
+
+bool LinkEmulator::Profile::IsPassThrough() const
+{
+    return delay_ms == 0.0 && jitter_ms == 0.0 && bandwidth_kbps == 0.0
+        && reorder_percent == 0.0 && duplicate_percent == 0.0 && drop_percent == 0.0;
+}
+
+LinkEmulator& LinkEmulator::GetInstance()
+{
+    static LinkEmulator instance;
+    return instance;
+}
+
+LinkEmulator::LinkEmulator()
+    : origin_(Clock::now())
+{
+}
+
+int64_t LinkEmulator::NowUs() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin_).count();
+}
+
+std::optional<LinkEmulator::Profile> LinkEmulator::ParseProfile(std::string_view spec, uint32_t* seed)
+{
+    Profile profile;
+
+    if (spec == "off")
+    {
+        return profile;
+    }
+
+    while (!spec.empty())
+    {
+        const size_t comma = spec.find(',');
+        const std::string_view item = spec.substr(0, comma);
+        spec = comma == std::string_view::npos ? std::string_view{} : spec.substr(comma + 1);
+
+        const size_t equal = item.find('=');
+        if (equal == std::string_view::npos)
+        {
+            LOGGER.Error("Link emulator: expected key=value, got '{}'", item);
+            return std::nullopt;
+        }
+
+        const std::string_view key = item.substr(0, equal);
+        double value = 0.0;
+        if (!ParseNumber(item.substr(equal + 1), value))
+        {
+            LOGGER.Error("Link emulator: invalid value for '{}'", key);
+            return std::nullopt;
+        }
+
+        if (key == "delay") profile.delay_ms = value;
+        else if (key == "jitter") profile.jitter_ms = value;
+        else if (key == "bw") profile.bandwidth_kbps = value;
+        else if (key == "reorder") profile.reorder_percent = value;
+        else if (key == "dup") profile.duplicate_percent = value;
+        else if (key == "drop") profile.drop_percent = value;
+        else if (key == "seed" && seed) *seed = static_cast<uint32_t>(value);
+        else
+        {
+            LOGGER.Error("Link emulator: unknown key '{}'", key);
+            return std::nullopt;
+        }
+    }
+
+    return profile;
+}
+
+bool LinkEmulator::IsUnreliable(uint16_t packetType)
+{
+    switch (static_cast<PacketType>(packetType))
+    {
+    case PacketType::Ping:
+    case PacketType::Pong:
+    case PacketType::SyncBlockPositionY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool LinkEmulator::Configure(std::string_view spec)
+{
+    uint32_t seed = 1;
+    const auto profile = ParseProfile(spec, &seed);
+    if (!profile)
+    {
+        return false;
+    }
+
+    std::lock_guard lock(mutex_);
+
+    //   ũƮ տ д
+    std::erase_if(script_, [](const ScriptEntry& entry) { return entry.at_us == 0; });
+    script_.insert(script_.begin(), ScriptEntry{ 0, *profile });
+    script_cursor_ = 0;
+    applied_cursor_ = SIZE_MAX;
+
+    engine_.seed(seed);
+    is_enabled_ = true;
+    return true;
+}
+
+bool LinkEmulator::LoadScript(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        LOGGER.Error("Failed to open link emulator script: {}", path);
+        return false;
+    }
+
+    std::vector<ScriptEntry> entries;
+    uint32_t seed = 1;
+
+    std::string line;
+    int line_number = 0;
+
+    while (std::getline(file, line))
+    {
+        ++line_number;
+
+        if (auto comment = line.find('#'); comment != std::string::npos)
+        {
+            line.erase(comment);
+        }
+
+        std::istringstream stream(line);
+        double seconds = 0.0;
+        std::string spec;
+
+        if (!(stream >> seconds))
+        {
+            if (line.find_first_not_of(" \t\r") == std::string::npos)
+            {
+                continue;
+            }
+
+            LOGGER.Error("Link emulator script line {}: expected '<seconds> <spec>'", line_number);
+            return false;
+        }
+
+        stream >> spec;
+        const auto profile = ParseProfile(spec, &seed);
+        if (!profile || seconds < 0.0)
+        {
+            LOGGER.Error("Link emulator script line {}: invalid profile", line_number);
+            return false;
+        }
+
+        entries.push_back({ static_cast<int64_t>(seconds * 1'000'000.0), *profile });
+    }
+
+    std::stable_sort(entries.begin(), entries.end(),
+        [](const ScriptEntry& lhs, const ScriptEntry& rhs) { return lhs.at_us < rhs.at_us; });
+
+    std::lock_guard lock(mutex_);
+
+    // --net-emu    (0) ũƮ 0 ׸   
+    if (!entries.empty() && entries.front().at_us == 0)
+    {
+        script_.clear();
+    }
+    script_.insert(script_.end(), entries.begin(), entries.end());
+    script_cursor_ = 0;
+    applied_cursor_ = SIZE_MAX;
+
+    engine_.seed(seed);
+    is_enabled_ = true;
+    return true;
+}
+
+const LinkEmulator::Profile& LinkEmulator::GetProfile(int64_t nowUs)
+{
+    while (script_cursor_ + 1 < script_.size() && script_[script_cursor_ + 1].at_us <= nowUs)
+    {
+        ++script_cursor_;
+    }
+
+    if (script_.empty() || script_[script_cursor_].at_us > nowUs)
+    {
+        return PASS_THROUGH;
+    }
+
+    const auto& profile = script_[script_cursor_].profile;
+    if (script_cursor_ != applied_cursor_)
+    {
+        applied_cursor_ = script_cursor_;
+        if (profile.IsPassThrough())
+        {
+            LOG_NETWORK(Info, "Link emulator at {:.2f}s: off", nowUs / 1'000'000.0);
+            return profile;
+        }
+
+        LOG_NETWORK(Info, "Link emulator at {:.2f}s: delay {}ms jitter {}ms bw {}kbps reorder {}% dup {}% drop {}%",
+            nowUs / 1'000'000.0, profile.delay_ms, profile.jitter_ms, profile.bandwidth_kbps,
+            profile.reorder_percent, profile.duplicate_percent, profile.drop_percent);
+    }
+    return profile;
+}
+
+LinkEmulator::SourceState& LinkEmulator::GetSourceState(uintptr_t source)
+{
+    const auto it = std::ranges::find(sources_, source, &SourceState::source);
+    if (it != sources_.end())
+    {
+        return *it;
+    }
+
+    auto& state = sources_.emplace_back();
+    state.source = source;
+    return state;
+}
+
+int64_t LinkEmulator::SampleDelayUs(const Profile& profile)
+{
+    double delay = profile.delay_ms;
+    if (profile.jitter_ms > 0.0)
+    {
+        delay += std::uniform_real_distribution<double>(-profile.jitter_ms, profile.jitter_ms)(engine_);
+    }
+    return std::llround(std::max(delay, 0.0) * 1000.0);
+}
+
+bool LinkEmulator::LaterDelivery(const InFlight& lhs, const InFlight& rhs)
+{
+    return lhs.deliver_us != rhs.deliver_us ? lhs.deliver_us > rhs.deliver_us : lhs.order > rhs.order;
+}
+
+void LinkEmulator::Schedule(uintptr_t source, std::span<const char> packet, int64_t deliverUs)
+{
+    in_flight_.push_back({ deliverUs, next_order_++, source, std::vector<char>(packet.begin(), packet.end()) });
+    std::push_heap(in_flight_.begin(), in_flight_.end(), LaterDelivery);
+}
+
+void LinkEmulator::Push(uintptr_t source, std::span<const char> packet)
+{
+    if (packet.size() < sizeof(PacketBase))
+    {
+        return;
+    }
+
+    const int64_t now = NowUs();
+    const bool unreliable = IsUnreliable(reinterpret_cast<const PacketBase*>(packet.data())->type);
+
+    std::lock_guard lock(mutex_);
+
+    const auto& profile = GetProfile(now);
+    auto& state = GetSourceState(source);
+    std::uniform_real_distribution<double> percent(0.0, 100.0);
+
+    if (unreliable && profile.drop_percent > 0.0 && percent(engine_) < profile.drop_percent)
+    {
+        ++dropped_count_;
+        return;
+    }
+
+    // 뿪:  Ŷ   ڿ  Ŷ  Ʈ ´
+    int64_t arrive = now;
+    if (profile.bandwidth_kbps > 0.0)
+    {
+        state.busy_until_us = std::max(now, state.busy_until_us)
+            + std::llround(packet.size() * 8000.0 / profile.bandwidth_kbps);
+        arrive = state.busy_until_us;
+    }
+
+    if (unreliable && profile.reorder_percent > 0.0 && percent(engine_) < profile.reorder_percent)
+    {
+        // netem ó Ϻ Ŷ    ռ  Ŷ ߿Ų
+        ++reordered_count_;
+        Schedule(source, packet, arrive);
+    }
+    else
+    {
+        int64_t deliver = arrive + SampleDelayUs(profile);
+        if (!unreliable)
+        {
+            deliver = std::max(deliver, state.last_reliable_us);
+            state.last_reliable_us = deliver;
+        }
+        Schedule(source, packet, deliver);
+    }
+
+    if (unreliable && profile.duplicate_percent > 0.0 && percent(engine_) < profile.duplicate_percent)
+    {
+        ++duplicated_count_;
+        Schedule(source, packet, arrive + SampleDelayUs(profile));
+    }
+}
+
+void LinkEmulator::Deliver(const DeliverFunc& deliver)
+{
+    {
+        const int64_t now = NowUs();
+
+        std::lock_guard lock(mutex_);
+        while (!in_flight_.empty() && in_flight_.front().deliver_us <= now)
+        {
+            std::pop_heap(in_flight_.begin(), in_flight_.end(), LaterDelivery);
+            delivering_.push_back(std::move(in_flight_.back()));
+            in_flight_.pop_back();
+        }
+    }
+
+    // ó ߿  尡 Push   ֵ  ۿ ѱ
+    for (const auto& packet : delivering_)
+    {
+        deliver(packet.source, packet.bytes);
+    }
+    delivering_.clear();
+}
+
+uint32_t LinkEmulator::GetWaitMs(uint32_t maxMs) const
+{
+    const int64_t now = NowUs();
+
+    std::lock_guard lock(mutex_);
+    if (in_flight_.empty())
+    {
+        return maxMs;
+    }
+
+    const int64_t remain = std::max<int64_t>(in_flight_.front().deliver_us - now, 0);
+    return static_cast<uint32_t>(std::min<int64_t>((remain + 999) / 1000, maxMs));
+}
+
+void LinkEmulator::DiscardSource(uintptr_t source)
+{
+    std::lock_guard lock(mutex_);
+
+    std::erase_if(in_flight_, [source](const InFlight& packet) { return packet.source == source; });
+    std::make_heap(in_flight_.begin(), in_flight_.end(), LaterDelivery);
+    std::erase_if(sources_, [source](const SourceState& state) { return state.source == source; });
+}
+
+void LinkEmulator::LogSummary() const
+{
+    std::lock_guard lock(mutex_);
+    LOG_NETWORK(Info, "Link emulator: dropped {} duplicated {} reordered {} in flight {}",
+        dropped_count_, duplicated_count_, reordered_count_, in_flight_.size());
+}
@@ -0,0 +1,139 @@
+#pragma once
+/*
+*
+* :  ׽Ʈ ũ ķ ( ʿ   Ŷ ó ̿ )
+* 1.    Ŷ  ξٰ  ð Ǹ ѱ (Ŭ̾Ʈ:  , : GameServer::Update)
+* 2.  ð = 뿪 ȭ( Ŷ   size / bw) + delay + յ  (jitter)
+* 3. ŷ Ŷ(TCP Ʈ ״) Ͱ ־  Ű, Ҿ Ǵ Ŷ(IsUnreliable)
+*    reorder(   ) / dup() / drop()   ( UDP ۿ ŷ äη  Ŷ)
+* 4.  --net-emu <spec>  ۺ, --net-emu-script <path>  ð  ٲ۴
+*
+* spec: ǥ  key=value,  Ű 0 (: delay=40,jitter=10,bw=512,reorder=5,dup=1,drop=2,seed=7)
+*   delay / jitter (ms), bw (kbit/s, 0  ), reorder / dup / drop (%), seed ( õ, ⺻ 1)
+*
+* ũƮ  ( ٿ  , '#' Ĵ ּ,   <>   )
+*   <> <spec>
+*   ) 0 delay=20
+*       10 delay=80,jitter=30,drop=5
+*       20 off
+*
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class LinkEmulator
+{
+public:
+
+    struct Profile
+    {
+        double delay_ms{ 0.0 };
+        double jitter_ms{ 0.0 };
+        double bandwidth_kbps{ 0.0 };
+        double reorder_percent{ 0.0 };
+        double duplicate_percent{ 0.0 };
+        double drop_percent{ 0.0 };
+
+        [[nodiscard]] bool IsPassThrough() const;
+    };
+
+    using DeliverFunc = std::function<void(uintptr_t source, std::span<const char> packet)>;
+
+    static LinkEmulator& GetInstance();
+
+    LinkEmulator(const LinkEmulator&) = delete;
+    LinkEmulator& operator=(const LinkEmulator&) = delete;
+    LinkEmulator(LinkEmulator&&) = delete;
+    LinkEmulator& operator=(LinkEmulator&&) = delete;
+
+    // spec Ľ ("off"  ), ߸ Ű/̸ nullopt
+    [[nodiscard]] static std::optional<Profile> ParseProfile(std::string_view spec, uint32_t* seed = nullptr);
+
+    //  UDP  Ұų  ٲ Ǵ Ŷ (ũ , ֱ  ġ ȭ)
+    [[nodiscard]] static bool IsUnreliable(uint16_t packetType);
+
+    bool Configure(std::string_view spec);
+    bool LoadScript(const std::string& path);
+    [[nodiscard]] bool IsEnabled() const { return is_enabled_; }
+
+    //  : Ŷ   ť ִ´ (source    п,  ClientInfo ּ)
+    void Push(uintptr_t source, std::span<const char> packet);
+
+    //  ð  Ŷ  ѱ ( 忡 ȣ)
+    void Deliver(const DeliverFunc& deliver);
+
+    //    ð (maxMs ,   ð)
+    [[nodiscard]] uint32_t GetWaitMs(uint32_t maxMs) const;
+
+    //      Ŷ 
+    void DiscardSource(uintptr_t source);
+
+    void LogSummary() const;
+
+private:
+
+    using Clock = std::chrono::steady_clock;
+
+    struct ScriptEntry
+    {
+        int64_t at_us{ 0 };
+        Profile profile;
+    };
+
+    struct InFlight
+    {
+        int64_t deliver_us{ 0 };
+        uint64_t order{ 0 };
+        uintptr_t source{ 0 };
+        std::vector<char> bytes;
+    };
+
+    struct SourceState
+    {
+        uintptr_t source{ 0 };
+        int64_t busy_until_us{ 0 };         // 뿪:  Ŷ ȭ  ð
+        int64_t last_reliable_us{ 0 };      // ŷ Ŷ  ð   ʴ´
+    };
+
+    LinkEmulator();
+    ~LinkEmulator() = default;
+
+    [[nodiscard]] int64_t NowUs() const;
+    [[nodiscard]] const Profile& GetProfile(int64_t nowUs);
+    [[nodiscard]] int64_t SampleDelayUs(const Profile& profile);
+    [[nodiscard]] SourceState& GetSourceState(uintptr_t source);
+    void Schedule(uintptr_t source, std::span<const char> packet, int64_t deliverUs);
+
+    static bool LaterDelivery(const InFlight& lhs, const InFlight& rhs);
+
+private:
+
+    Clock::time_point origin_;
+    bool is_enabled_{ false };
+
+    std::vector<ScriptEntry> script_;
+    size_t script_cursor_{ 0 };
+    size_t applied_cursor_{ SIZE_MAX };             //  α׸  
+
+    mutable std::mutex mutex_;
+    std::vector<InFlight> in_flight_;               //  ð ּ 
+    std::vector<SourceState> sources_;
+    std::vector<InFlight> delivering_;
+    std::mt19937_64 engine_{ 1 };
+    uint64_t next_order_{ 0 };
+
+    uint64_t dropped_count_{ 0 };
+    uint64_t duplicated_count_{ 0 };
+    uint64_t reordered_count_{ 0 };
+};
+
+#define LINK_EMULATOR LinkEmulator::GetInstance()
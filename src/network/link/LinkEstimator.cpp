@@ -0,0 +1,132 @@
+#include "LinkEstimator.hpp"
+#include "../../core/common/constants/Constants.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+
+uint32_t LinkEstimator::BeginPing(int64_t nowUs)
+{
+    const uint32_t sequence = next_sequence_++;
+
+    auto& slot = pending_[sequence % PENDING_COUNT];
+    if (slot.is_waiting)
+    {
+        RecordLoss(true);
+    }
+
+    slot = { sequence, nowUs, true };
+    return sequence;
+}
+
+bool LinkEstimator::OnPong(uint32_t sequence, int64_t echoTimeUs, int64_t peerReceiveUs, int64_t peerSendUs, int64_t nowUs)
+{
+    auto& slot = pending_[sequence % PENDING_COUNT];
+
+    // ̹ ս ó߰ų ٸ Ping  Pong ̸ 
+    if (!slot.is_waiting || slot.sequence != sequence || slot.send_time_us != echoTimeUs || nowUs < echoTimeUs)
+    {
+        return false;
+    }
+
+    slot.is_waiting = false;
+    RecordLoss(false);
+
+    const int64_t hold = std::max<int64_t>(peerSendUs - peerReceiveUs, 0);
+    const int64_t rtt = std::max<int64_t>(nowUs - echoTimeUs - hold, 0);
+
+    if (samples_ == 0)
+    {
+        srtt_us_ = static_cast<double>(rtt);
+        rtt_var_us_ = rtt * 0.5;
+        min_rtt_us_ = rtt;
+    }
+    else
+    {
+        const double error = rtt - srtt_us_;
+        rtt_var_us_ += (std::abs(error) - rtt_var_us_) * RTT_VAR_GAIN;
+        srtt_us_ += error * RTT_GAIN;
+        jitter_us_ += (std::abs(static_cast<double>(rtt - last_rtt_us_)) - jitter_us_) * JITTER_GAIN;
+        min_rtt_us_ = std::min(min_rtt_us_, rtt);
+    }
+
+    last_rtt_us_ = rtt;
+    ++samples_;
+
+    offsets_[offset_cursor_] = { rtt, ((peerReceiveUs - echoTimeUs) + (peerSendUs - nowUs)) / 2 };
+    offset_cursor_ = (offset_cursor_ + 1) % OFFSET_WINDOW;
+    offset_count_ = std::min(offset_count_ + 1, OFFSET_WINDOW);
+
+    return true;
+}
+
+void LinkEstimator::ExpirePending(int64_t nowUs)
+{
+    for (auto& slot : pending_)
+    {
+        if (slot.is_waiting && nowUs - slot.send_time_us > LOSS_TIMEOUT_US)
+        {
+            slot.is_waiting = false;
+            RecordLoss(true);
+        }
+    }
+}
+
+void LinkEstimator::RecordLoss(bool lost)
+{
+    if (lost)
+    {
+        ++lost_;
+    }
+
+    static_assert(LOSS_WINDOW == 64, "loss_history_ is a 64-bit window");
+
+    loss_history_ = (loss_history_ << 1) | (lost ? 1u : 0u);
+    loss_history_count_ = std::min(loss_history_count_ + 1, LOSS_WINDOW);
+}
+
+int64_t LinkEstimator::GetBestOffsetUs() const
+{
+    if (offset_count_ == 0)
+    {
+        return 0;
+    }
+
+    const auto best = std::min_element(offsets_.begin(), offsets_.begin() + offset_count_,
+        [](const OffsetSample& a, const OffsetSample& b) { return a.rtt_us < b.rtt_us; });
+
+    return best->offset_us;
+}
+
+LinkEstimator::Snapshot LinkEstimator::GetSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.samples = samples_;
+    snapshot.lost = lost_;
+    snapshot.loss = loss_history_count_ > 0 ? static_cast<double>(std::popcount(loss_history_)) / loss_history_count_ : 0.0;
+
+    if (samples_ == 0)
+    {
+        return snapshot;
+    }
+
+    snapshot.rtt_ms = srtt_us_ / 1000.0;
+    snapshot.rtt_var_ms = rtt_var_us_ / 1000.0;
+    snapshot.min_rtt_ms = min_rtt_us_ / 1000.0;
+    snapshot.jitter_ms = jitter_us_ / 1000.0;
+    snapshot.offset_ms = GetBestOffsetUs() / 1000.0;
+    snapshot.input_delay_frames = ComputeInputDelayFrames(snapshot.rtt_ms, snapshot.jitter_ms);
+
+    return snapshot;
+}
+
+int LinkEstimator::ComputeInputDelayFrames(double rttMs, double jitterMs)
+{
+    constexpr double STEP_MS = 1000.0 / Constants::Time::LOGIC_RATE;
+
+    const double delayMs = rttMs * 0.5 + jitterMs * 2.0;
+    const int frames = static_cast<int>(std::ceil(delayMs / STEP_MS));
+
+    return std::clamp(frames, 0, MAX_INPUT_DELAY_FRAMES);
+}
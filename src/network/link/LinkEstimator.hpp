@@ -0,0 +1,96 @@
+#pragma once
+/*
+*
+* :  Ǿ Ping/Pong  ũ  
+* 1. NTP ó  ð(t0 Ping , t1 Ǿ , t2 Ǿ Pong , t3 Pong ) 
+*    RTT = (t3 - t0) - (t2 - t1) ̶ Ǿ Pong   ִ ð( ) 
+* 2. RFC 6298  Ȱ RTT(1/8)  (1/4), ʹ  RTT ǥ   (RFC 3550  1/16 ̵)
+* 3. ð (Ǿ ð -  ð) ǥ ((t1 - t0) + (t2 - t3)) / 2,
+*    ֱ OFFSET_WINDOW   RTT   ª ǥ  (ΰ  и ǥϼ RTT  )
+* 4. ս: ֱ LOSS_WINDOW  Ping  LOSS_TIMEOUT_US ȿ Pong     (TCP  δ  ũ/ü )
+* 5. Է  尪:  (RTT/2) +   踦  (120Hz)  ø
+* 6.    (LinkMonitor  )
+*
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class LinkEstimator
+{
+public:
+
+    static constexpr double RTT_GAIN = 1.0 / 8.0;
+    static constexpr double RTT_VAR_GAIN = 1.0 / 4.0;
+    static constexpr double JITTER_GAIN = 1.0 / 16.0;
+    static constexpr uint32_t LOSS_WINDOW = 64;
+    static constexpr size_t PENDING_COUNT = 16;
+    static constexpr size_t OFFSET_WINDOW = 8;
+    static constexpr int64_t LOSS_TIMEOUT_US = 2'000'000;
+    static constexpr int MAX_INPUT_DELAY_FRAMES = 30;
+
+    struct Snapshot
+    {
+        double rtt_ms{ 0.0 };
+        double rtt_var_ms{ 0.0 };
+        double min_rtt_ms{ 0.0 };
+        double jitter_ms{ 0.0 };
+        double offset_ms{ 0.0 };
+        double loss{ 0.0 };             // 0 ~ 1
+        uint32_t samples{ 0 };
+        uint32_t lost{ 0 };
+        int input_delay_frames{ 0 };
+    };
+
+    //  Ping   (з  Ping  ս)
+    [[nodiscard]] uint32_t BeginPing(int64_t nowUs);
+
+    // ٸ Ping  Pong ̸ ǥ ݿϰ true
+    bool OnPong(uint32_t sequence, int64_t echoTimeUs, int64_t peerReceiveUs, int64_t peerSendUs, int64_t nowUs);
+
+    //  ð   Ping  սǷ ó
+    void ExpirePending(int64_t nowUs);
+
+    [[nodiscard]] bool HasSamples() const { return samples_ > 0; }
+    [[nodiscard]] Snapshot GetSnapshot() const;
+
+    [[nodiscard]] static int ComputeInputDelayFrames(double rttMs, double jitterMs);
+
+private:
+
+    struct Pending
+    {
+        uint32_t sequence{ 0 };
+        int64_t send_time_us{ 0 };
+        bool is_waiting{ false };
+    };
+
+    struct OffsetSample
+    {
+        int64_t rtt_us{ 0 };
+        int64_t offset_us{ 0 };
+    };
+
+    void RecordLoss(bool lost);
+    [[nodiscard]] int64_t GetBestOffsetUs() const;
+
+private:
+
+    std::array<Pending, PENDING_COUNT> pending_{};
+    std::array<OffsetSample, OFFSET_WINDOW> offsets_{};
+    size_t offset_count_{ 0 };
+    size_t offset_cursor_{ 0 };
+
+    uint32_t next_sequence_{ 1 };
+    uint32_t samples_{ 0 };
+    uint32_t lost_{ 0 };
+    uint64_t loss_history_{ 0 };           // ֱ  Ʈ (1 = ս)
+    uint32_t loss_history_count_{ 0 };
+
+    double srtt_us_{ 0.0 };
+    double rtt_var_us_{ 0.0 };
+    double jitter_us_{ 0.0 };
+    int64_t last_rtt_us_{ 0 };
+    int64_t min_rtt_us_{ 0 };
+};
@@ -0,0 +1,207 @@
+#include "LinkMonitor.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <SDL3/SDL_render.h>
+
+#include <algorithm>
+#include <format>
+
+LinkMonitor& LinkMonitor::GetInstance()
+{
+    static LinkMonitor instance;
+    return instance;
+}
+
+LinkMonitor::LinkMonitor()
+    : origin_(Clock::now())
+{
+}
+
+int64_t LinkMonitor::NowUs() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin_).count();
+}
+
+LinkMonitor::Link* LinkMonitor::FindLink(uint8_t linkId)
+{
+    const auto it = std::ranges::find(links_, linkId, &Link::id);
+    return it != links_.end() ? &*it : nullptr;
+}
+
+const LinkMonitor::Link* LinkMonitor::FindLink(uint8_t linkId) const
+{
+    const auto it = std::ranges::find(links_, linkId, &Link::id);
+    return it != links_.end() ? &*it : nullptr;
+}
+
+bool LinkMonitor::PollPing(uint8_t linkId, PingPacket& packet)
+{
+    const int64_t now = NowUs();
+
+    std::lock_guard lock(mutex_);
+
+    auto* link = FindLink(linkId);
+    if (!link)
+    {
+        link = &links_.emplace_back();
+        link->id = linkId;
+    }
+
+    if (now < link->next_ping_us)
+    {
+        return false;
+    }
+
+    link->next_ping_us = now + PING_INTERVAL_US;
+
+    packet.link_id = linkId;
+    packet.sequence = link->estimator.BeginPing(now);
+    packet.send_time_us = now;
+    return true;
+}
+
+PongPacket LinkMonitor::MakePong(const PingPacket& ping) const
+{
+    PongPacket pong;
+    pong.link_id = ping.link_id;
+    pong.sequence = ping.sequence;
+    pong.echo_time_us = ping.send_time_us;
+    pong.peer_receive_us = NowUs();
+    return pong;
+}
+
+void LinkMonitor::OnPong(const PongPacket& pong)
+{
+    const int64_t now = NowUs();
+
+    std::lock_guard lock(mutex_);
+
+    if (auto* link = FindLink(pong.link_id))
+    {
+        if (!link->estimator.OnPong(pong.sequence, pong.echo_time_us, pong.peer_receive_us, pong.peer_send_us, now))
+        {
+            LOG_NETWORK(Debug, "Stale pong link={} seq={}", pong.link_id, pong.sequence);
+        }
+    }
+}
+
+void LinkMonitor::RemoveLink(uint8_t linkId)
+{
+    std::lock_guard lock(mutex_);
+    std::erase_if(links_, [linkId](const Link& link) { return link.id == linkId; });
+}
+
+void LinkMonitor::Clear()
+{
+    std::lock_guard lock(mutex_);
+    links_.clear();
+}
+
+std::optional<LinkEstimator::Snapshot> LinkMonitor::GetSnapshot(uint8_t linkId) const
+{
+    std::lock_guard lock(mutex_);
+
+    if (const auto* link = FindLink(linkId); link && link->estimator.HasSamples())
+    {
+        return link->estimator.GetSnapshot();
+    }
+    return std::nullopt;
+}
+
+int LinkMonitor::GetInputDelayFrames(uint8_t linkId) const
+{
+    const auto snapshot = GetSnapshot(linkId);
+    return snapshot ? snapshot->input_delay_frames : 0;
+}
+
+void LinkMonitor::Update()
+{
+    const int64_t now = NowUs();
+
+    std::lock_guard lock(mutex_);
+
+    for (auto& link : links_)
+    {
+        link.estimator.ExpirePending(now);
+    }
+
+    if (stats_csv_.is_open() && now >= next_stats_us_)
+    {
+        next_stats_us_ = now + STATS_INTERVAL_US;
+        WriteStats(now);
+    }
+}
+
+bool LinkMonitor::OpenStatsCsv(const std::string& path)
+{
+    stats_csv_.open(path, std::ios::trunc);
+    if (!stats_csv_)
+    {
+        LOGGER.Error("Failed to open link stats file: {}", path);
+        return false;
+    }
+
+    stats_csv_ << "time_ms,link,rtt_ms,rtt_var_ms,min_rtt_ms,jitter_ms,offset_ms,loss,lost,input_delay_frames\n";
+    return true;
+}
+
+void LinkMonitor::WriteStats(int64_t nowUs)
+{
+    for (const auto& link : links_)
+    {
+        if (!link.estimator.HasSamples())
+        {
+            continue;
+        }
+
+        const auto s = link.estimator.GetSnapshot();
+        stats_csv_ << std::format("{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.4f},{},{}\n",
+            nowUs / 1000, link.id, s.rtt_ms, s.rtt_var_ms, s.min_rtt_ms, s.jitter_ms, s.offset_ms, s.loss, s.lost, s.input_delay_frames);
+    }
+    stats_csv_.flush();
+}
+
+void LinkMonitor::RenderOverlay(SDL_Renderer* renderer, float top) const
+{
+    if (!renderer)
+    {
+        return;
+    }
+
+    constexpr float LINE_HEIGHT = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE + 2.0f;
+    constexpr float MARGIN = 4.0f;
+
+    std::lock_guard lock(mutex_);
+
+    if (links_.empty())
+    {
+        return;
+    }
+
+    const SDL_FRect background{ 0.0f, top, 392.0f, MARGIN * 2 + LINE_HEIGHT * (links_.size() + 1) };
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &background);
+
+    char line[96];
+    float y = top + MARGIN;
+
+    auto drawLine = [&](const std::format_to_n_result<char*>& result)
+    {
+        *result.out = '\0';
+        SDL_RenderDebugText(renderer, MARGIN, y, line);
+        y += LINE_HEIGHT;
+    };
+
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    drawLine(std::format_to_n(line, sizeof(line) - 1, "{:<8}{:>7}{:>7}{:>7}{:>6}{:>10}{:>6}", "link(ms)", "rtt", "var", "jit", "loss", "offset", "delay"));
+
+    for (const auto& link : links_)
+    {
+        const auto s = link.estimator.GetSnapshot();
+        const auto name = link.id == SERVER_LINK ? std::string("server") : std::format("p{}", link.id);
+
+        drawLine(std::format_to_n(line, sizeof(line) - 1, "{:<8}{:>7.1f}{:>7.1f}{:>7.1f}{:>5.0f}%{:>10.1f}{:>6}",
+            name, s.rtt_ms, s.rtt_var_ms, s.jitter_ms, s.loss * 100.0, s.offset_ms, s.input_delay_frames));
+    }
+}
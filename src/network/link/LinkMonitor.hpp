@@ -0,0 +1,94 @@
+#pragma once
+/*
+*
+* : Ʈũ ũ  (ƮƮ)
+* 1. Ŭ̾Ʈ  ũ(SERVER_LINK) ϳ,  ÷̾ ũ ϳ ΰ PING_INTERVAL_US  Ping  
+* 2. Ping   ( IOCP Ŀ / Ŭ̾Ʈ  )  ð  ΰ Pong   忡 
+*    (۽  忡 ϹǷ), Pong   ִ ð  ð  ð ̷ RTT  
+* 3. ũ (RTT, , ð , ս) LinkEstimator , F3 ̿ --link-stats CSV  Ȯ
+* 4.  Է   ÷̾ ġ    (RemotePlayer::SyncPositionY)
+* 5. MakePong/OnPong   ,    (ũ   ȣ)
+*
+*/
+
+#include "LinkEstimator.hpp"
+#include "../packets/GamePackets.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct SDL_Renderer;
+
+class LinkMonitor
+{
+public:
+
+    static constexpr uint8_t SERVER_LINK = 0;           //  ڽ ÷̾ ID  1 Ͷ ġ ʴ´
+    static constexpr int64_t PING_INTERVAL_US = 250'000;
+    static constexpr int64_t STATS_INTERVAL_US = 1'000'000;
+
+    static LinkMonitor& GetInstance();
+
+    LinkMonitor(const LinkMonitor&) = delete;
+    LinkMonitor& operator=(const LinkMonitor&) = delete;
+    LinkMonitor(LinkMonitor&&) = delete;
+    LinkMonitor& operator=(LinkMonitor&&) = delete;
+
+    [[nodiscard]] int64_t NowUs() const;
+
+    //  : ũ Ping   Ǿ packet  ä true (ó  ũ )
+    bool PollPing(uint8_t linkId, PingPacket& packet);
+
+    //  :  ð  Pong (  StampPong)
+    [[nodiscard]] PongPacket MakePong(const PingPacket& ping) const;
+    void StampPong(PongPacket& pong) const { pong.peer_send_us = NowUs(); }
+    void OnPong(const PongPacket& pong);
+
+    void RemoveLink(uint8_t linkId);
+    void Clear();
+
+    [[nodiscard]] std::optional<LinkEstimator::Snapshot> GetSnapshot(uint8_t linkId) const;
+    [[nodiscard]] int GetInputDelayFrames(uint8_t linkId) const;
+
+    //    :   Ping ս ó, STATS_INTERVAL_US  CSV 
+    void Update();
+
+    bool OpenStatsCsv(const std::string& path);
+    void RenderOverlay(SDL_Renderer* renderer, float top) const;
+
+private:
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Link
+    {
+        uint8_t id{ 0 };
+        int64_t next_ping_us{ 0 };
+        LinkEstimator estimator;
+    };
+
+    LinkMonitor();
+    ~LinkMonitor() = default;
+
+    [[nodiscard]] Link* FindLink(uint8_t linkId);
+    [[nodiscard]] const Link* FindLink(uint8_t linkId) const;
+    void WriteStats(int64_t nowUs);
+
+private:
+
+    Clock::time_point origin_;
+
+    mutable std::mutex mutex_;
+    std::vector<Link> links_;
+
+    //    
+    std::ofstream stats_csv_;
+    int64_t next_stats_us_{ 0 };
+};
+
+#define LINK_MONITOR LinkMonitor::GetInstance()
@@ -1,8 +1,10 @@
 #pragma once
 #include "PacketBase.hpp"
+#include "../../core/common/constants/Constants.hpp"
 #include <array>
 #include <cstdint>
 #include <algorithm>
+#include <span>
 #include <string_view>
 
 #pragma pack(push, 1)
@@ -60,8 +62,7 @@ struct GameInitPacket : PacketBase
     uint8_t player_id{};
     uint8_t map_id{};
     uint16_t character_id{};
-    std::array<uint8_t, 2> block1{};
-    std::array<uint8_t, 2> block2{};
+    uint32_t seed{};                        // ġ  õ (   ⼭ )
 
     GameInitPacket()
     {
@@ -250,8 +251,7 @@ struct RestartGamePacket : PacketBase
 {
     uint8_t player_id{};
     uint8_t map_id{};
-    std::array<uint8_t, 2> block1{};
-    std::array<uint8_t, 2> block2{};
+    uint32_t seed{};                        //  ġ  õ
 
     RestartGamePacket()
     {
@@ -264,8 +264,6 @@ struct InitializePlayerPacket : PacketBase
 {
     uint8_t player_id{};
     uint16_t character_idx{};
-    std::array<uint8_t, 2> block_type1{};
-    std::array<uint8_t, 2> block_type2{};
 
     InitializePlayerPacket()
     {
@@ -277,7 +275,7 @@ struct InitializePlayerPacket : PacketBase
 struct AddNewBlockPacket : PacketBase
 {
     uint8_t player_id{};
-    std::array<uint8_t, 2> block_type{};  //  Ÿ 2
+    uint16_t piece_index{};                 // ġ    ( ޴  õ )
 
     AddNewBlockPacket()
     {
@@ -312,6 +310,35 @@ struct GiveIdPacket : PacketBase
     }
 };
 
+// ũ  (ð   steady_clock  us,  Ǿ ð   ٸ)
+struct PingPacket : PacketBase
+{
+    uint8_t link_id{};                      //    ũ ϴ ID (Pong  ״ ƿ´)
+    uint32_t sequence{};
+    int64_t send_time_us{};
+
+    PingPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::Ping);
+        size = sizeof(PingPacket);
+    }
+};
+
+struct PongPacket : PacketBase
+{
+    uint8_t link_id{};
+    uint32_t sequence{};
+    int64_t echo_time_us{};                 // Ping  send_time_us
+    int64_t peer_receive_us{};              //   Ping   ð (  ð)
+    int64_t peer_send_us{};                 //   Pong   ð (  ð)
+
+    PongPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::Pong);
+        size = sizeof(PongPacket);
+    }
+};
+
 struct StartCharSelectPacket : PacketBase
 {
     StartCharSelectPacket()
@@ -403,6 +430,24 @@ struct AttackResultPlayerInterruptBlocCountPacket : PacketBase
     }
 };
 
+//         ڿ 
+struct TargetInterruptPacket : PacketBase
+{
+    uint8_t attacker_id{};
+    uint8_t target_id{};
+    int16_t count{};
+    int16_t target_pending{};               //      ( )
+    float position_x{};
+    float position_y{};
+    uint8_t block_type{};
+
+    TargetInterruptPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::TargetInterruptBlock);
+        size = sizeof(TargetInterruptPacket);
+    }
+};
+
 struct SyncBlockPositionYPacket : public PacketBase
 {
     uint8_t player_id{};
@@ -416,4 +461,47 @@ struct SyncBlockPositionYPacket : public PacketBase
     }
 };
 
+//  
+struct SpectateRequestPacket : PacketBase
+{
+    uint8_t id{};
+
+    SpectateRequestPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::SpectateRequest);
+        size = sizeof(SpectateRequestPacket);
+    }
+};
+
+//  : size   +    (ToBytes  size ŭ )
+struct SpectatorFramePacket : PacketBase
+{
+    static constexpr size_t MAX_FRAME_SIZE = Constants::Network::MAX_PACKET_SIZE - sizeof(PacketBase);
+
+    std::array<uint8_t, MAX_FRAME_SIZE> frame{};
+
+    SpectatorFramePacket()
+    {
+        type = static_cast<uint16_t>(PacketType::SpectatorFrame);
+        size = sizeof(PacketBase);
+    }
+
+    bool SetFrame(std::span<const uint8_t> bytes)
+    {
+        if (bytes.size() > frame.size())
+        {
+            return false;
+        }
+
+        std::copy_n(bytes.data(), bytes.size(), frame.data());
+        size = static_cast<uint32_t>(sizeof(PacketBase) + bytes.size());
+        return true;
+    }
+
+    [[nodiscard]] std::span<const uint8_t> GetFrame() const
+    {
+        return { frame.data(), size - sizeof(PacketBase) };
+    }
+};
+
 #pragma pack(pop)
\ No newline at end of file
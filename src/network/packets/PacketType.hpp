@@ -9,6 +9,8 @@ enum class PacketType : uint16_t
     // /ʱȭ  (1-99)
     GiveId = 1,
     ConnectLobby = 2,
+    Ping = 3,                               // ũ :   ð (  ٷ Pong  ǵ ش)
+    Pong = 4,
 
     //÷̾ 
     RemovePlayer = 50,
@@ -51,6 +53,7 @@ enum class PacketType : uint16_t
     StopComboAttack = 503,
     DefenseResultInterruptBlockCount = 504,
     AttackResultPlayerInterruptBlocCount = 505,
+    TargetInterruptBlock = 506,             //  :     
 
     // 500  ̹Ƿ ű⿡ ġ
     ComboUpdate = 550,        
@@ -58,6 +61,10 @@ enum class PacketType : uint16_t
     //    (600-699)
     LoseGame = 600,
 
+    //   (700-799)
+    SpectateRequest = 700,
+    SpectatorFrame = 701,
+
     Max
 };
 
@@ -97,3 +104,8 @@ enum class PacketType : uint16_t
 {
     return type >= PacketType::AttackInterruptBlock && type < PacketType::LoseGame;
 }
+
+[[nodiscard]] constexpr bool IsSpectatorPacket(PacketType type) 
+{
+    return type >= PacketType::SpectateRequest && type < PacketType::Max;
+}
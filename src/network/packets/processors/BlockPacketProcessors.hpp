@@ -14,6 +14,7 @@
 #include "../../../network/NetworkController.hpp"
 #include "../../../game/system/BasePlayer.hpp"
 #include "../../../game/system/RemotePlayer.hpp"
+#include "../../../game/system/FfaMatch.hpp"
 
 #include <span>
 
@@ -32,25 +33,13 @@ public:
             return;
         }
 
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != block_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), block_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(block_packet, block_packet.player_id);
 
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(block_packet.player_id))
             {   
-                std::span<const uint8_t, 2> blockType{ block_packet.block_type };
-                remotePlayer->AddNewBlock(blockType);
+                remotePlayer->AddNewBlock(block_packet.piece_index);
             }
         }
     }
@@ -77,21 +66,11 @@ public:
             return;
         }
 
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != fall_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), fall_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(fall_packet, fall_packet.player_id);
 
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(fall_packet.player_id))
             {
                 remotePlayer->UpdateFallingBlock(fall_packet.falling_index, fall_packet.is_falling);
             }
@@ -121,22 +100,12 @@ public:
         }
 
         // ٸ ÷̾鿡   εĳƮ
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != state_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), state_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(state_packet, state_packet.player_id);
 
         //   Ʈ
         if (auto gameState = static_cast<GameState*>( GAME_APP.GetStateManager().GetCurrentState().get())) 
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(state_packet.player_id))
             {
                 remotePlayer->ChangeBlockState(state_packet.state);
             }
@@ -166,22 +135,12 @@ public:
         }
 
         // ٸ ÷̾鿡  Ǫ εĳƮ
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != pushPacket.player_id)
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), pushPacket);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(pushPacket, pushPacket.player_id);
 
         //   Ʈ
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(pushPacket.player_id))
             {
                 float pos1[2] = { pushPacket.position1[0], pushPacket.position1[1] };
                 float pos2[2] = { pushPacket.position2[0], pushPacket.position2[1] };
@@ -213,22 +172,12 @@ public:
         }
 
         // ٸ ÷̾鿡 üũ  
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != check_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), check_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(check_packet, check_packet.player_id);
 
         //   üũ 
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(check_packet.player_id))
             {
                 remotePlayer->CheckGameBlockState();
             }
@@ -257,22 +206,12 @@ public:
         }
 
         // ٸ ÷̾鿡 ȸ  
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != rotate_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), rotate_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(rotate_packet, rotate_packet.player_id);
 
         //   Ʈ
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(rotate_packet.player_id))
             {
                 remotePlayer->RotateBlock(rotate_packet.rotate_type, rotate_packet.is_horizontal_moving);
             }
@@ -343,23 +282,12 @@ public:
         }
 
         // ٸ ÷̾鿡    
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != fall_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), fall_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(fall_packet, fall_packet.player_id);
 
         //   Ʈ
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(fall_packet.player_id))
             {
                 remotePlayer->UpdateFallingBlock(fall_packet.falling_index, fall_packet.is_falling);
             }
@@ -382,22 +310,12 @@ public:
         const auto& move_packet = static_cast<const MoveBlockPacket&>(packet);
 
         // ٸ ÷̾鿡 εĳƮ
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != move_packet.player_id)
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), move_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(move_packet, move_packet.player_id);
 
         //   Ʈ
         if (auto gameState = dynamic_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(move_packet.player_id))
             {
                 remotePlayer->MoveBlock(move_packet.move_type, move_packet.position);
             }
@@ -426,23 +344,16 @@ public:
             return;
         }
 
-        //  ÷̾ 
-        auto& playerManager = GAME_APP.GetPlayerManager();
+        //  ÷̾  (   θ ̹Ƿ Ϻθ ߰)
+        if (FFA_MATCH.ShouldRelayPositionSync(sync_packet.player_id))
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != sync_packet.player_id)
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), sync_packet);
-                }
-            }
+            NETWORK.RelayToPlayers(sync_packet, sync_packet.player_id);
         }
 
         //   Ʈ
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(sync_packet.player_id))
             {
                 remotePlayer->SyncPositionY(sync_packet.position_y, sync_packet.velocity);
             }
@@ -34,18 +34,7 @@ public:
         }
 
         // ٸ ÷̾鿡   εĳƮ
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != select_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), select_packet);
-                }
-            }
-        }
+        NETWORK.RelayToPlayers(select_packet, select_packet.player_id);
 
         if (auto charSelect = dynamic_cast<CharacterSelectState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
@@ -18,6 +18,11 @@
 #include "../../../game/system/BasePlayer.hpp"
 #include "../../../game/system/RemotePlayer.hpp"
 #include "../../../game/system/LocalPlayer.hpp"
+#include "../../spectator/SpectatorBroadcaster.hpp"
+#include "../../../game/system/FfaMatch.hpp"
+
+#include <algorithm>
+#include <array>
 
 class AttackInterruptProcessor : public IPacketProcessor 
 {
@@ -36,6 +41,12 @@ public:
         //   ¿  ó
         if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
         {
+            if (FFA_MATCH.IsActive())
+            {
+                RouteTargetInterrupt(*gameState, attack_packet);
+                return;
+            }
+
             if (const auto& localPlayer = gameState->GetLocalPlayer())
             {
                 localPlayer->AddInterruptBlockCount(
@@ -45,6 +56,8 @@ public:
                     attack_packet.block_type
                 );
 
+                SPECTATOR_BROADCASTER.MarkGarbageSent(attack_packet.player_id, attack_packet.count);
+
                 // Ŷ    
                 AttackResultPlayerInterruptBlocCountPacket resultPacket;
                 resultPacket.player_id = GAME_APP.GetPlayerManager().GetMyPlayer()->GetId();
@@ -71,6 +84,32 @@ public:
     {
         return PacketType::AttackInterruptBlock;
     }
+
+private:
+
+    //  :    ڿ ˸  ȭ鿡 
+    static void RouteTargetInterrupt(GameState& gameState, const AttackInterruptPacket& attack_packet)
+    {
+        const auto route = FFA_MATCH.RouteAttack(attack_packet.player_id, attack_packet.count);
+        if (!route)
+        {
+            return;
+        }
+
+        TargetInterruptPacket target_packet;
+        target_packet.attacker_id = attack_packet.player_id;
+        target_packet.target_id = route->target_id;
+        target_packet.count = attack_packet.count;
+        target_packet.target_pending = route->target_pending;
+        target_packet.position_x = attack_packet.position_x;
+        target_packet.position_y = attack_packet.position_y;
+        target_packet.block_type = attack_packet.block_type;
+
+        NETWORK.RelayToPlayers(target_packet, GAME_APP.GetPlayerManager().GetMyPlayer()->GetId());
+
+        gameState.ApplyTargetInterrupt(target_packet);
+        SPECTATOR_BROADCASTER.MarkGarbageSent(attack_packet.player_id, attack_packet.count);
+    }
 };
 
 class DefenseInterruptProcessor : public IPacketProcessor
@@ -88,6 +127,29 @@ public:
         auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get());
         if (!gameState) return;
 
+        if (FFA_MATCH.IsActive())
+        {
+            //  :   ٸ ڿ, پ   ο
+            NETWORK.RelayToPlayers(defense_packet, defense_packet.player_id);
+
+            DefenseResultInterruptBlockCountPacket result_packet;
+            result_packet.player_id = defense_packet.player_id;
+            result_packet.count = static_cast<uint16_t>(FFA_MATCH.Defend(defense_packet.player_id, defense_packet.count));
+
+            NETWORK.RelayToPlayers(result_packet, GAME_APP.GetPlayerManager().GetMyPlayer()->GetId());
+
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(defense_packet.player_id))
+            {
+                remotePlayer->DefenseInterruptBlockCount(
+                    defense_packet.count,
+                    defense_packet.position_x,
+                    defense_packet.position_y,
+                    defense_packet.block_type
+                );
+            }
+            return;
+        }
+
         //    ó
         if (const auto& localPlayer = gameState->GetLocalPlayer()) 
         {
@@ -138,8 +200,17 @@ public:
         auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get());
         if (!gameState) return;
 
+        // 1:1   ÷̾  ̶  ߰ ʴ´
+        NETWORK.RelayToPlayers(interrupt_packet, interrupt_packet.player_id);
+
+        if (FFA_MATCH.IsActive())
+        {
+            FFA_MATCH.Drop(interrupt_packet.player_id,
+                static_cast<int16_t>(interrupt_packet.y_row_count * Constants::Board::BOARD_X_COUNT + interrupt_packet.x_count));
+        }
+
         //  ÷̾   ߰
-        if (const auto& remotePlayer = gameState->GetRemotePlayer()) 
+        if (const auto& remotePlayer = gameState->GetRemotePlayer(interrupt_packet.player_id)) 
         {
             std::span<const uint8_t> indices(
                 interrupt_packet.x_indices.data(),
@@ -171,24 +242,30 @@ public:
             return;
         }
 
-        // ٸ ÷̾鿡 ޺  
-        auto& playerManager = GAME_APP.GetPlayerManager();
+        auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get());
+        if (!gameState) return;
+
+        if (FFA_MATCH.IsActive())
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            //  : ̹ ⿡ ݹ ڿԸ 
+            std::array<uint8_t, FfaMatch::MAX_PLAYERS> targets{};
+            const auto targetCount = FFA_MATCH.TakeComboTargets(combo_packet.player_id, targets);
+            const auto targetIds = std::span<const uint8_t>(targets.data(), targetCount);
+
+            NETWORK.SendToPlayers(combo_packet, targetIds);
+
+            if (std::ranges::find(targetIds, gameState->GetLocalPlayer()->GetPlayerID()) != targetIds.end())
             {
-                if (player->GetId() != combo_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), combo_packet);
-                }
+                gameState->GetLocalPlayer()->SetComboAttackState(false);
             }
+            return;
         }
 
+        // ٸ ÷̾鿡 ޺  
+        NETWORK.RelayToPlayers(combo_packet, combo_packet.player_id);
+
         // ޺  
-        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
-        {
-			gameState->GetLocalPlayer()->SetComboAttackState(false);
-        }
+        gameState->GetLocalPlayer()->SetComboAttackState(false);
     }
 
     void Release() override {}
@@ -212,35 +289,38 @@ public:
         }
 
         // ٸ ÷̾鿡   
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
+        NETWORK.RelayToPlayers(lose_packet, lose_packet.player_id);
 
-            for (const auto& [_, player] : playerManager.GetPlayers())
+        //   ó
+        if (auto* gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
+        {
+            if (FFA_MATCH.IsActive())
             {
-                if (player->GetId() != lose_packet.player_id) 
+                //  :     
+                if (const auto winner = FFA_MATCH.Eliminate(lose_packet.player_id))
                 {
-                    NETWORK.SendToClient(player->GetNetInfo(), lose_packet);
+                    LOG_NETWORK(Info, "Player {} won the free-for-all match", *winner);
                 }
+
+                gameState->ApplyPlayerLose(lose_packet.player_id);
+                return;
             }
-        }
 
-        //   ó
-        if (auto* gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
-        {
             gameState->GameQuit();
 
-            const auto& remotePlayer = gameState->GetRemotePlayer();
             const auto& localPlayer = gameState->GetLocalPlayer();
             
-            if (lose_packet.player_id == remotePlayer->GetPlayerID())
+            if (const auto& remotePlayer = gameState->GetRemotePlayer(lose_packet.player_id))
             {
                 remotePlayer->LoseGame(false);
                 localPlayer->LoseGame(true);
             }
             else
             {
-                remotePlayer->LoseGame(true);
+                for (const auto& otherPlayer : gameState->GetRemotePlayers())
+                {
+                    otherPlayer->LoseGame(true);
+                }
                 localPlayer->LoseGame(false);
             }            
         }
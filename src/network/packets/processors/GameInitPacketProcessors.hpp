@@ -15,6 +15,9 @@
 #include "../../../states/GameState.hpp"
 #include "../../../network/NetworkController.hpp"
 #include "../../../network/player/Player.hpp"
+#include "../../../game/system/MatchRandom.hpp"
+#include "../../../game/system/FfaMatch.hpp"
+#include "../../../game/system/RemotePlayer.hpp"
 
 
 class InitializePlayerProcessor : public IPacketProcessor 
@@ -41,22 +44,29 @@ public:
             }
 
             // ٸ ÷̾鿡 εĳƮ
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != init_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), init_packet);
-                }
-            }
+            NETWORK.RelayToPlayers(init_packet, init_packet.player_id);
         }
 
         //  ÷̾ 
         if (auto gameState = dynamic_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-            std::span<const uint8_t, 2> blockType1{ init_packet.block_type1 };
-            std::span<const uint8_t, 2> blockType2{ init_packet.block_type2 };
+            //  غ ٸ Ŭ̾Ʈ  ÷̾ ˸ ( )
+            const uint8_t newPlayerId[] = { init_packet.player_id };
+            for (const auto& remotePlayer : gameState->GetRemotePlayers())
+            {
+                if (remotePlayer->GetPlayerID() == init_packet.player_id)
+                {
+                    continue;
+                }
+
+                InitializePlayerPacket other_packet;
+                other_packet.player_id = remotePlayer->GetPlayerID();
+                other_packet.character_idx = static_cast<uint16_t>(remotePlayer->GetCharacterID());
+
+                NETWORK.SendToPlayers(other_packet, newPlayerId);
+            }
 
-            gameState->CreateGamePlayer(blockType1, blockType2, init_packet.player_id, init_packet.character_idx);
+            gameState->CreateGamePlayer(init_packet.player_id, init_packet.character_idx);
         }
     }
 
@@ -82,31 +92,27 @@ public:
             return;
         }
 
-        // ٸ ÷̾鿡 εĳƮ
-        auto& playerManager = GAME_APP.GetPlayerManager();
+        // ٸ ÷̾鿡 εĳƮ (   ο  Ƿ Ŭ̾Ʈ  ߰ ʴ´)
+        if (!FFA_MATCH.IsActive())
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != restart_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), restart_packet);
-                }
-            }
+            NETWORK.RelayToPlayers(restart_packet, restart_packet.player_id);
         }
 
         //  
         if (auto game_state = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
         {
-            if (const auto& remotePlayer = game_state->GetRemotePlayer())
+            if (const auto& remotePlayer = game_state->GetRemotePlayer(restart_packet.player_id))
             {
-                std::span<const uint8_t, 2> blockType1{ restart_packet.block1 };
-                std::span<const uint8_t, 2> blockType2{ restart_packet.block2 };
+                // Ŭ̾Ʈ    õ    
+                if (restart_packet.seed != MATCH_RANDOM.GetSeed())
+                {
+                    MATCH_RANDOM.Reset(restart_packet.seed);
+                }
 
-                remotePlayer->Restart(blockType1, blockType2);
+                remotePlayer->Restart();
 
                 // α 
-                LOGGER.Info("Game restarted by player {}", restart_packet.player_id);
+                LOG_NETWORK(Info, "Game restarted by player {}", restart_packet.player_id);
             }
         }
     }
@@ -17,6 +17,7 @@
 #include "../../../network/player/Player.hpp"
 #include "../../../ui/EditBox.hpp"
 #include "../../../utils/StringUtils.hpp"
+#include "../../../utils/Logger.hpp"
 
 
 // κ  Ŷ μ
@@ -29,6 +30,13 @@ public:
     {
         const auto& lobby_packet = static_cast<const ConnectLobbyPacket&>(packet);
 
+        //     Ƿ  ο ⼭ 
+        if (GAME_APP.GetPlayerManager().GetPlayerCount() >= Constants::Network::MAX_CLIENT)
+        {
+            LOG_NETWORK(Warning, "Room is full, rejected player {}", lobby_packet.id);
+            return;
+        }
+
         auto new_player = GAME_APP.GetPlayerManager().CreatePlayer(lobby_packet.id, client);
 
         if (new_player != nullptr) 
@@ -0,0 +1,37 @@
+#pragma once
+/*
+ *
+ * :   Ŷ Ŭ 
+ *
+ */
+
+#include "IPacketProcessor.hpp"
+#include "../GamePackets.hpp"
+#include "../../../network/NetworkController.hpp"
+#include "../../../utils/Logger.hpp"
+
+
+class SpectateRequestProcessor : public IPacketProcessor 
+{
+public:
+    void Initialize() override {}
+
+    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    {
+        const auto& spectate_packet = static_cast<const SpectateRequestPacket&>(packet);
+
+        // ڴ PlayerManager   ʰ ̿ 
+        auto* relay = NETWORK.GetSpectatorRelay();
+        if (!relay || !relay->Subscribe(client))
+        {
+            LOG_NETWORK(Warning, "Spectate request rejected (id {})", spectate_packet.id);
+        }
+    }
+
+    void Release() override {}
+
+    [[nodiscard]] PacketType GetPacketType() const override 
+    { 
+        return PacketType::SpectateRequest; 
+    }
+};
@@ -0,0 +1,133 @@
+#include "SpectatorBroadcaster.hpp"
+#include "SpectatorRelay.hpp"
+
+#include "../NetworkController.hpp"
+#include "../../game/replay/MatchRecorder.hpp"
+#include "../../game/system/BasePlayer.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+SpectatorBroadcaster& SpectatorBroadcaster::GetInstance()
+{
+    static SpectatorBroadcaster instance;
+    return instance;
+}
+
+void SpectatorBroadcaster::Begin()
+{
+    encoder_.Reset();
+    markers_.clear();
+    previous_ids_.clear();
+    previous_combos_.clear();
+    previous_phases_.clear();
+
+    tick_ = 0;
+    next_snapshot_tick_ = 0;
+}
+
+bool SpectatorBroadcaster::HasSpectators() const
+{
+    const auto* relay = NETWORK.GetSpectatorRelay();
+    return relay && relay->GetSubscriberCount() > 0;
+}
+
+void SpectatorBroadcaster::Update(std::span<BasePlayer* const> players)
+{
+    ++tick_;
+
+    if (tick_ < next_snapshot_tick_)
+    {
+        return;
+    }
+
+    next_snapshot_tick_ = tick_ + Spectator::SNAPSHOT_INTERVAL;
+
+    if (!HasSpectators())
+    {
+        // ڰ  ȿ 带 ĸó ʰ,   ù  Ű ȴ
+        markers_.clear();
+        previous_ids_.clear();
+        return;
+    }
+
+    frame_.tick = tick_;
+    frame_.player_ids.clear();
+    frame_.boards.clear();
+    combos_.clear();
+
+    for (BasePlayer* player : players)
+    {
+        if (player && frame_.player_ids.size() < Spectator::MAX_BOARDS)
+        {
+            frame_.player_ids.push_back(player->GetPlayerID());
+            frame_.boards.push_back(MatchRecorder::CaptureBoard(*player));
+            combos_.push_back(player->GetComboCount());
+        }
+    }
+
+    CollectStateMarkers();
+
+    frame_.markers.swap(markers_);
+    markers_.clear();
+
+    writer_.Clear();
+    encoder_.Encode(frame_, NETWORK.GetSpectatorRelay()->ConsumeKeyframeRequest(), writer_);
+
+    NETWORK.PublishSpectatorFrame(writer_.GetBytes(), encoder_.IsLastKeyframe());
+}
+
+void SpectatorBroadcaster::MarkGarbageSent(uint8_t playerId, int16_t count)
+{
+    if (count > 0 && HasSpectators())
+    {
+        AddMarker(Spectator::MarkerType::GarbageSent, playerId, count);
+    }
+}
+
+void SpectatorBroadcaster::AddMarker(Spectator::MarkerType type, uint8_t playerId, int32_t value)
+{
+    if (markers_.size() < Spectator::MAX_MARKERS)
+    {
+        markers_.push_back({ type, playerId, value });
+    }
+}
+
+void SpectatorBroadcaster::CollectStateMarkers()
+{
+    constexpr uint8_t GAME_OVER = static_cast<uint8_t>(GamePhase::GameOver);
+
+    for (size_t i = 0; i < frame_.player_ids.size(); ++i)
+    {
+        const uint8_t id = frame_.player_ids[i];
+        const uint8_t combo = combos_[i];
+        const uint8_t phase = frame_.boards[i].phase;
+
+        const auto it = std::find(previous_ids_.begin(), previous_ids_.end(), id);
+        if (it == previous_ids_.end())
+        {
+            continue;
+        }
+
+        const size_t previous = static_cast<size_t>(std::distance(previous_ids_.begin(), it));
+
+        //  ̿ Ⱑ  ܰ   Ƿ     Ǵ
+        if (combo > previous_combos_[previous])
+        {
+            AddMarker(previous_combos_[previous] == 0 ? Spectator::MarkerType::ChainStart : Spectator::MarkerType::ChainStep, id, combo);
+        }
+
+        if (phase == GAME_OVER && previous_phases_[previous] != GAME_OVER)
+        {
+            AddMarker(Spectator::MarkerType::GameOver, id, 0);
+        }
+    }
+
+    previous_ids_ = frame_.player_ids;
+    previous_combos_ = combos_;
+    previous_phases_.clear();
+    for (const auto& board : frame_.boards)
+    {
+        previous_phases_.push_back(board.phase);
+    }
+}
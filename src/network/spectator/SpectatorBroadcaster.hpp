@@ -0,0 +1,64 @@
+#pragma once
+/*
+*
+* : ()    ̷ 
+* 1. Spectator::SNAPSHOT_INTERVAL ƽ  带 ĸó  Ӱ и ڵ (ڰ  ĸó )
+* 2. ̺Ʈ Ŀ:  /      ȭ,     Ŷ ó  
+* 3.  ġ   ڵϰ     Ʈ ̰  
+* 4.   
+*
+*/
+
+#include "SpectatorFrame.hpp"
+
+#include <span>
+#include <vector>
+
+class BasePlayer;
+
+class SpectatorBroadcaster
+{
+public:
+
+    static SpectatorBroadcaster& GetInstance();
+
+    SpectatorBroadcaster(const SpectatorBroadcaster&) = delete;
+    SpectatorBroadcaster& operator=(const SpectatorBroadcaster&) = delete;
+    SpectatorBroadcaster(SpectatorBroadcaster&&) = delete;
+    SpectatorBroadcaster& operator=(SpectatorBroadcaster&&) = delete;
+
+    // ġ /  (  Ű)
+    void Begin();
+
+    //  GameState::Update  ȣ
+    void Update(std::span<BasePlayer* const> players);
+
+    void MarkGarbageSent(uint8_t playerId, int16_t count);
+
+private:
+
+    SpectatorBroadcaster() = default;
+    ~SpectatorBroadcaster() = default;
+
+    [[nodiscard]] bool HasSpectators() const;
+    void AddMarker(Spectator::MarkerType type, uint8_t playerId, int32_t value);
+    void CollectStateMarkers();
+
+private:
+
+    Spectator::FrameEncoder encoder_;
+    Spectator::Frame frame_;
+    Replay::ByteWriter writer_;
+    std::vector<Spectator::Marker> markers_;
+
+    //    / ܰ (frame_.player_ids   )
+    std::vector<uint8_t> previous_ids_;
+    std::vector<uint8_t> previous_combos_;
+    std::vector<uint8_t> previous_phases_;
+    std::vector<uint8_t> combos_;
+
+    uint64_t tick_{ 0 };
+    uint64_t next_snapshot_tick_{ 0 };
+};
+
+#define SPECTATOR_BROADCASTER SpectatorBroadcaster::GetInstance()
@@ -0,0 +1,259 @@
+#include "SpectatorFrame.hpp"
+
+#include <algorithm>
+
+namespace Spectator
+{
+    namespace
+    {
+        constexpr uint8_t FLAG_KEYFRAME = 0x01;
+
+        // 庰  Ʈ
+        constexpr uint8_t CELLS_DELTA = 0x01;
+        constexpr uint8_t CELLS_FULL = 0x02;
+        constexpr uint8_t SCORE_CHANGED = 0x04;
+        constexpr uint8_t GARBAGE_CHANGED = 0x08;
+        constexpr uint8_t PHASE_CHANGED = 0x10;
+
+        constexpr uint32_t CELL_TYPE_BITS = 4;
+
+        size_t GetVarintSize(uint64_t value)
+        {
+            size_t size = 1;
+            while (value >= 0x80)
+            {
+                value >>= 7;
+                ++size;
+            }
+            return size;
+        }
+
+        void WriteBoard(Replay::ByteWriter& writer, const Replay::BoardSnapshot& board, const Replay::BoardSnapshot* previous)
+        {
+            uint8_t mask = 0;
+            size_t deltaSize = 0;
+            uint32_t changedCount = 0;
+
+            if (previous)
+            {
+                for (size_t i = 0; i < Replay::BOARD_CELLS; ++i)
+                {
+                    if (board.cells[i] != previous->cells[i])
+                    {
+                        deltaSize += GetVarintSize((i << CELL_TYPE_BITS) | board.cells[i]);
+                        ++changedCount;
+                    }
+                }
+
+                if (changedCount > 0)
+                {
+                    deltaSize += GetVarintSize(changedCount);
+                    mask |= (deltaSize < Replay::PACKED_BOARD_SIZE) ? CELLS_DELTA : CELLS_FULL;
+                }
+                if (board.score != previous->score) mask |= SCORE_CHANGED;
+                if (board.pending_garbage != previous->pending_garbage) mask |= GARBAGE_CHANGED;
+                if (board.phase != previous->phase) mask |= PHASE_CHANGED;
+            }
+            else
+            {
+                mask = CELLS_FULL | SCORE_CHANGED | GARBAGE_CHANGED | PHASE_CHANGED;
+            }
+
+            writer.WriteByte(mask);
+
+            if (mask & CELLS_DELTA)
+            {
+                writer.WriteVarint(changedCount);
+                for (size_t i = 0; i < Replay::BOARD_CELLS; ++i)
+                {
+                    if (board.cells[i] != previous->cells[i])
+                    {
+                        writer.WriteVarint((i << CELL_TYPE_BITS) | board.cells[i]);
+                    }
+                }
+            }
+            else if (mask & CELLS_FULL)
+            {
+                Replay::WriteCells(writer, board.cells);
+            }
+
+            if (mask & SCORE_CHANGED) writer.WriteVarint(board.score);
+            if (mask & GARBAGE_CHANGED) writer.WriteSigned(board.pending_garbage);
+            if (mask & PHASE_CHANGED) writer.WriteByte(board.phase);
+        }
+
+        bool ReadBoard(Replay::ByteReader& reader, Replay::BoardSnapshot& board)
+        {
+            uint8_t mask = 0;
+            if (!reader.ReadByte(mask))
+            {
+                return false;
+            }
+
+            if (mask & CELLS_DELTA)
+            {
+                uint64_t changedCount = 0;
+                if (!reader.ReadVarint(changedCount) || changedCount > Replay::BOARD_CELLS)
+                {
+                    return false;
+                }
+
+                for (uint64_t i = 0; i < changedCount; ++i)
+                {
+                    uint64_t cell = 0;
+                    if (!reader.ReadVarint(cell) || (cell >> CELL_TYPE_BITS) >= Replay::BOARD_CELLS)
+                    {
+                        return false;
+                    }
+                    board.cells[cell >> CELL_TYPE_BITS] = static_cast<uint8_t>(cell & ((1u << CELL_TYPE_BITS) - 1));
+                }
+            }
+            else if ((mask & CELLS_FULL) && !Replay::ReadCells(reader, board.cells))
+            {
+                return false;
+            }
+
+            if (mask & SCORE_CHANGED)
+            {
+                uint64_t score = 0;
+                if (!reader.ReadVarint(score))
+                {
+                    return false;
+                }
+                board.score = static_cast<uint32_t>(score);
+            }
+
+            if (mask & GARBAGE_CHANGED)
+            {
+                int64_t pending = 0;
+                if (!reader.ReadSigned(pending))
+                {
+                    return false;
+                }
+                board.pending_garbage = static_cast<int16_t>(pending);
+            }
+
+            return !(mask & PHASE_CHANGED) || reader.ReadByte(board.phase);
+        }
+    }
+
+    void FrameEncoder::Reset()
+    {
+        player_ids_.clear();
+        boards_.clear();
+        sequence_ = 0;
+        frames_since_keyframe_ = 0;
+        is_last_keyframe_ = false;
+    }
+
+    void FrameEncoder::Encode(const Frame& frame, bool forceKeyframe, Replay::ByteWriter& writer)
+    {
+        const bool isKeyframe = forceKeyframe || boards_.empty() || player_ids_ != frame.player_ids ||
+            frames_since_keyframe_ + 1 >= KEYFRAME_INTERVAL;
+
+        writer.WriteByte(isKeyframe ? FLAG_KEYFRAME : 0);
+        writer.WriteVarint(++sequence_);
+        writer.WriteVarint(frame.tick);
+
+        const size_t boardCount = std::min(frame.boards.size(), MAX_BOARDS);
+        writer.WriteByte(static_cast<uint8_t>(boardCount));
+
+        for (size_t i = 0; i < boardCount; ++i)
+        {
+            writer.WriteByte(frame.player_ids[i]);
+            WriteBoard(writer, frame.boards[i], isKeyframe ? nullptr : &boards_[i]);
+        }
+
+        const size_t markerCount = std::min(frame.markers.size(), MAX_MARKERS);
+        writer.WriteByte(static_cast<uint8_t>(markerCount));
+
+        for (size_t i = 0; i < markerCount; ++i)
+        {
+            writer.WriteByte(static_cast<uint8_t>(frame.markers[i].type));
+            writer.WriteByte(frame.markers[i].player_id);
+            writer.WriteSigned(frame.markers[i].value);
+        }
+
+        player_ids_.assign(frame.player_ids.begin(), frame.player_ids.begin() + boardCount);
+        boards_.assign(frame.boards.begin(), frame.boards.begin() + boardCount);
+        frames_since_keyframe_ = isKeyframe ? 0 : frames_since_keyframe_ + 1;
+        is_last_keyframe_ = isKeyframe;
+    }
+
+    void FrameDecoder::Reset()
+    {
+        player_ids_.clear();
+        boards_.clear();
+        sequence_ = 0;
+        tick_ = 0;
+        is_synced_ = false;
+    }
+
+    bool FrameDecoder::Apply(std::span<const uint8_t> bytes, std::vector<Marker>& markers)
+    {
+        markers.clear();
+
+        Replay::ByteReader reader(bytes);
+        uint8_t flags = 0, boardCount = 0;
+        uint64_t sequence = 0, tick = 0;
+
+        if (!reader.ReadByte(flags) || !reader.ReadVarint(sequence) || !reader.ReadVarint(tick) ||
+            !reader.ReadByte(boardCount) || boardCount > MAX_BOARDS)
+        {
+            return false;
+        }
+
+        const bool isKeyframe = (flags & FLAG_KEYFRAME) != 0;
+
+        //  ̾     Ÿ   ִ
+        bool canApply = isKeyframe ||
+            (is_synced_ && sequence == sequence_ + 1 && boardCount == boards_.size());
+
+        std::vector<uint8_t> playerIds(boardCount);
+        std::vector<Replay::BoardSnapshot> boards = canApply && !isKeyframe ? boards_ : std::vector<Replay::BoardSnapshot>(boardCount);
+
+        for (size_t i = 0; i < boardCount; ++i)
+        {
+            if (!reader.ReadByte(playerIds[i]) || !ReadBoard(reader, boards[i]))
+            {
+                return false;
+            }
+        }
+
+        if (canApply && !isKeyframe && playerIds != player_ids_)
+        {
+            canApply = false;
+        }
+
+        uint8_t markerCount = 0;
+        if (!reader.ReadByte(markerCount) || markerCount > MAX_MARKERS)
+        {
+            return false;
+        }
+
+        markers.resize(markerCount);
+        for (auto& marker : markers)
+        {
+            uint8_t type = 0;
+            int64_t value = 0;
+            if (!reader.ReadByte(type) || type >= static_cast<uint8_t>(MarkerType::Count) ||
+                !reader.ReadByte(marker.player_id) || !reader.ReadSigned(value))
+            {
+                return false;
+            }
+            marker.type = static_cast<MarkerType>(type);
+            marker.value = static_cast<int32_t>(value);
+        }
+
+        sequence_ = static_cast<uint32_t>(sequence);
+        tick_ = tick;
+        is_synced_ = canApply;
+
+        if (canApply)
+        {
+            player_ids_ = std::move(playerIds);
+            boards_ = std::move(boards);
+        }
+        return true;
+    }
+}
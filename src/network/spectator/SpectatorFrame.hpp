@@ -0,0 +1,96 @@
+#pragma once
+/*
+*
+* :    (SpectatorFramePacket  )
+* 1. : ÷ + /ƽ(varint) +   + ̺Ʈ Ŀ 
+* 2.   Ӱ ޶ ĭ (ĭ ε << 4 |  ) varint  ϰ,
+*    ٲ ĭ    4Ʈ 庸 Ŀ  常 ü ĭ 
+* 3. /   / ܰ赵 ٲ   (庰  Ʈ)
+* 4. Ű   ü    ڳ  ģ ڰ ̾   ְ Ѵ
+* 5.   ڴ  Űӱ Ÿ  
+*
+*/
+
+#include "../../game/replay/ReplayFormat.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Spectator
+{
+    inline constexpr uint64_t SNAPSHOT_INTERVAL = Constants::Time::LOGIC_RATE / 10;   // ƽ (ʴ 10 )
+    inline constexpr uint32_t KEYFRAME_INTERVAL = 50;                                // 
+    inline constexpr size_t MAX_BOARDS = Replay::MAX_PLAYERS;
+    inline constexpr size_t MAX_MARKERS = 16;
+
+    enum class MarkerType : uint8_t
+    {
+        ChainStart,     //   (: ù ÿ Ȯε  )
+        ChainStep,      //   (:   )
+        GarbageSent,    //    (:    )
+        GameOver,
+        Count
+    };
+
+    struct Marker
+    {
+        MarkerType type{ MarkerType::ChainStart };
+        uint8_t player_id{ 0 };
+        int32_t value{ 0 };
+    };
+
+    struct Frame
+    {
+        uint64_t tick{ 0 };
+        std::vector<uint8_t> player_ids;
+        std::vector<Replay::BoardSnapshot> boards;
+        std::vector<Marker> markers;
+    };
+
+    //  ġ ϳ,   带  и 
+    class FrameEncoder
+    {
+    public:
+
+        void Reset();
+
+        //   ٲų KEYFRAME_INTERVAL   forceKeyframe   Ű
+        void Encode(const Frame& frame, bool forceKeyframe, Replay::ByteWriter& writer);
+
+        [[nodiscard]] bool IsLastKeyframe() const { return is_last_keyframe_; }
+        [[nodiscard]] uint32_t GetSequence() const { return sequence_; }
+
+    private:
+
+        std::vector<uint8_t> player_ids_;
+        std::vector<Replay::BoardSnapshot> boards_;
+        uint32_t sequence_{ 0 };
+        uint32_t frames_since_keyframe_{ 0 };
+        bool is_last_keyframe_{ false };
+    };
+
+    //  Ŭ̾Ʈ    带 
+    class FrameDecoder
+    {
+    public:
+
+        // ߸ ̸ false, Ű ٸ  Ÿ  ǳʶٰ true (markers  ׻ ä)
+        [[nodiscard]] bool Apply(std::span<const uint8_t> bytes, std::vector<Marker>& markers);
+
+        void Reset();
+
+        [[nodiscard]] bool IsSynced() const { return is_synced_; }
+        [[nodiscard]] uint64_t GetTick() const { return tick_; }
+        [[nodiscard]] const std::vector<uint8_t>& GetPlayerIds() const { return player_ids_; }
+        [[nodiscard]] const std::vector<Replay::BoardSnapshot>& GetBoards() const { return boards_; }
+
+    private:
+
+        std::vector<uint8_t> player_ids_;
+        std::vector<Replay::BoardSnapshot> boards_;
+        uint32_t sequence_{ 0 };
+        uint64_t tick_{ 0 };
+        bool is_synced_{ false };
+    };
+}
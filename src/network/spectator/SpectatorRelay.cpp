@@ -0,0 +1,108 @@
+#include "SpectatorRelay.hpp"
+
+#include "../NetServer.hpp"
+#include "../../utils/Logger.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+bool SpectatorRelay::Subscribe(ClientInfo* client)
+{
+    if (!client)
+    {
+        return false;
+    }
+
+    CriticalSection::Lock lock(critical_section_);
+
+    const bool exists = std::any_of(subscribers_.begin(), subscribers_.end(),
+        [client](const Subscriber& subscriber) { return subscriber.client == client; });
+
+    if (exists || subscribers_.size() >= Constants::Network::MAX_SPECTATOR)
+    {
+        return false;
+    }
+
+    subscribers_.push_back({ client, true });
+    keyframe_requested_ = true;
+
+    LOG_NETWORK(Info, "Spectator joined ({} watching)", subscribers_.size());
+    return true;
+}
+
+void SpectatorRelay::Unsubscribe(ClientInfo* client)
+{
+    CriticalSection::Lock lock(critical_section_);
+
+    const auto it = std::find_if(subscribers_.begin(), subscribers_.end(),
+        [client](const Subscriber& subscriber) { return subscriber.client == client; });
+
+    if (it != subscribers_.end())
+    {
+        subscribers_.erase(it);
+        LOG_NETWORK(Info, "Spectator left ({} watching)", subscribers_.size());
+    }
+}
+
+void SpectatorRelay::Clear()
+{
+    CriticalSection::Lock lock(critical_section_);
+
+    subscribers_.clear();
+    keyframe_requested_ = false;
+}
+
+void SpectatorRelay::Publish(std::span<const char> packet, bool isKeyframe)
+{
+    targets_.clear();
+
+    {
+        CriticalSection::Lock lock(critical_section_);
+
+        for (auto& subscriber : subscribers_)
+        {
+            // и ڴ Ÿ  ʰ  ŰӺ ٽ ޴´
+            if (!isKeyframe && subscriber.client->send_queue.unsafe_size() >= MAX_QUEUED_FRAMES)
+            {
+                subscriber.needs_keyframe = true;
+            }
+
+            if (subscriber.needs_keyframe && !isKeyframe)
+            {
+                ++skipped_frames_;
+                continue;
+            }
+
+            subscriber.needs_keyframe = false;
+            targets_.push_back(subscriber.client);
+        }
+    }
+
+    if (targets_.empty())
+    {
+        return;
+    }
+
+    // ۽     ó Unsubscribe  ҸǷ  ۿ 
+    const auto frame = std::make_shared<SendQueueData>(packet);
+    for (ClientInfo* client : targets_)
+    {
+        if (server_.SendShared(client, frame))
+        {
+            ++sent_frames_;
+        }
+    }
+}
+
+bool SpectatorRelay::ConsumeKeyframeRequest()
+{
+    CriticalSection::Lock lock(critical_section_);
+    return std::exchange(keyframe_requested_, false);
+}
+
+size_t SpectatorRelay::GetSubscriberCount() const
+{
+    CriticalSection::Lock lock(critical_section_);
+    return subscribers_.size();
+}
@@ -0,0 +1,65 @@
+#pragma once
+/*
+*
+* :  Ҿƿ 
+* 1. ڵ  Ŷ SendQueueData ϳ    ۽ ť  ۸  (ں ڵ/ )
+* 2. ڴ PlayerManager  ϵ Ƿ BroadcastPacket    Ŷ  ʴ´
+* 3.  ڿ ۽ ť MAX_QUEUED_FRAMES  ѱ ڴ  Űӱ Ÿ  ǳʶڴ
+* 4.  ڰ  Ű û    Ű ڵϰ Ѵ
+* 5. /  ,      Ŀ 忡 ȣ
+*
+*/
+
+#include "../CriticalSection.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class NetServer;
+struct ClientInfo;
+
+class SpectatorRelay
+{
+public:
+
+    static constexpr size_t MAX_QUEUED_FRAMES = 32;
+
+    explicit SpectatorRelay(NetServer& server) : server_(server) {}
+
+    SpectatorRelay(const SpectatorRelay&) = delete;
+    SpectatorRelay& operator=(const SpectatorRelay&) = delete;
+    SpectatorRelay(SpectatorRelay&&) = delete;
+    SpectatorRelay& operator=(SpectatorRelay&&) = delete;
+
+    bool Subscribe(ClientInfo* client);
+    void Unsubscribe(ClientInfo* client);
+    void Clear();
+
+    // packet   ϼ SpectatorFramePacket Ʈ
+    void Publish(std::span<const char> packet, bool isKeyframe);
+
+    //  ڰ Ű ٸ ̸ true  ְ û 
+    [[nodiscard]] bool ConsumeKeyframeRequest();
+
+    [[nodiscard]] size_t GetSubscriberCount() const;
+    [[nodiscard]] uint64_t GetSentFrameCount() const { return sent_frames_; }
+    [[nodiscard]] uint64_t GetSkippedFrameCount() const { return skipped_frames_; }
+
+private:
+
+    struct Subscriber
+    {
+        ClientInfo* client{ nullptr };
+        bool needs_keyframe{ true };
+    };
+
+    NetServer& server_;
+    mutable CriticalSection critical_section_{};
+    std::vector<Subscriber> subscribers_;
+    std::vector<ClientInfo*> targets_;      // Publish  ( )
+    bool keyframe_requested_{ false };
+
+    uint64_t sent_frames_{ 0 };
+    uint64_t skipped_frames_{ 0 };
+};
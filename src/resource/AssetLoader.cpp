@@ -0,0 +1,286 @@
+#include "AssetLoader.hpp"
+#include "../core/GameApp.hpp"
+#include "../core/manager/ResourceManager.hpp"
+#include "../texture/ImageTexture.hpp"
+#include "../utils/Logger.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    double ElapsedMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+AssetLoader& AssetLoader::GetInstance()
+{
+    static AssetLoader instance;
+    return instance;
+}
+
+AssetLoader::~AssetLoader()
+{
+    Release();
+}
+
+void AssetLoader::Initialize(size_t workerCount)
+{
+    if (!workers_.empty())
+    {
+        return;
+    }
+
+    if (workerCount == 0)
+    {
+        const size_t hardware = std::thread::hardware_concurrency();
+        workerCount = std::min(MAX_WORKERS, hardware > 1 ? hardware - 1 : 0);
+    }
+
+    is_stopping_ = false;
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        workers_.emplace_back(&AssetLoader::WorkerLoop, this);
+    }
+
+    LOG_RESOURCE(Info, "AssetLoader initialized with {} worker(s)", workerCount);
+}
+
+void AssetLoader::Release()
+{
+    {
+        std::lock_guard<std::mutex> lock(decode_mutex_);
+        is_stopping_ = true;
+    }
+    decode_cv_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    workers_.clear();
+
+    //   û з ϷϿ ٸ   ʰ Ѵ.
+    const auto abandon = [](std::deque<std::shared_ptr<LoadRequest>>& queue)
+        {
+            for (auto& request : queue)
+            {
+                if (request->surface)
+                {
+                    SDL_DestroySurface(request->surface);
+                    request->surface = nullptr;
+                }
+                request->promise.set_value(nullptr);
+            }
+            queue.clear();
+        };
+
+    abandon(decode_queue_);
+    abandon(upload_queue_);
+    pending_.clear();
+}
+
+AssetLoader::TextureFuture AssetLoader::LoadTextureAsync(const std::string& path)
+{
+    if (auto it = pending_.find(path); it != pending_.end())
+    {
+        return it->second;
+    }
+
+    auto& resource_manager = GAME_APP.GetResourceManager();
+
+    if (auto texture = resource_manager.FindResource<ImageTexture>(path))
+    {
+        std::promise<std::shared_ptr<ImageTexture>> ready;
+        ready.set_value(std::move(texture));
+        return ready.get_future().share();
+    }
+
+    auto request = std::make_shared<LoadRequest>();
+    request->key = path;
+    request->full_path = resource_manager.GetFullPath<ImageTexture>(path);
+    request->queued_at = Clock::now();
+
+    TextureFuture future = request->promise.get_future().share();
+    pending_.emplace(path, future);
+
+    if (workers_.empty())
+    {
+        // Ŀ  ȣ 忡 ڵϰ ε常 ť ѱ.
+        Decode(*request);
+
+        std::lock_guard<std::mutex> lock(upload_mutex_);
+        upload_queue_.push_back(std::move(request));
+    }
+    else
+    {
+        {
+            std::lock_guard<std::mutex> lock(decode_mutex_);
+            decode_queue_.push_back(std::move(request));
+        }
+        decode_cv_.notify_one();
+    }
+
+    return future;
+}
+
+std::vector<AssetLoader::TextureFuture> AssetLoader::LoadTexturesAsync(std::span<const std::string> paths)
+{
+    std::vector<TextureFuture> futures;
+    futures.reserve(paths.size());
+
+    for (const auto& path : paths)
+    {
+        futures.push_back(LoadTextureAsync(path));
+    }
+
+    return futures;
+}
+
+void AssetLoader::Preload(std::span<const std::string> paths)
+{
+    const size_t before = pending_.size();
+    (void)LoadTexturesAsync(paths);
+
+    LOG_RESOURCE(Debug, "Preloading {} texture(s) ({} newly queued)", paths.size(), pending_.size() - before);
+}
+
+bool AssetLoader::WaitAll(std::span<const TextureFuture> futures)
+{
+    const auto start = Clock::now();
+
+    const auto is_ready = [](const TextureFuture& future)
+        {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        };
+
+    while (true)
+    {
+        // ؽó   忡 ϹǷ ٸ ȿ ε带  ó
+        ProcessUploads(std::numeric_limits<double>::max());
+
+        if (std::all_of(futures.begin(), futures.end(), is_ready))
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(upload_mutex_);
+        upload_cv_.wait_for(lock, WAIT_POLL_INTERVAL, [this]() { return !upload_queue_.empty(); });
+    }
+
+    const bool all_loaded = std::all_of(futures.begin(), futures.end(), [](const TextureFuture& future)
+        {
+            return future.get() != nullptr;
+        });
+
+    LOG_RESOURCE(Info, "Loaded {} texture(s) in {:.2f}ms", futures.size(), ElapsedMs(start, Clock::now()));
+    return all_loaded;
+}
+
+bool AssetLoader::LoadTextures(std::span<const std::string> paths)
+{
+    const auto futures = LoadTexturesAsync(paths);
+    return WaitAll(futures);
+}
+
+void AssetLoader::ProcessUploads(double budgetMs)
+{
+    const auto start = Clock::now();
+
+    while (ElapsedMs(start, Clock::now()) < budgetMs)
+    {
+        std::shared_ptr<LoadRequest> request;
+        {
+            std::lock_guard<std::mutex> lock(upload_mutex_);
+            if (upload_queue_.empty())
+            {
+                return;
+            }
+
+            request = std::move(upload_queue_.front());
+            upload_queue_.pop_front();
+        }
+
+        Upload(*request);
+    }
+}
+
+void AssetLoader::WorkerLoop()
+{
+    while (true)
+    {
+        std::shared_ptr<LoadRequest> request;
+        {
+            std::unique_lock<std::mutex> lock(decode_mutex_);
+            decode_cv_.wait(lock, [this]() { return is_stopping_ || !decode_queue_.empty(); });
+
+            if (is_stopping_)
+            {
+                return;
+            }
+
+            request = std::move(decode_queue_.front());
+            decode_queue_.pop_front();
+        }
+
+        Decode(*request);
+
+        {
+            std::lock_guard<std::mutex> lock(upload_mutex_);
+            upload_queue_.push_back(std::move(request));
+        }
+        upload_cv_.notify_one();
+    }
+}
+
+void AssetLoader::Decode(LoadRequest& request) const
+{
+    const auto start = Clock::now();
+    request.surface = ImageTexture::DecodeSurface(request.full_path);
+    request.decoded_at = Clock::now();
+    request.decode_ms = ElapsedMs(start, request.decoded_at);
+
+    if (!request.surface)
+    {
+        LOG_RESOURCE(Error, "Unable to decode image {}: {}", request.full_path, SDL_GetError());
+    }
+}
+
+void AssetLoader::Upload(LoadRequest& request)
+{
+    std::shared_ptr<ImageTexture> texture;
+    const auto start = Clock::now();
+
+    if (request.surface)
+    {
+        auto created = std::make_shared<ImageTexture>();
+        if (created->LoadFromSurface(request.full_path, request.surface))
+        {
+            //    ε ̹ ϵǾٸ  ҽ 
+            texture = GAME_APP.GetResourceManager().AddResource<ImageTexture>(request.key, std::move(created));
+        }
+        else
+        {
+            LOG_RESOURCE(Error, "Unable to create texture {}: {}", request.full_path, SDL_GetError());
+        }
+
+        SDL_DestroySurface(request.surface);
+        request.surface = nullptr;
+    }
+
+    const auto end = Clock::now();
+
+    LOG_RESOURCE(Debug, "Loaded {} decode={:.2f}ms queued={:.2f}ms upload={:.2f}ms total={:.2f}ms",
+        request.key, request.decode_ms, ElapsedMs(request.decoded_at, start), ElapsedMs(start, end), ElapsedMs(request.queued_at, end));
+
+    pending_.erase(request.key);
+    request.promise.set_value(std::move(texture));
+}
@@ -0,0 +1,106 @@
+#pragma once
+/*
+*
+* : ̹  񵿱 δ
+* 1. PNG ڵ(SDL_Surface ) Ŀ  Ǯ ķ ó
+* 2. ڵ ǥ ε ť ̰, () 尡   ProcessUploads  ؽó ȯ
+* 3. û ImageTexture::Create   θ Ű ϸ, ϷǸ ResourceManager ĳÿ 
+* 4. ´ Preload    ؽó ̸ ûϰ, Init  LoadTextures   ۾ ٸ
+* 5. º ڵ//ε ð LOG_RESOURCE(Debug)  
+*
+*/
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class ImageTexture;
+struct SDL_Surface;
+
+class AssetLoader
+{
+public:
+
+    using TextureFuture = std::shared_future<std::shared_ptr<ImageTexture>>;
+
+    static constexpr size_t MAX_WORKERS = 4;
+    static constexpr double DEFAULT_UPLOAD_BUDGET_MS = 4.0;
+    static constexpr auto WAIT_POLL_INTERVAL = std::chrono::milliseconds(2);
+
+    static AssetLoader& GetInstance();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+    AssetLoader(AssetLoader&&) = delete;
+    AssetLoader& operator=(AssetLoader&&) = delete;
+
+    // workerCount == 0 ̸ ϵ    
+    void Initialize(size_t workerCount = 0);
+    void Release();
+
+    // Ʒ û Լ  忡 ȣ (ResourceManager ĳø ȸ/)
+    [[nodiscard]] TextureFuture LoadTextureAsync(const std::string& path);
+    [[nodiscard]] std::vector<TextureFuture> LoadTexturesAsync(std::span<const std::string> paths);
+
+    //  ٸ ʴ  ε (  )
+    void Preload(std::span<const std::string> paths);
+
+    // ε ť óϸ鼭  û   , ϳ ϸ false
+    [[nodiscard]] bool WaitAll(std::span<const TextureFuture> futures);
+    [[nodiscard]] bool LoadTextures(std::span<const std::string> paths);
+
+    //  忡   ȣ, budgetMs  ڵ  ǥ ؽó ε
+    void ProcessUploads(double budgetMs = DEFAULT_UPLOAD_BUDGET_MS);
+
+    [[nodiscard]] size_t GetPendingCount() const { return pending_.size(); }
+    [[nodiscard]] size_t GetWorkerCount() const { return workers_.size(); }
+
+private:
+
+    using Clock = std::chrono::steady_clock;
+
+    struct LoadRequest
+    {
+        std::string key;
+        std::string full_path;
+        std::promise<std::shared_ptr<ImageTexture>> promise;
+
+        SDL_Surface* surface{ nullptr };
+        Clock::time_point queued_at;
+        Clock::time_point decoded_at;
+        double decode_ms{ 0.0 };
+    };
+
+    AssetLoader() = default;
+    ~AssetLoader();
+
+    void WorkerLoop();
+    void Decode(LoadRequest& request) const;
+    void Upload(LoadRequest& request);
+
+private:
+
+    std::vector<std::thread> workers_;
+
+    std::mutex decode_mutex_;
+    std::condition_variable decode_cv_;
+    std::deque<std::shared_ptr<LoadRequest>> decode_queue_;
+    bool is_stopping_{ false };
+
+    std::mutex upload_mutex_;
+    std::condition_variable upload_cv_;
+    std::deque<std::shared_ptr<LoadRequest>> upload_queue_;
+
+    //   :   û ( θ ߺ ڵ )
+    std::unordered_map<std::string, TextureFuture> pending_;
+};
+
+#define ASSET_LOADER AssetLoader::GetInstance()
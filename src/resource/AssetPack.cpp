@@ -0,0 +1,356 @@
+#include "AssetPack.hpp"
+#include "../utils/Logger.hpp"
+#include "../utils/PathUtil.hpp"
+
+#include <Windows.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    template<typename T>
+    void WriteValue(std::ofstream& stream, const T& value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void WritePadding(std::ofstream& stream, uint64_t alignment)
+    {
+        const auto position = static_cast<uint64_t>(stream.tellp());
+        const uint64_t padding = (alignment - position % alignment) % alignment;
+
+        static constexpr char zeros[AssetPack::DATA_ALIGNMENT] = {};
+        stream.write(zeros, static_cast<std::streamsize>(padding));
+    }
+
+    struct PackSource
+    {
+        std::filesystem::path file;
+        std::string name;
+        uint64_t hash{ 0 };
+    };
+}
+
+AssetPack& AssetPack::GetInstance()
+{
+    static AssetPack instance;
+    return instance;
+}
+
+AssetPack::~AssetPack()
+{
+    Close();
+}
+
+uint64_t AssetPack::HashPath(std::string_view normalizedPath)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : normalizedPath)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string AssetPack::NormalizePath(std::string_view path)
+{
+    std::string normalized;
+    normalized.reserve(path.size());
+
+    for (char c : path)
+    {
+        if (c == '\\')
+        {
+            c = '/';
+        }
+        else if (c >= 'A' && c <= 'Z')
+        {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+
+        // ߺ  
+        if (c == '/' && !normalized.empty() && normalized.back() == '/')
+        {
+            continue;
+        }
+
+        normalized.push_back(c);
+    }
+
+    while (normalized.starts_with("./"))
+    {
+        normalized.erase(0, 2);
+    }
+
+    return normalized;
+}
+
+bool AssetPack::Build(const std::filesystem::path& outputPath)
+{
+    try
+    {
+        std::vector<PackSource> sources;
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(PathUtil::ASSETS_ROOT))
+        {
+            if (entry.is_regular_file())
+            {
+                sources.push_back({ entry.path(), NormalizePath(entry.path().generic_string()) });
+            }
+        }
+
+        if (std::filesystem::exists(BOARD_FILE))
+        {
+            sources.push_back({ BOARD_FILE, NormalizePath(BOARD_FILE) });
+        }
+
+        for (auto& source : sources)
+        {
+            source.hash = HashPath(source.name);
+        }
+
+        std::sort(sources.begin(), sources.end(), [](const PackSource& lhs, const PackSource& rhs)
+            {
+                return lhs.hash < rhs.hash;
+            });
+
+        const auto collision = std::adjacent_find(sources.begin(), sources.end(), [](const PackSource& lhs, const PackSource& rhs)
+            {
+                return lhs.hash == rhs.hash;
+            });
+
+        if (collision != sources.end())
+        {
+            LOG_RESOURCE(Error, "Asset pack hash collision: {} / {}", collision->name, (collision + 1)->name);
+            return false;
+        }
+
+        std::ofstream stream(outputPath, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+            LOG_RESOURCE(Error, "Failed to create asset pack: {}", outputPath.string());
+            return false;
+        }
+
+        Header header{};
+        WriteValue(stream, header);
+
+        std::vector<Entry> entries;
+        entries.reserve(sources.size());
+
+        std::string names;
+        uint64_t data_size = 0;
+
+        for (const auto& source : sources)
+        {
+            std::ifstream input(source.file, std::ios::binary);
+            if (!input)
+            {
+                LOG_RESOURCE(Error, "Failed to read asset: {}", source.file.string());
+                return false;
+            }
+
+            const std::vector<char> bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+            WritePadding(stream, DATA_ALIGNMENT);
+
+            Entry entry{};
+            entry.hash = source.hash;
+            entry.offset = static_cast<uint64_t>(stream.tellp());
+            entry.size = bytes.size();
+            entry.name_offset = static_cast<uint32_t>(names.size());
+            entry.name_size = static_cast<uint32_t>(source.name.size());
+            entries.push_back(entry);
+
+            names.append(source.name);
+            stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            data_size += bytes.size();
+        }
+
+        WritePadding(stream, alignof(Entry));
+        header.toc_offset = static_cast<uint64_t>(stream.tellp());
+        stream.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+
+        header.names_offset = static_cast<uint64_t>(stream.tellp());
+        header.names_size = names.size();
+        stream.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+        header.magic = FILE_MAGIC;
+        header.version = FILE_VERSION;
+        header.entry_count = static_cast<uint32_t>(entries.size());
+
+        stream.seekp(0);
+        WriteValue(stream, header);
+
+        if (!stream)
+        {
+            LOG_RESOURCE(Error, "Failed to write asset pack: {}", outputPath.string());
+            return false;
+        }
+
+        LOG_RESOURCE(Info, "Asset pack built: {} file(s), {} bytes -> {}", entries.size(), data_size, outputPath.string());
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_RESOURCE(Error, "Asset pack build failed: {}", e.what());
+        return false;
+    }
+}
+
+bool AssetPack::Open(const std::filesystem::path& path)
+{
+    Close();
+
+    if (!std::filesystem::exists(path))
+    {
+        LOG_RESOURCE(Info, "Asset pack {} not found, loading loose files", path.string());
+        return false;
+    }
+
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        LOG_RESOURCE(Error, "Failed to open asset pack {}: {}", path.string(), GetLastError());
+        return false;
+    }
+
+    LARGE_INTEGER file_size{};
+    GetFileSizeEx(file, &file_size);
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+    view_ = static_cast<const std::byte*>(view);
+    view_size_ = static_cast<uint64_t>(file_size.QuadPart);
+
+    if (!view_)
+    {
+        LOG_RESOURCE(Error, "Failed to map asset pack {}: {}", path.string(), GetLastError());
+        Close();
+        return false;
+    }
+
+    Header header{};
+    if (view_size_ >= sizeof(Header))
+    {
+        std::memcpy(&header, view_, sizeof(Header));
+    }
+
+    const bool is_valid =
+        header.magic == FILE_MAGIC &&
+        header.version == FILE_VERSION &&
+        header.toc_offset % alignof(Entry) == 0 &&
+        header.toc_offset + static_cast<uint64_t>(header.entry_count) * sizeof(Entry) <= view_size_ &&
+        header.names_offset + header.names_size <= view_size_;
+
+    if (!is_valid)
+    {
+        LOG_RESOURCE(Error, "Invalid asset pack {}", path.string());
+        Close();
+        return false;
+    }
+
+    entries_ = { reinterpret_cast<const Entry*>(view_ + header.toc_offset), header.entry_count };
+    names_ = reinterpret_cast<const char*>(view_ + header.names_offset);
+    base_path_ = NormalizePath(PathUtil::GetExecutableBasePath());
+
+    LOG_RESOURCE(Info, "Asset pack {} mapped: {} file(s), {} bytes", path.string(), entries_.size(), view_size_);
+    return true;
+}
+
+void AssetPack::Close()
+{
+    if (view_)
+    {
+        UnmapViewOfFile(view_);
+    }
+
+    if (mapping_handle_)
+    {
+        CloseHandle(mapping_handle_);
+    }
+
+    if (file_handle_ && file_handle_ != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(file_handle_);
+    }
+
+    file_handle_ = nullptr;
+    mapping_handle_ = nullptr;
+    view_ = nullptr;
+    view_size_ = 0;
+    entries_ = {};
+    names_ = nullptr;
+}
+
+std::string_view AssetPack::ToRelativePath(std::string_view path) const
+{
+    if (!base_path_.empty() && path.starts_with(base_path_))
+    {
+        path.remove_prefix(base_path_.size());
+    }
+
+    return path;
+}
+
+std::span<const std::byte> AssetPack::Find(std::string_view path) const
+{
+    if (!IsOpen())
+    {
+        return {};
+    }
+
+    const std::string normalized = NormalizePath(path);
+    const std::string_view relative = ToRelativePath(normalized);
+    const uint64_t hash = HashPath(relative);
+
+    const auto it = std::lower_bound(entries_.begin(), entries_.end(), hash, [](const Entry& entry, uint64_t value)
+        {
+            return entry.hash < value;
+        });
+
+    if (it == entries_.end() || it->hash != hash ||
+        std::string_view(names_ + it->name_offset, it->name_size) != relative ||
+        it->offset + it->size > view_size_)
+    {
+        return {};
+    }
+
+    return { view_ + it->offset, static_cast<size_t>(it->size) };
+}
+
+SDL_IOStream* AssetPack::OpenIO(const std::string& path) const
+{
+    if (const auto data = Find(path); !data.empty())
+    {
+        return SDL_IOFromConstMem(data.data(), data.size());
+    }
+
+    return SDL_IOFromFile(path.c_str(), "rb");
+}
+
+bool AssetPack::ReadText(const std::string& path, std::string& text) const
+{
+    if (const auto data = Find(path); !data.empty())
+    {
+        text.assign(reinterpret_cast<const char*>(data.data()), data.size());
+        return true;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
@@ -0,0 +1,98 @@
+#pragma once
+/*
+*
+* : assets/   (puyo.txt) ϳ    (.ppk)
+* 1. --pack-assets [ ]  ϸ     ( Ŀ)
+* 2.    ü ޸ ϰ,  SDL_IOFromConstMem      
+* 3. (TOC) ȭ  (ҹ, '/') 64Ʈ FNV-1a ؽ÷ ĵǾ  Ž
+* 4.  ų ѿ  δ ó ũ  
+*
+*  : [Header][ (16 Ʈ )...][TOC Entry * entry_count][ ڿ]
+*
+*/
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class AssetPack
+{
+public:
+
+    static constexpr uint32_t FILE_MAGIC = 0x4B415050;   // "PPAK"
+    static constexpr uint32_t FILE_VERSION = 1;
+    static constexpr uint64_t DATA_ALIGNMENT = 16;
+    static constexpr const char* DEFAULT_PACK_FILE = "assets.ppk";
+    static constexpr const char* BOARD_FILE = "bin/puyo.txt";
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entry_count;
+        uint32_t reserved;
+        uint64_t toc_offset;
+        uint64_t names_offset;
+        uint64_t names_size;
+    };
+
+    struct Entry
+    {
+        uint64_t hash;
+        uint64_t offset;
+        uint64_t size;
+        uint32_t name_offset;
+        uint32_t name_size;
+    };
+
+    static AssetPack& GetInstance();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+    AssetPack(AssetPack&&) = delete;
+    AssetPack& operator=(AssetPack&&) = delete;
+
+    //  Ŀ: assets/ ü BOARD_FILE  outputPath  ´ ( δ  ۾ 丮)
+    [[nodiscard]] static bool Build(const std::filesystem::path& outputPath = DEFAULT_PACK_FILE);
+
+    [[nodiscard]] bool Open(const std::filesystem::path& path = DEFAULT_PACK_FILE);
+    void Close();
+    [[nodiscard]] bool IsOpen() const { return view_ != nullptr; }
+
+    // path   ("assets/image/PUYO/puyo_beta.png") Ǵ   η ϴ  
+    [[nodiscard]] std::span<const std::byte> Find(std::string_view path) const;
+
+    // ѿ  ε ޸𸮸,  ũ   SDL_IOStream (ȣ ʿ )
+    [[nodiscard]] SDL_IOStream* OpenIO(const std::string& path) const;
+
+    // ؽƮ (  ) ڿ 
+    [[nodiscard]] bool ReadText(const std::string& path, std::string& text) const;
+
+    [[nodiscard]] static uint64_t HashPath(std::string_view normalizedPath);
+    [[nodiscard]] static std::string NormalizePath(std::string_view path);
+
+private:
+
+    AssetPack() = default;
+    ~AssetPack();
+
+    [[nodiscard]] std::string_view ToRelativePath(std::string_view path) const;
+
+private:
+
+    void* file_handle_{ nullptr };
+    void* mapping_handle_{ nullptr };
+    const std::byte* view_{ nullptr };
+    uint64_t view_size_{ 0 };
+
+    std::span<const Entry> entries_;
+    const char* names_{ nullptr };
+    std::string base_path_;
+};
+
+#define ASSET_PACK AssetPack::GetInstance()
@@ -0,0 +1,20 @@
+#pragma once
+/*
+*
+* : ResourceManager  (intern) ҽ   ID
+* 1. ResourceManager::Intern   ڿ   ؼϰ,  ȸ 迭 ε O(1)
+* 2. ID  μ   ǹǷ Լ    ص ȴ (ҽ Ǿ ٽ ε)
+*
+*/
+
+#include <cstdint>
+
+struct ResourceHandle
+{
+    static constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+    uint32_t id{ INVALID_ID };
+
+    [[nodiscard]] bool IsValid() const { return id != INVALID_ID; }
+    [[nodiscard]] bool operator==(const ResourceHandle&) const = default;
+};
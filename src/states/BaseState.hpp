@@ -5,8 +5,10 @@
  *
  */
 #include <memory>
+#include <string>
 #include <string_view>
 #include <span>
+#include <vector>
 #include <SDL3/SDL_events.h>
 
 class BaseState 
@@ -25,6 +27,9 @@ public:
 
     [[nodiscard]] virtual std::string_view GetStateName() const = 0;
 
+    // Init  ϴ ؽó  (ImageTexture::Create   ),  ¿ ̸ ε  
+    virtual void CollectTexturePaths(std::vector<std::string>& paths) const {}
+
     [[nodiscard]] bool isInitialized() const { return initialized; }
     
 
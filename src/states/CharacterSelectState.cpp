@@ -150,8 +150,45 @@ bool CharacterSelectState::Init()
     }
 }
 
+void CharacterSelectState::CollectTexturePaths(std::vector<std::string>& paths) const
+{
+    paths.insert(paths.end(),
+        {
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_bg_b_2p_Cell_001.png",
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_bg_b_2p_Cell_002.png",
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_bg_on.png",
+            "CHARACTERSELECT/CHARSELE_MENU/0.png",
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_random.png",
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_null.png",
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_cursor_large.png",
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_cursor_1p.png",
+            "CHARACTERSELECT/CHARSELE_MENU/charselect_cursor_2p.png",
+            "UI/BUTTON/button.png"
+        });
+
+    // Init  ĳ ׸   ʻȭ   (  )
+    uint8_t fileIdx = 0;
+    for (uint8_t y = 0; y < Constants::Game::CharacterSelect::CHARACTER_GRID_HEIGHT; ++y)
+    {
+        for (uint8_t x = 0; x < Constants::Game::CharacterSelect::CHARACTER_GRID_WIDTH; ++x)
+        {
+            if ((y == 0 && x == 3) || (y == 3 && x == 3) || ((x == 0 || x == 6) && y >= 2))
+            {
+                continue;
+            }
+
+            paths.push_back(std::format("CHARACTERSELECT/CHARSELE_MENU/charselect_charicon_{:02d}.png", fileIdx));
+            paths.push_back(std::format("CHARACTERSELECT/VS2P_CHAR/charselect_vs2p_char_{:02d}.png", fileIdx));
+            ++fileIdx;
+        }
+    }
+}
+
 void CharacterSelectState::Enter() 
 {
+    // ĳ͸    ȭ(, Ʈ,  ) ؽó ̸ ε
+    GAME_APP.GetStateManager().PreloadState(StateManager::StateID::Game);
+
     if (NETWORK.IsServer()) 
     {
         current_pos_ = { 0, 0 };
@@ -50,6 +50,7 @@ public:
    void HandleEvent(const SDL_Event& event) override;
    void HandleNetworkMessage(uint8_t connectionId, std::span<const char> data, uint32_t length) override;
    [[nodiscard]] std::string_view GetStateName() const override { return "CharSelect"; }
+   void CollectTexturePaths(std::vector<std::string>& paths) const override;
 
     //   
     bool RequireGameStart();
@@ -3,6 +3,7 @@
 #include "../network/NetworkController.hpp"
 #include "../network/player/Player.hpp"
 #include "../network/packets/GamePackets.hpp"
+#include "../network/spectator/SpectatorBroadcaster.hpp"
 
 #include "../core/GameApp.hpp"
 #include "../core/common/constants/Constants.hpp"
@@ -23,9 +24,18 @@
 #include "../game/view/InterruptBlockView.hpp"
 #include "../game/view/ResultView.hpp"
 
+#include "../game/replay/MatchRecorder.hpp"
+#include "../game/replay/MatchPlayback.hpp"
+#include "../game/puzzle/PuzzleMode.hpp"
+#include "../game/system/MatchRandom.hpp"
+#include "../game/system/FfaMatch.hpp"
+#include "../game/system/BoardLayout.hpp"
+
 #include "../ui/EditBox.hpp"
 #include "../ui/Button.hpp"
 
+#include "../texture/RenderRecorder.hpp"
+
 #include "../utils/Logger.hpp"
 #include "../utils/TimerScheduler.hpp"
 
@@ -65,26 +75,26 @@ bool GameState::Init()
     }
     catch (const std::exception& e)
     {
-        LOGGER.Error("Failed to initialize GameState: {}", e.what());
+        LOG_GAMEPLAY(Error, "Failed to initialize GameState: {}", e.what());
         return false;
     }
 }
 
+void GameState::CollectTexturePaths(std::vector<std::string>& paths) const
+{
+    paths.insert(paths.end(), REQUIRED_TEXTURES.begin(), REQUIRED_TEXTURES.end());
+    paths.insert(paths.end(), { "UI/BUTTON/button.png", "FIELD/BG_00.png" });
+
+    // 맵은 Enter 에서 무작위로 정해지므로 후보 맵 전체를 포함
+    GAME_APP.GetMapManager().CollectTexturePaths(paths);
+}
+
 bool GameState::LoadResources()
 {
     auto& resourceManager = GAME_APP.GetResourceManager();
     try
     {
-        const std::vector<std::string> requiredTextures =
-        {
-            "PUYO/puyo_beta.png",
-            "PUYO/Effect/effect.png",
-            "PUYO/Effect/attack_eff_mix_01.png",
-            "PUYO/rensa_font.png",
-            "PUYO/result.png"
-        };
-
-        for (const auto& path : requiredTextures)
+        for (const std::string path : REQUIRED_TEXTURES)
         {
             if (!resourceManager.GetResource<ImageTexture>(path))
             {
@@ -95,15 +105,15 @@ bool GameState::LoadResources()
     }
     catch (const std::exception& e)
     {
-        LOGGER.Error("Resource loading failed: {}", e.what());
+        LOG_GAMEPLAY(Error, "Resource loading failed: {}", e.what());
         return false;
     }
 }
 
 bool GameState::CreatePlayers()
 {
+    // 상대는 CreateGamePlayer 에서 참가자마다 만든다
     local_player_ = std::make_shared<LocalPlayer>();
-    remote_player_ = std::make_shared<RemotePlayer>();
 
     return true;
 }
@@ -115,14 +125,14 @@ bool GameState::CreateUI()
 
     if (!restart_button_ || !exit_button_)
     {
-        LOGGER.Error("Failed to create buttons");
+        LOG_GAMEPLAY(Error, "Failed to create buttons");
         return false;
     }
 
     auto buttonTexture = ImageTexture::Create("UI/BUTTON/button.png");
     if (!buttonTexture)
     {
-        LOGGER.Error("Failed to get button texture");
+        LOG_GAMEPLAY(Error, "Failed to get button texture");
         return false;
     }
 
@@ -165,8 +175,36 @@ void GameState::Enter()
     if (restart_button_) restart_button_->SetVisible(false);
     if (exit_button_) exit_button_->SetVisible(false);
 
-    CreateGamePlayer(std::span<const uint8_t>(), std::span<const uint8_t>(), local_player_id_, characterId);
-    ScheduleGameStart();
+    // 첫 블록을 만들기 전에 매치 난수를 정해야 상대/리플레이와 같은 블록 순서가 나온다
+    is_waiting_match_seed_ = false;
+    pending_player_inits_.clear();
+
+    if (MATCH_PLAYBACK.IsActive())
+    {
+        MATCH_PLAYBACK.Begin();
+    }
+    else if (PUZZLE_MODE.IsActive())
+    {
+        PUZZLE_MODE.Begin();
+    }
+    else if (NETWORK.IsRunning() && NETWORK.IsClient())
+    {
+        // 서버의 GameInitPacket 으로 시드를 받은 뒤 HandleGameInitialize 에서 플레이어를 만든다
+        is_waiting_match_seed_ = true;
+    }
+    else
+    {
+        MATCH_RANDOM.Reset(MatchRandom::CreateSeed());
+        MATCH_RECORDER.Begin(MATCH_RANDOM.GetSeed(), { local_player_id_, characterId });
+    }
+
+    if (!is_waiting_match_seed_)
+    {
+        CreateGamePlayer(local_player_id_, characterId);
+        ScheduleGameStart();
+    }
+
+    SPECTATOR_BROADCASTER.Begin();
 
     should_quit_ = false;
     lastInputTime_ = SDL_GetTicks();
@@ -181,44 +219,80 @@ void GameState::Leave()
         local_player_->RemoveEventListener(this);
     }
 
-    if (remote_player_)
+    // 참가자 구성은 매치마다 달라지므로 상대는 남기지 않는다
+    for (const auto& remotePlayer : remote_players_)
     {
-        remote_player_->RemoveEventListener(this);
+        remotePlayer->RemoveEventListener(this);
+        remotePlayer->Release();
     }
+    remote_players_.clear();
+    ReleaseBoardAtlas();
+    FFA_MATCH.End();
 
     if (restart_button_) restart_button_->SetVisible(false);
     if (exit_button_) exit_button_->SetVisible(false);
 
     if (local_player_) local_player_->Reset();
-    if (remote_player_) remote_player_->Reset();
 
     if (background_)
     {
         background_->Reset();
     }
 
+    MATCH_RECORDER.Finish();
+
+    // 게임 시작 대기 등 이 상태가 예약한 타이머는 다른 상태에서 실행되지 않도록 취소
+    TIMER_SCHEDULER.CancelOwner(this);
+
     SDL_StopTextInput(GAME_APP.GetWindow());
 }
 
 void GameState::Update(float deltaTime)
 {
-    TIMER_SCHEDULER.Update();
+    if (MATCH_PLAYBACK.IsActive())
+    {
+        ApplyPlaybackEvents();
+    }
 
     if (background_)
     {
         background_->Update(deltaTime);
     }
 
-    if (local_player_)
+    if (local_player_ && !is_waiting_match_seed_)
     {
         local_player_->Update(deltaTime);
         local_player_->UpdateGameLogic(deltaTime);
     }
 
-    if (remote_player_ && is_network_game_)
+    if (is_network_game_)
+    {
+        for (const auto& remotePlayer : remote_players_)
+        {
+            remotePlayer->Update(deltaTime);
+            remotePlayer->UpdateGameState(deltaTime);
+        }
+    }
+
+    MATCH_RECORDER.AdvanceTick();
+    if (MATCH_RECORDER.IsKeyframeDue())
+    {
+        RecordKeyframe();
+    }
+
+    if (MATCH_PLAYBACK.IsActive())
+    {
+        MATCH_PLAYBACK.AdvanceTick();
+    }
+
+    if (NETWORK.IsServer())
     {
-        remote_player_->Update(deltaTime);
-        remote_player_->UpdateGameState(deltaTime);
+        std::array<BasePlayer*, Constants::Network::MAX_CLIENT> players{ local_player_.get() };
+        if (is_network_game_)
+        {
+            std::ranges::transform(remote_players_, players.begin() + 1, &std::shared_ptr<RemotePlayer>::get);
+        }
+        SPECTATOR_BROADCASTER.Update(players);
     }
 }
 
@@ -234,14 +308,19 @@ void GameState::Render()
         background_->Render();
     }
 
-    if (local_player_)
+    if (local_player_ && !is_waiting_match_seed_)
     {
         local_player_->Render();
     }
 
-    if (remote_player_ && is_network_game_)
+    if (is_network_game_)
     {
-        remote_player_->Render();
+        RenderCompactBoards();
+
+        for (const auto& remotePlayer : remote_players_)
+        {
+            remotePlayer->Render();
+        }
     }
 
     RenderUI();
@@ -251,6 +330,36 @@ void GameState::Render()
 #endif
 }
 
+// 축소 보드는 아틀라스 하나에 뷰포트만 바꿔 가며 그려 렌더 타겟 전환을 보드 수와 상관없이 두 번으로 묶는다
+void GameState::RenderCompactBoards()
+{
+    if (!board_atlas_)
+    {
+        return;
+    }
+
+    auto renderer = GAME_APP.GetRenderer();
+    RENDER_RECORDER.SetRenderTarget(renderer, board_atlas_);
+
+    for (const auto& remotePlayer : remote_players_)
+    {
+        const auto& board = remotePlayer->GetGameBoard();
+        if (!board || !board->HasSharedTarget())
+        {
+            continue;
+        }
+
+        const SDL_FRect& cell = remotePlayer->GetBoardAtlasCell();
+        const SDL_Rect viewport{ static_cast<int>(cell.x), static_cast<int>(cell.y), static_cast<int>(cell.w), static_cast<int>(cell.h) };
+
+        RENDER_RECORDER.SetViewport(renderer, &viewport);
+        board->RenderContents();
+    }
+
+    RENDER_RECORDER.SetViewport(renderer, nullptr);
+    RENDER_RECORDER.SetRenderTarget(renderer, nullptr);
+}
+
 void GameState::RenderUI()
 {
 
@@ -347,13 +456,16 @@ void GameState::HandleMouseInput(const SDL_Event& event)
 
 void GameState::HandleKeyboardInput(const SDL_Event& event)
 {
-    if (should_quit_)
+    if (should_quit_ || is_waiting_match_seed_ || MATCH_PLAYBACK.IsActive())
     {
         return;
     }
 
     if (local_player_ && local_player_->GetGameState() == GamePhase::Playing)
     {
+        const int16_t previousTotal = local_player_->GetTotalInterruptBlockCount();
+        const bool previousComboAttack = local_player_->IsComboAttack();
+
         switch (event.key.key)
         {
         case SDLK_UP:
@@ -372,12 +484,14 @@ void GameState::HandleKeyboardInput(const SDL_Event& event)
             local_player_->GetInterruptView()->UpdateInterruptBlock(100);
             break;
         }
+
+        RecordLocalGarbageChange(previousTotal, previousComboAttack);
     }
 }
 
 void GameState::HandleKeyboardState()
 {
-    if (SDL_GetTicks() - lastInputTime_ < 40)
+    if (SDL_GetTicks() - lastInputTime_ < 40 || is_waiting_match_seed_ || MATCH_PLAYBACK.IsActive())
     {
         return;
     }
@@ -424,9 +538,14 @@ void GameState::HandleKeyboardState()
 
 bool GameState::GameRestart()
 {
-    if (!local_player_ || !remote_player_)
+    return GameRestart(MatchRandom::CreateSeed());
+}
+
+bool GameState::GameRestart(uint32_t seed)
+{
+    if (!local_player_)
     {
-        LOGGER.Error("Cannot restart game: players not initialized");
+        LOG_GAMEPLAY(Error, "Cannot restart game: players not initialized");
         return false;
     }
 
@@ -434,58 +553,20 @@ bool GameState::GameRestart()
     {
         Reset();
 
+        MATCH_RANDOM.Reset(seed);
+        BeginMatchRecording();
+        BeginFreeForAll();
+        SPECTATOR_BROADCASTER.Begin();
+
         auto success = local_player_->Restart();
         if (!success)
         {
-            LOGGER.Error("Failed to restart local player");
+            LOG_GAMEPLAY(Error, "Failed to restart local player");
             return false;
         }
 
-        if (NETWORK.IsServer())
-        {
-            const auto& next_blocks = local_player_->GetNextBlock();
-            if (next_blocks.size() >= 2)
-            {
-                std::array<uint8_t, 2> block_type1{};
-                std::array<uint8_t, 2> block_type2{};
-
-                auto first_block = next_blocks[0].get();
-                if (first_block) {
-                    auto blocks = first_block->GetBlocks();
-                    if (blocks.size() >= 2) {
-                        block_type1[0] = static_cast<uint8_t>(blocks[0]->GetBlockType());
-                        block_type1[1] = static_cast<uint8_t>(blocks[1]->GetBlockType());
-                    }
-                }
-
-                auto second_block = next_blocks[1].get();
-                if (second_block) {
-                    auto blocks = second_block->GetBlocks();
-                    if (blocks.size() >= 2) {
-                        block_type2[0] = static_cast<uint8_t>(blocks[0]->GetBlockType());
-                        block_type2[1] = static_cast<uint8_t>(blocks[1]->GetBlockType());
-                    }
-                }
-
-                NETWORK.ReStartGame(block_type1, block_type2);
-            }
-        }
-        else
-        {
-            const auto& next_blocks = local_player_->GetNextBlock();
-            std::array<uint8_t, 2> block_type1{};
-            std::array<uint8_t, 2> block_type2{};
-
-            auto& first_blocks = next_blocks[0]->GetBlocks();
-            block_type1[0] = static_cast<uint8_t>(first_blocks[0]->GetBlockType());
-            block_type1[1] = static_cast<uint8_t>(first_blocks[1]->GetBlockType());
-
-            auto& second_blocks = next_blocks[1]->GetBlocks();
-            block_type2[0] = static_cast<uint8_t>(second_blocks[0]->GetBlockType());
-            block_type2[1] = static_cast<uint8_t>(second_blocks[1]->GetBlockType());
-
-            NETWORK.ReStartGame(block_type1, block_type2);
-        }
+        // 상대는 같은 시드로 같은 블록 순서를 만든다
+        NETWORK.ReStartGame(seed);
 
         if (restart_button_) restart_button_->SetVisible(false);
         if (exit_button_) exit_button_->SetVisible(false);
@@ -498,7 +579,7 @@ bool GameState::GameRestart()
     }
     catch (const std::exception& e)
     {
-        LOGGER.Error("Error during game restart: {}", e.what());
+        LOG_GAMEPLAY(Error, "Error during game restart: {}", e.what());
         return false;
     }
 }
@@ -527,7 +608,19 @@ void GameState::GameQuit()
 
 void GameState::HandleNetworkMessage(uint8_t connectionId, std::span<const char> data, uint32_t length)
 {
+    if (!local_player_)
+    {
+        packet_processor_.ProcessPacket(connectionId, data, length);
+        return;
+    }
+
+    // 상대가 보낸 방해 블록은 로컬 시뮬레이션 밖에서 들어오므로 바뀐 결과를 리플레이에 남긴다
+    const int16_t previousTotal = local_player_->GetTotalInterruptBlockCount();
+    const bool previousComboAttack = local_player_->IsComboAttack();
+
     packet_processor_.ProcessPacket(connectionId, data, length);
+
+    RecordLocalGarbageChange(previousTotal, previousComboAttack);
 }
 
 void GameState::InitializePacketHandlers()
@@ -657,6 +750,20 @@ void GameState::InitializePacketHandlers()
             HandleSyncBlockPositionY(connectionId, packet);
         }
     );    
+
+    packet_processor_.RegisterHandler<InitializePlayerPacket>(
+        PacketType::InitializePlayer,
+        [this](uint8_t connectionId, const InitializePlayerPacket* packet) {
+            HandleInitializePlayer(connectionId, packet);
+        }
+    );
+
+    packet_processor_.RegisterHandler<TargetInterruptPacket>(
+        PacketType::TargetInterruptBlock,
+        [this](uint8_t connectionId, const TargetInterruptPacket* packet) {
+            HandleTargetInterrupt(connectionId, packet);
+        }
+    );
 }
 
 void GameState::HandleGameInitialize(uint8_t connectionId, const GameInitPacket* packet)
@@ -671,29 +778,34 @@ void GameState::HandleGameInitialize(uint8_t connectionId, const GameInitPacket*
 
     if (background_ && background_->Initialize())
     {
-        local_player_->SetBackGround(background_);
+        // 서버와 같은 시드에서 두 플레이어의 블록 순서를 만든다
+        const uint16_t characterId = GAME_APP.GetPlayerManager().GetMyPlayer()->GetCharacterId();
 
-        auto& next_blocks = local_player_->GetNextBlock();
-        background_->SetNextBlock(next_blocks[0]);
-        background_->SetNextBlock(next_blocks[1]);
-        
-        std::span<const uint8_t> blockType1(packet->block1);
-        std::span<const uint8_t> blockType2(packet->block2);
+        MATCH_RANDOM.Reset(packet->seed);
+        MATCH_RECORDER.Begin(MATCH_RANDOM.GetSeed(), { local_player_id_, characterId });
+        is_waiting_match_seed_ = false;
 
-        CreateGamePlayer(blockType1, blockType2, packet->player_id, packet->character_id);
+        CreateGamePlayer(local_player_id_, characterId);
+        CreateGamePlayer(packet->player_id, packet->character_id);
+
+        // 시드보다 먼저 도착한 다른 참가자 (자유 대전)
+        for (const auto& init_packet : pending_player_inits_)
+        {
+            CreateGamePlayer(init_packet.player_id, init_packet.character_idx);
+        }
+        pending_player_inits_.clear();
 
         ScheduleGameStart();
     }
 }
 
-void GameState::CreateGamePlayer(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-    uint8_t playerIdx, uint16_t characterIdx)
+void GameState::CreateGamePlayer(uint8_t playerIdx, uint16_t characterIdx)
 {
     if (playerIdx == GAME_APP.GetPlayerManager().GetMyPlayer()->GetId())
     {
-        if (local_player_->Initialize(blockType1, blockType2, playerIdx, characterIdx, background_) == false)
+        if (local_player_->Initialize(playerIdx, characterIdx, background_) == false)
         {
-            LOGGER.Error("Failed to initialize local player");
+            LOG_GAMEPLAY(Error, "Failed to initialize local player");
         }
 
         local_player_->AddEventListener(this);
@@ -701,17 +813,198 @@ void GameState::CreateGamePlayer(const std::span<const uint8_t>& blockType1, con
     }
     else
     {
-        if (remote_player_->Initialize(blockType1, blockType2, playerIdx, characterIdx, background_) == false)
+        auto remotePlayer = GetRemotePlayer(playerIdx);
+        if (!remotePlayer)
         {
-            LOGGER.Error("Failed to initialize remote player");
+            if (remote_players_.size() + 1 >= Constants::Network::MAX_CLIENT)
+            {
+                LOG_GAMEPLAY(Error, "Cannot add remote player {}: match is full", playerIdx);
+                return;
+            }
+
+            remotePlayer = std::make_shared<RemotePlayer>();
+            remotePlayer->AddEventListener(this);
+            remote_players_.push_back(remotePlayer);
+
+            // 상대 수가 바뀌었으므로 새 참가자를 초기화하기 전에 배치를 다시 정한다
+            ApplyBoardLayout();
         }
 
-        remote_player_->AddEventListener(this);
+        if (remotePlayer->Initialize(playerIdx, characterIdx, background_) == false)
+        {
+            LOG_GAMEPLAY(Error, "Failed to initialize remote player");
+        }
 
         is_network_game_ = true;
+
+        MATCH_RECORDER.AddPlayer({ playerIdx, characterIdx });
+        RecordRemoteNextBlock(playerIdx, 0);
+        RecordRemoteNextBlock(playerIdx, 1);
+
+        BeginFreeForAll();
+    }
+}
+
+std::shared_ptr<RemotePlayer> GameState::GetRemotePlayer(uint8_t playerId) const
+{
+    const auto it = std::ranges::find_if(remote_players_,
+        [playerId](const auto& remotePlayer) { return remotePlayer->GetPlayerID() == playerId; });
+
+    return it != remote_players_.end() ? *it : nullptr;
+}
+
+void GameState::ApplyBoardLayout()
+{
+    const int count = static_cast<int>(remote_players_.size());
+    const auto grid = BoardLayout::GetOpponentGrid(count);
+
+    ReleaseBoardAtlas();
+
+    if (count > 1)
+    {
+        board_atlas_ = SDL_CreateTexture(
+            GAME_APP.GetRenderer(),
+            SDL_PIXELFORMAT_RGBA8888,
+            SDL_TEXTUREACCESS_TARGET,
+            grid.columns * Constants::Board::WIDTH,
+            grid.rows * Constants::Board::HEIGHT
+        );
+
+        if (board_atlas_)
+        {
+            SDL_SetTextureBlendMode(board_atlas_, SDL_BLENDMODE_BLEND);
+        }
+        else
+        {
+            LOG_GAMEPLAY(Error, "Failed to create board atlas: {}", SDL_GetError());
+        }
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        const auto& remotePlayer = remote_players_[i];
+
+        const SDL_FRect cell{
+            static_cast<float>((i % grid.columns) * Constants::Board::WIDTH),
+            static_cast<float>((i / grid.columns) * Constants::Board::HEIGHT),
+            static_cast<float>(Constants::Board::WIDTH),
+            static_cast<float>(Constants::Board::HEIGHT) };
+
+        remotePlayer->SetBoardAtlas(board_atlas_, cell);
+
+        const auto slot = BoardLayout::GetOpponentSlot(i, count);
+        if (remotePlayer->GetBoardSlot() == slot)
+        {
+            continue;
+        }
+
+        remotePlayer->SetBoardSlot(slot);
+
+        // 이미 보드가 있는 상대는 새 자리로 다시 만든다 (게임 시작 전 참가자가 들어올 때만 일어난다)
+        if (remotePlayer->GetGameBoard())
+        {
+            remotePlayer->Initialize(remotePlayer->GetPlayerID(), static_cast<uint16_t>(remotePlayer->GetCharacterID()), background_);
+        }
+    }
+}
+
+void GameState::ReleaseBoardAtlas()
+{
+    for (const auto& remotePlayer : remote_players_)
+    {
+        remotePlayer->SetBoardAtlas(nullptr, {});
+    }
+
+    if (board_atlas_)
+    {
+        SDL_DestroyTexture(board_atlas_);
+        board_atlas_ = nullptr;
     }
 }
 
+void GameState::BeginFreeForAll()
+{
+    if (!NETWORK.IsServer())
+    {
+        return;
+    }
+
+    std::array<uint8_t, FfaMatch::MAX_PLAYERS> playerIds{ local_player_id_ };
+    const size_t count = std::min(remote_players_.size() + 1, playerIds.size());
+
+    for (size_t i = 1; i < count; ++i)
+    {
+        playerIds[i] = remote_players_[i - 1]->GetPlayerID();
+    }
+
+    FFA_MATCH.Begin(MATCH_RANDOM.GetSeed(), std::span<const uint8_t>(playerIds.data(), count));
+}
+
+void GameState::ApplyTargetInterrupt(const TargetInterruptPacket& packet)
+{
+    if (packet.target_id == local_player_id_)
+    {
+        local_player_->AddInterruptBlock(packet.count);
+        local_player_->SetComboAttackState(true);
+    }
+    else if (const auto& target = GetRemotePlayer(packet.target_id))
+    {
+        target->UpdateInterruptBlock(packet.target_pending);
+        target->SetGameBoardState(BoardState::Damaging);
+    }
+
+    if (packet.attacker_id != local_player_id_)
+    {
+        if (const auto& attacker = GetRemotePlayer(packet.attacker_id))
+        {
+            attacker->AttackInterruptBlock(packet.position_x, packet.position_y, packet.block_type);
+            attacker->UpdateInterruptBlock(0);
+        }
+    }
+}
+
+void GameState::ApplyPlayerLose(uint8_t playerId)
+{
+    // 로컬 플레이어는 ProcessGameOver 에서 이미 졌다
+    if (const auto& remotePlayer = GetRemotePlayer(playerId))
+    {
+        if (remotePlayer->GetGameState() != GamePhase::GameOver)
+        {
+            remotePlayer->LoseGame(false);
+        }
+    }
+
+    if (should_quit_)
+    {
+        return;
+    }
+
+    BasePlayer* survivor = local_player_->GetGameState() != GamePhase::GameOver ? local_player_.get() : nullptr;
+    size_t aliveCount = survivor ? 1 : 0;
+
+    for (const auto& remotePlayer : remote_players_)
+    {
+        if (remotePlayer->GetGameState() != GamePhase::GameOver)
+        {
+            survivor = remotePlayer.get();
+            ++aliveCount;
+        }
+    }
+
+    if (aliveCount > 1)
+    {
+        return;
+    }
+
+    if (survivor)
+    {
+        survivor->LoseGame(true);
+    }
+
+    MATCH_RECORDER.Finish(survivor ? survivor->GetPlayerID() : Replay::NO_WINNER);
+    GameQuit();
+}
+
 void GameState::HandleAddNewBlock(uint8_t connectionId, const AddNewBlockPacket* packet)
 {
     auto player = GAME_APP.GetPlayerManager().FindPlayer(packet->player_id);
@@ -720,9 +1013,10 @@ void GameState::HandleAddNewBlock(uint8_t connectionId, const AddNewBlockPacket*
         return;
     }
 
-    if (player->GetId() != local_player_id_ && remote_player_)
+    if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
     {
-        remote_player_->AddNewBlock(packet->block_type);
+        remotePlayer->AddNewBlock(packet->piece_index);
+        RecordRemoteNextBlock(packet->player_id, packet->piece_index);
     }
 }
 
@@ -734,9 +1028,10 @@ void GameState::HandleUpdateBlockMove(uint8_t connectionId, const MoveBlockPacke
         return;
     }
 
-    if (player->GetId() != local_player_id_ && remote_player_)
+    if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
     {
-        remote_player_->MoveBlock(packet->move_type, packet->position);
+        remotePlayer->MoveBlock(packet->move_type, packet->position);
+        MATCH_RECORDER.RecordMove(packet->player_id, packet->move_type);
     }
 }
 
@@ -748,9 +1043,10 @@ void GameState::HandleBlockRotate(uint8_t connectionId, const RotateBlockPacket*
         return;
     }
 
-    if (player->GetId() != local_player_id_ && remote_player_)
+    if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
     {
-        remote_player_->RotateBlock(packet->rotate_type, packet->is_horizontal_moving);
+        remotePlayer->RotateBlock(packet->rotate_type, packet->is_horizontal_moving);
+        MATCH_RECORDER.RecordInput(packet->player_id, Replay::InputAction::Rotate);
     }
 }
 
@@ -759,6 +1055,7 @@ void GameState::HandleStartGame()
     if (local_player_)
     {
         local_player_->CreateNextBlock();
+        MATCH_RECORDER.RecordStart(local_player_id_);
     }
 }
 
@@ -770,9 +1067,9 @@ void GameState::HandleCheckBlockState(uint8_t connectionId, const CheckBlockStat
         return;
     }
 
-    if (player->GetId() != local_player_id_ && remote_player_)
+    if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
     {
-        remote_player_->CheckGameBlockState();
+        remotePlayer->CheckGameBlockState();
     }
 }
 
@@ -784,9 +1081,9 @@ void GameState::HandleChangeBlockState(uint8_t connectionId, const ChangeBlockSt
         return;
     }
 
-    if (player->GetId() != local_player_id_ && remote_player_)
+    if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
     {
-        remote_player_->ChangeBlockState(packet->state);
+        remotePlayer->ChangeBlockState(packet->state);
     }
 }
 
@@ -798,27 +1095,37 @@ void GameState::HandlePushBlockInGame(uint8_t connectionId, const PushBlockPacke
         return;
     }
 
-    if (player->GetId() != local_player_id_ && remote_player_)
+    if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
     {
         std::span<const float, 2> pos1{ packet->position1 };
         std::span<const float, 2> pos2{ packet->position2 };
 
-        //LOGGER.Info("GameState::HandlePushBlockInGame playerID_({}) pos1: {} pos2: {}", remote_player_->GetPlayerID(), pos1, pos2);
+        //LOGGER.Info("GameState::HandlePushBlockInGame playerID_({}) pos1: {} pos2: {}", remotePlayer->GetPlayerID(), pos1, pos2);
 
-        remote_player_->PushBlockInGame(pos1, pos2);
+        remotePlayer->PushBlockInGame(pos1, pos2);
     }
 }
 
 void GameState::HandleAddInterruptBlock(uint8_t connectionId, const AddInterruptBlockPacket* packet)
 {
-    LOGGER.Info("GameState::HandleAddInterruptBlock y_row_count {} x_count {} ", packet->y_row_count, packet->x_count);
+    LOG_GAMEPLAY(Info, "GameState::HandleAddInterruptBlock y_row_count {} x_count {} ", packet->y_row_count, packet->x_count);
 
     if (auto player = GAME_APP.GetPlayerManager().FindPlayer(packet->player_id))
     {
-        if (remote_player_)
+        if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
         {
             const std::span<const uint8_t> xIndicies{ packet->x_indices.data(), packet->x_count};
-            remote_player_->AddInterruptBlock(packet->y_row_count, xIndicies);
+            remotePlayer->AddInterruptBlock(packet->y_row_count, xIndicies);
+
+            uint8_t columnMask = 0;
+            for (uint8_t x : xIndicies)
+            {
+                if (x < Constants::Board::BOARD_X_COUNT)
+                {
+                    columnMask |= static_cast<uint8_t>(1u << x);
+                }
+            }
+            MATCH_RECORDER.RecordGarbageDrop(packet->player_id, packet->y_row_count, columnMask);
         }
     }
 }
@@ -834,10 +1141,10 @@ void GameState::HandleAttackInterrupt(uint8_t connectionId, const AttackInterrup
             local_player_->SetComboAttackState(true);
         }
 
-        if (remote_player_)
+        if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
         {
-            remote_player_->AttackInterruptBlock(packet->position_x, packet->position_y, packet->block_type);
-            remote_player_->UpdateInterruptBlock(0);
+            remotePlayer->AttackInterruptBlock(packet->position_x, packet->position_y, packet->block_type);
+            remotePlayer->UpdateInterruptBlock(0);
         }
     }
 }
@@ -850,14 +1157,17 @@ void GameState::HandleRestart(uint8_t connectionId, const RestartGamePacket* pac
         return;
     }
 
-    if (player->GetId() != local_player_id_ && remote_player_)
+    if (player->GetId() != local_player_id_ && !remote_players_.empty())
     {
-        std::span<const uint8_t> blockType1(packet->block1);
-        std::span<const uint8_t> blockType2(packet->block2);
+        GameRestart(packet->seed);
 
-        GameRestart();
-
-        remote_player_->Restart(blockType1, blockType2);
+        // 자유 대전은 서버만 재시작을 보내므로 모든 상대를 함께 재시작
+        for (const auto& remotePlayer : remote_players_)
+        {
+            remotePlayer->Restart();
+            RecordRemoteNextBlock(remotePlayer->GetPlayerID(), 0);
+            RecordRemoteNextBlock(remotePlayer->GetPlayerID(), 1);
+        }
     }
 }
 
@@ -865,9 +1175,9 @@ void GameState::HandleDefenseInterrupt(uint8_t connectionId, const DefenseInterr
 {
     if (auto player = GAME_APP.GetPlayerManager().FindPlayer(packet->player_id))
     {
-        if (player->GetId() != local_player_id_ && remote_player_)
+        if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
         {
-            remote_player_->DefenseInterruptBlockCount(packet->count, packet->position_x, packet->position_y, packet->block_type);
+            remotePlayer->DefenseInterruptBlockCount(packet->count, packet->position_x, packet->position_y, packet->block_type);
         }
     }
 }
@@ -879,6 +1189,16 @@ void GameState::HandleDefenseResultInterruptBlockCount(uint8_t connectionId, con
 	{
 		return;
 	}
+	// 자유 대전은 방어한 참가자의 남은 대기 수를 모두에게 알린다
+	if (IsFreeForAll() && player->GetId() != local_player_id_)
+	{
+		if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
+		{
+			remotePlayer->UpdateInterruptBlock(packet->count);
+		}
+		return;
+	}
+
 	if (local_player_)
 	{
 		//local_player_->SetTotalInterruptBlockCount(packet->count);
@@ -890,10 +1210,10 @@ void GameState::HandleAttackResultPlayerInterruptBlocCount(uint8_t connectionId,
 {
     if (auto player = GAME_APP.GetPlayerManager().FindPlayer(packet->player_id))
     {
-        if (remote_player_)
+        if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
         {
-            remote_player_->UpdateInterruptBlock(packet->count);
-            remote_player_->SetGameBoardState(BoardState::Damaging);
+            remotePlayer->UpdateInterruptBlock(packet->count);
+            remotePlayer->SetGameBoardState(BoardState::Damaging);
         }
 
         if (local_player_)
@@ -922,19 +1242,51 @@ void GameState::HandleSyncBlockPositionY(uint8_t connectionId, const SyncBlockPo
     auto player = GAME_APP.GetPlayerManager().FindPlayer(packet->player_id);
     if (auto player = GAME_APP.GetPlayerManager().FindPlayer(packet->player_id))
     {
-        if (player->GetId() != local_player_id_ && remote_player_)
+        if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
         {
-            remote_player_->SyncPositionY(packet->position_y, packet->velocity);
+            remotePlayer->SyncPositionY(packet->position_y, packet->velocity);
         }
     }
 }
 
+void GameState::HandleInitializePlayer(uint8_t connectionId, const InitializePlayerPacket* packet)
+{
+    if (packet->player_id == local_player_id_ || GetRemotePlayer(packet->player_id))
+    {
+        return;
+    }
+
+    if (is_waiting_match_seed_)
+    {
+        pending_player_inits_.push_back(*packet);
+        return;
+    }
+
+    CreateGamePlayer(packet->player_id, packet->character_idx);
+}
+
+void GameState::HandleTargetInterrupt(uint8_t connectionId, const TargetInterruptPacket* packet)
+{
+    ApplyTargetInterrupt(*packet);
+}
+
 void GameState::HandleLose(uint8_t connectionId, const LoseGamePacket* packet)
 {
     if (auto player = GAME_APP.GetPlayerManager().FindPlayer(packet->player_id))
     {
-        remote_player_->LoseGame(false);
+        if (IsFreeForAll())
+        {
+            ApplyPlayerLose(player->GetId());
+            return;
+        }
+
+        if (const auto& remotePlayer = GetRemotePlayer(player->GetId()))
+        {
+            remotePlayer->LoseGame(false);
+        }
         local_player_->LoseGame(true);
+
+        MATCH_RECORDER.Finish(local_player_id_);
     }
 }
 
@@ -947,6 +1299,128 @@ void GameState::HandleSystemEvent(const SDL_Event& event)
 {
 }
 
+void GameState::BeginMatchRecording()
+{
+    MATCH_RECORDER.Begin(MATCH_RANDOM.GetSeed(), { local_player_id_, GAME_APP.GetPlayerManager().GetMyPlayer()->GetCharacterId() });
+
+    if (is_network_game_)
+    {
+        for (const auto& remotePlayer : remote_players_)
+        {
+            MATCH_RECORDER.AddPlayer({ remotePlayer->GetPlayerID(), static_cast<uint16_t>(remotePlayer->GetCharacterID()) });
+        }
+    }
+}
+
+void GameState::RecordRemoteNextBlock(uint8_t playerId, uint32_t pieceIndex)
+{
+    const auto piece = MATCH_RANDOM.GetPiece(pieceIndex);
+    MATCH_RECORDER.RecordNextBlock(playerId, piece[0], piece[1]);
+}
+
+void GameState::RecordLocalGarbageChange(int16_t previousTotal, bool previousComboAttack)
+{
+    const int16_t total = local_player_->GetTotalInterruptBlockCount();
+    const bool comboAttack = local_player_->IsComboAttack();
+
+    if (total != previousTotal || comboAttack != previousComboAttack)
+    {
+        MATCH_RECORDER.RecordGarbageState(local_player_id_, total, comboAttack);
+    }
+}
+
+void GameState::RecordKeyframe()
+{
+    std::array<BasePlayer*, Constants::Network::MAX_CLIENT> players{ local_player_.get() };
+    if (is_network_game_)
+    {
+        std::ranges::transform(remote_players_, players.begin() + 1, &std::shared_ptr<RemotePlayer>::get);
+    }
+    MATCH_RECORDER.RecordKeyframe(MATCH_RANDOM.GetDrawCount(), players);
+}
+
+void GameState::ApplyPlaybackEvents()
+{
+    if (!local_player_)
+    {
+        return;
+    }
+
+    Replay::Event event;
+    while (MATCH_PLAYBACK.PollEvent(event))
+    {
+        if (event.type == Replay::EventType::Keyframe)
+        {
+            MATCH_PLAYBACK.VerifyKeyframe(event.keyframe, *local_player_);
+            continue;
+        }
+
+        if (event.type == Replay::EventType::End)
+        {
+            // 상대가 먼저 진 매치는 로컬 시뮬레이션만으로는 끝나지 않으므로 결과를 적용
+            if (event.winner == MatchPlayback::LOCAL_PLAYER_INDEX && local_player_->GetGameState() != GamePhase::GameOver)
+            {
+                local_player_->LoseGame(true);
+            }
+
+            MATCH_PLAYBACK.Finish();
+            break;
+        }
+
+        // 상대 보드는 패킷으로만 움직였으므로 다시 시뮬레이션하지 않는다
+        if (event.player != MatchPlayback::LOCAL_PLAYER_INDEX)
+        {
+            continue;
+        }
+
+        switch (event.type)
+        {
+        case Replay::EventType::Input:
+            switch (event.action)
+            {
+            case Replay::InputAction::MoveLeft:
+                local_player_->MoveBlock(static_cast<uint8_t>(Constants::Direction::Left), 0);
+                break;
+            case Replay::InputAction::MoveRight:
+                local_player_->MoveBlock(static_cast<uint8_t>(Constants::Direction::Right), 0);
+                break;
+            case Replay::InputAction::SoftDrop:
+                local_player_->MoveBlock(static_cast<uint8_t>(Constants::Direction::Bottom), 0);
+                break;
+            case Replay::InputAction::Rotate:
+                local_player_->RotateBlock(0, false);
+                break;
+            default:
+                break;
+            }
+            break;
+
+        case Replay::EventType::Start:
+            local_player_->CreateNextBlock();
+            break;
+
+        case Replay::EventType::GarbageState:
+        {
+            const int added = event.garbage_total - local_player_->GetTotalInterruptBlockCount();
+            if (added > 0)
+            {
+                local_player_->AddInterruptBlock(static_cast<int16_t>(added));
+            }
+            else
+            {
+                local_player_->UpdateInterruptBlock(event.garbage_total);
+            }
+            local_player_->SetComboAttackState(event.combo_attack);
+            break;
+        }
+
+        default:
+            // 다음 블록과 방해 블록 위치는 시드로 다시 만들어지므로 기록은 확인/분석용
+            break;
+        }
+    }
+}
+
 void GameState::Reset()
 {
     if (background_)
@@ -959,9 +1433,9 @@ void GameState::Reset()
         local_player_->Reset();
     }
 
-    if (remote_player_)
+    for (const auto& remotePlayer : remote_players_)
     {
-        remote_player_->Reset();
+        remotePlayer->Reset();
     }
 }
 
@@ -989,10 +1463,12 @@ void GameState::Release()
         local_player_.reset();
     }
 
-    if (remote_player_) {
-        remote_player_->Release();
-        remote_player_.reset();
+    for (const auto& remotePlayer : remote_players_)
+    {
+        remotePlayer->Release();
     }
+    remote_players_.clear();
+    ReleaseBoardAtlas();
 
     initialized_ = false;
     is_network_game_ = false;
@@ -1008,10 +1484,11 @@ Block* (*GameState::GetGameBlocks(uint8_t playerId))[Constants::Board::BOARD_X_C
     {
         return local_player_->GetGameBlocks();
     }
-    else
-    {
-        return remote_player_->GetGameBlocks();
-    }
+
+    const auto it = std::ranges::find_if(remote_players_,
+        [playerId](const auto& remotePlayer) { return remotePlayer->GetPlayerID() == playerId; });
+
+    return it != remote_players_.end() ? (*it)->GetGameBlocks() : nullptr;
 }
 
 void GameState::ScheduleGameStart() 
@@ -1023,13 +1500,14 @@ void GameState::ScheduleGameStart()
             {
                 NETWORK.StartGame();
                 local_player_->CreateNextBlock();
+                MATCH_RECORDER.RecordStart(local_player_id_);
             }
 
             if (local_player_->IsRunning() == false)
             {
                 local_player_->SetRunning(true);
             }            
-        });
+        }, this);
 }
 
 void GameState::OnPlayerEvent(const std::shared_ptr<BasePlayerEvent>& event)
@@ -1066,11 +1544,24 @@ void GameState::OnPlayerEvent(const std::shared_ptr<BasePlayerEvent>& event)
 
 void GameState::HandlePlayerGameOver(const std::shared_ptr<GameOverEvent>& event)
 {
-    if (remote_player_)
+    // 자유 대전: 상대의 탈락은 LoseGame 패킷으로, 로컬 탈락은 남은 인원을 세어 처리
+    if (IsFreeForAll())
     {
-        remote_player_->LoseGame(true);
+        if (event->GetPlayerId() == local_player_id_)
+        {
+            ApplyPlayerLose(local_player_id_);
+        }
+        return;
     }
 
+    const auto remotePlayer = is_network_game_ && !remote_players_.empty() ? remote_players_.front() : nullptr;
+    if (remotePlayer)
+    {
+        remotePlayer->LoseGame(true);
+    }
+
+    MATCH_RECORDER.Finish(remotePlayer ? remotePlayer->GetPlayerID() : Replay::NO_WINNER);
+
     exit_button_->SetVisible(true);
 
     if (NETWORK.IsServer())
@@ -1083,27 +1574,28 @@ void GameState::HandleGameRestart(const std::shared_ptr<GameRestartEvent>& event
 {    
 }
 
+// 아래 세 이벤트는 1:1 에서 상대 화면을 로컬로 갱신하는 용도 (자유 대전은 서버의 TargetInterruptPacket 으로 갱신)
 void GameState::HandleAddInterruptBlock(const std::shared_ptr<AddInterruptBlockEvent>& event)
 {
-    if (remote_player_)
+    if (!IsFreeForAll() && !remote_players_.empty())
     {
-        remote_player_->AddInterruptBlock(event->GetCount());
+        remote_players_.front()->AddInterruptBlock(event->GetCount());
     }
 }
 
 void GameState::HandleAttackInterruptBlock(const std::shared_ptr<AttackInterruptBlockEvent>& event)
 {
-    if (remote_player_)
+    if (!IsFreeForAll() && !remote_players_.empty())
     {
-        remote_player_->AttackInterruptBlock(event->GetX(), event->GetY(), event->GetType());
-		remote_player_->UpdateInterruptBlock(0);
+        remote_players_.front()->AttackInterruptBlock(event->GetX(), event->GetY(), event->GetType());
+		remote_players_.front()->UpdateInterruptBlock(0);
     }
 }
 
 void GameState::HandleDefenseBlock(const std::shared_ptr<DefenseBlockEvent>& event)
 {
-    if (remote_player_)
+    if (!IsFreeForAll() && !remote_players_.empty())
     {
-        remote_player_->DefenseInterruptBlockCount(event->GetBlockCount(), event->GetX(), event->GetY(), event->GetType());
+        remote_players_.front()->DefenseInterruptBlockCount(event->GetBlockCount(), event->GetX(), event->GetY(), event->GetType());
     }
 }
\ No newline at end of file
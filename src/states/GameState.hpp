@@ -76,6 +76,16 @@ struct BlockPositionMarker
 class GameState final : public BaseState, public IPlayerEventListener
 {
 public:
+
+    static constexpr std::array<const char*, 5> REQUIRED_TEXTURES =
+    {
+        "PUYO/puyo_beta.png",
+        "PUYO/Effect/effect.png",
+        "PUYO/Effect/attack_eff_mix_01.png",
+        "PUYO/rensa_font.png",
+        "PUYO/result.png"
+    };
+
     GameState();
     ~GameState() override;
 
@@ -97,17 +107,24 @@ public:
 
     //   
     [[nodiscard]] std::string_view GetStateName() const override { return "Game"; }
+    void CollectTexturePaths(std::vector<std::string>& paths) const override;
     [[nodiscard]] const std::shared_ptr<LocalPlayer>& GetLocalPlayer() const { return local_player_; }
-    [[nodiscard]] const std::shared_ptr<RemotePlayer>& GetRemotePlayer() const { return remote_player_; }
+    [[nodiscard]] std::shared_ptr<RemotePlayer> GetRemotePlayer(uint8_t playerId) const;
+    [[nodiscard]] const std::vector<std::shared_ptr<RemotePlayer>>& GetRemotePlayers() const { return remote_players_; }
+    [[nodiscard]] bool IsFreeForAll() const { return remote_players_.size() > 1; }
     [[nodiscard]] GameBackground* GetBackGround() const { return background_.get(); }
     [[nodiscard]] Block* (*GetGameBlocks(uint8_t playerId))[Constants::Board::BOARD_X_COUNT];
 
     //  Flow 
     bool GameRestart();
+    bool GameRestart(uint32_t seed);
     bool GameExit();
     void GameQuit();
-    void CreateGamePlayer(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-        uint8_t playerIdx, uint16_t characterIdx);
+    void CreateGamePlayer(uint8_t playerIdx, uint16_t characterIdx);
+
+    //  :       / Ż ó (    )
+    void ApplyTargetInterrupt(const TargetInterruptPacket& packet);
+    void ApplyPlayerLose(uint8_t playerId);
 
     void ScheduleGameStart();
 
@@ -119,14 +136,27 @@ private:
     bool CreatePlayers();
     void Reset();
 
+    //   ġ (밡  ̸  带 Ʋ ϳ  ׸)
+    void ApplyBoardLayout();
+    void ReleaseBoardAtlas();
+    void BeginFreeForAll();
+
     // ̺Ʈ ڵ鸵
     void HandleMouseInput(const SDL_Event& event);
     void HandleKeyboardInput(const SDL_Event& event);
     void HandleKeyboardState();
     void HandleSystemEvent(const SDL_Event& event);
 
+    // ġ ÷
+    void BeginMatchRecording();
+    void RecordRemoteNextBlock(uint8_t playerId, uint32_t pieceIndex);
+    void RecordLocalGarbageChange(int16_t previousTotal, bool previousComboAttack);
+    void RecordKeyframe();
+    void ApplyPlaybackEvents();
+
     //  
     void RenderUI();
+    void RenderCompactBoards();
 #ifdef _DEBUG
     void RenderDebugInfo();
     void RenderDebugGrid();
@@ -153,6 +183,8 @@ private:
     void HandleDefenseResultInterruptBlockCount(uint8_t connectionId, const DefenseResultInterruptBlockCountPacket* packet);
     void HandleAttackResultPlayerInterruptBlocCount(uint8_t connectionId, const AttackResultPlayerInterruptBlocCountPacket* packet);
     void HandleSyncBlockPositionY(uint8_t connectionId, const SyncBlockPositionYPacket* packet);    
+    void HandleInitializePlayer(uint8_t connectionId, const InitializePlayerPacket* packet);
+    void HandleTargetInterrupt(uint8_t connectionId, const TargetInterruptPacket* packet);
     void HandleGameOver();
 
     // ̺Ʈ ڵ鷯
@@ -166,7 +198,7 @@ private:
 private:
     // ÷̾  
     std::shared_ptr<LocalPlayer> local_player_;
-    std::shared_ptr<RemotePlayer> remote_player_;
+    std::vector<std::shared_ptr<RemotePlayer>> remote_players_;
     std::shared_ptr<GameBackground> background_;
 
     // UI Ʈ
@@ -177,9 +209,14 @@ private:
     uint64_t lastInputTime_{ 0 };
     bool initialized_{ false };
     bool is_network_game_{ false };
+    bool is_waiting_match_seed_{ false };   // Ŭ̾Ʈ: GameInitPacket  õ带 ޱ   ÷̾  ʴ´
     uint8_t local_player_id_{ 0 };
     bool should_quit_{ false };
 
+    //  
+    SDL_Texture* board_atlas_{ nullptr };                           //      Ÿ
+    std::vector<InitializePlayerPacket> pending_player_inits_;      // õ带 ޱ   ٸ 
+
     // Ŷ μ
     PacketProcessor packet_processor_{};
 };
\ No newline at end of file
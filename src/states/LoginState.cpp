@@ -136,10 +136,18 @@ bool LoginState::InitializeUI()
     return true;
 }
 
+void LoginState::CollectTexturePaths(std::vector<std::string>& paths) const
+{
+    paths.insert(paths.end(), { "MAINMENU/20.png", "MAINMENU/21.png", "UI/BUTTON/button.png" });
+}
+
 void LoginState::Enter()
 {
     SDL_StartTextInput(GAME_APP.GetWindow());
 
+    // α Է ޴   (Room) ؽó ̸ ε
+    GAME_APP.GetStateManager().PreloadState(StateManager::StateID::Room);
+
     // UI  ʱȭ
     ui_elements_.login_button->SetVisible(true);
     ui_elements_.create_server_button->SetVisible(true);
@@ -261,6 +269,17 @@ void LoginState::HandleNetworkMessage(uint8_t connectionId, std::span<const char
 
 void LoginState::HandleGiveId(uint8_t playerId)
 {
+    // ڴ 濡  ʰ  äο 
+    if (NETWORK.IsSpectator())
+    {
+        SpectateRequestPacket packet;
+        packet.id = playerId;
+        NETWORK.SendData(packet);
+
+        LOG_NETWORK(Info, "Spectating {}", NETWORK.GetAddress());
+        return;
+    }
+
     auto& playerManager = GAME_APP.GetPlayerManager();
     if (auto player = playerManager.CreatePlayer(playerId))
     {
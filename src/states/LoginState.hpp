@@ -43,6 +43,7 @@ public:
     void HandleNetworkMessage(uint8_t connectionId, std::span<const char> data, uint32_t length) override;
 
     [[nodiscard]] std::string_view GetStateName() const override { return "Login"; }
+    void CollectTexturePaths(std::vector<std::string>& paths) const override;
 
 private:
 
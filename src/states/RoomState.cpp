@@ -157,10 +157,23 @@ bool RoomState::InitializeUI()
     return true;
 }
 
+void RoomState::CollectTexturePaths(std::vector<std::string>& paths) const
+{
+    for (size_t i = 0; i < BACKGROUND_COUNT; ++i)
+    {
+        paths.push_back(std::format("MAINMENU/{:02d}.png", i));
+    }
+
+    paths.push_back("UI/BUTTON/button.png");
+}
+
 void RoomState::Enter()
 {
     SDL_StartTextInput(GAME_APP.GetWindow());
 
+    // ǿ ִ  ĳ  ؽó ̸ ε
+    GAME_APP.GetStateManager().PreloadState(StateManager::StateID::CharSelect);
+
     // UI  
     ui_elements_.chat_label->SetVisible(true);
     ui_elements_.start_button->SetVisible(NETWORK.IsServer());
@@ -45,6 +45,8 @@ public:
         return "Room";
     }
 
+    void CollectTexturePaths(std::vector<std::string>& paths) const override;
+
     [[nodiscard]] EditBox* GetChatBox() const { return ui_elements_.chat_box.get(); }
 
 private:
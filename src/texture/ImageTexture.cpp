@@ -1,6 +1,8 @@
 #include "ImageTexture.hpp"
 #include "../core/manager/ResourceManager.hpp"
 #include "../core/GameApp.hpp"
+#include "RenderRecorder.hpp"
+#include "../resource/AssetPack.hpp"
 
 #include <SDL3/SDL_image.h>
 #include <stdexcept>
@@ -43,43 +45,66 @@ std::shared_ptr<ImageTexture> ImageTexture::Create(const std::string& path)
     return GAME_APP.GetResourceManager().GetResource<ImageTexture>(path);
 }
 
-bool ImageTexture::Load(const std::string& path) 
+ResourceHandle ImageTexture::Intern(const std::string& path)
 {
+    return GAME_APP.GetResourceManager().Intern<ImageTexture>(path);
+}
 
-    ReleaseTexture();
-    path_ = path;
+std::shared_ptr<ImageTexture> ImageTexture::Create(ResourceHandle handle)
+{
+    return GAME_APP.GetResourceManager().Get<ImageTexture>(handle);
+}
 
-    SDL_Surface* loadedSurface = IMG_Load(path.c_str());
+SDL_Surface* ImageTexture::DecodeSurface(const std::string& path)
+{
+    SDL_Surface* loadedSurface = IMG_Load_IO(ASSET_PACK.OpenIO(path), true);
+    if (loadedSurface == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (auto formatDetail = SDL_GetPixelFormatDetails(loadedSurface->format); formatDetail != nullptr)
+    {
+        auto colorKey = SDL_MapRGB(formatDetail, NULL, 0, 0, 0);
+        SDL_SetSurfaceColorKey(loadedSurface, true, colorKey);
+    }
+
+    return loadedSurface;
+}
+
+bool ImageTexture::Load(const std::string& path) 
+{
+    SDL_Surface* loadedSurface = DecodeSurface(path);
     if (loadedSurface == nullptr)
     {
         throw std::runtime_error(std::format("Unable to load image {}: {}", path, SDL_GetError()));
     }
 
-    try
-    { 
-        if (auto formatDetail = SDL_GetPixelFormatDetails(loadedSurface->format); formatDetail != nullptr)
-        {
-            auto colorKey = SDL_MapRGB(formatDetail, NULL, 0, 0, 0);
-            SDL_SetSurfaceColorKey(loadedSurface, true, colorKey);
-        }
-
-        texture_ = SDL_CreateTextureFromSurface(GAME_APP.GetRenderer(), loadedSurface);
-        if (texture_ == nullptr)
-        {
-            SDL_DestroySurface(loadedSurface);
-            throw std::runtime_error(std::format("Unable to create texture: {}", SDL_GetError()));
-        }
-
-        width_ = static_cast<float>(loadedSurface->w);
-        height_ = static_cast<float>(loadedSurface->h);
-
-        SDL_DestroySurface(loadedSurface);
+    const bool isCreated = LoadFromSurface(path, loadedSurface);
+    SDL_DestroySurface(loadedSurface);
+
+    if (!isCreated)
+    {
+        throw std::runtime_error(std::format("Unable to create texture: {}", SDL_GetError()));
     }
-    catch (const std::exception&)
+
+    return true;
+}
+
+bool ImageTexture::LoadFromSurface(const std::string& path, SDL_Surface* surface)
+{
+    ReleaseTexture();
+    path_ = path;
+
+    texture_ = SDL_CreateTextureFromSurface(GAME_APP.GetRenderer(), surface);
+    if (texture_ == nullptr)
     {
-        SDL_DestroySurface(loadedSurface);
+        return false;
     }
-    
+
+    width_ = static_cast<float>(surface->w);
+    height_ = static_cast<float>(surface->h);
+
     return true;
 }
 
@@ -140,7 +165,7 @@ void ImageTexture::Render(float x, float y, const SDL_FRect* sourceRect, double
         sourceRect ? sourceRect->w : width_,
         sourceRect ? sourceRect->h : height_ };
 
-    SDL_RenderTextureRotated(renderer, texture_, sourceRect, &destRect, angle, center, flip);
+    RENDER_RECORDER.DrawTexture(renderer, texture_, sourceRect, &destRect, angle, center, flip, path_);
 }
 
 void ImageTexture::RenderScaled(const SDL_FRect* sourceRect, const SDL_FRect* destRect, double angle, const SDL_FPoint* center, SDL_FlipMode flip) const 
@@ -156,5 +181,5 @@ void ImageTexture::RenderScaled(const SDL_FRect* sourceRect, const SDL_FRect* de
         return;
     }
 
-    SDL_RenderTextureRotated(renderer, texture_, sourceRect, destRect, angle, center, flip);
+    RENDER_RECORDER.DrawTexture(renderer, texture_, sourceRect, destRect, angle, center, flip, path_);
 }
\ No newline at end of file
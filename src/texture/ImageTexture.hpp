@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../core/IResource.hpp"
+#include "../resource/ResourceHandle.hpp"
 #include <SDL3/SDL.h>
 #include <string>
 #include <memory>
@@ -15,6 +16,7 @@ class ImageTexture : public IResource
 public:
 
     friend class ResourceManager;
+    friend class AssetLoader;
 
     ImageTexture() = default;
     ~ImageTexture() override;
@@ -25,9 +27,17 @@ public:
     ImageTexture& operator=(ImageTexture&&) noexcept;
 
     static std::shared_ptr<ImageTexture> Create(const std::string& path);
+
+    // 자주 조회하는 텍스처는 경로를 한 번만 Intern 하고 핸들로 조회 (문자열 해시 없음)
+    [[nodiscard]] static ResourceHandle Intern(const std::string& path);
+    static std::shared_ptr<ImageTexture> Create(ResourceHandle handle);
+
+    // 이미지 디코딩 + 컬러 키 적용 (렌더러를 사용하지 않으므로 워커 스레드에서 호출 가능, 실패 시 nullptr)
+    [[nodiscard]] static SDL_Surface* DecodeSurface(const std::string& path);
     
     [[nodiscard]] bool IsLoaded() const override { return texture_ != nullptr; }
     [[nodiscard]] std::string_view GetResourcePath() const override { return path_; }
+    [[nodiscard]] size_t GetMemorySize() const override { return static_cast<size_t>(width_) * static_cast<size_t>(height_) * 4; }
 
     [[nodiscard]] float GetWidth() const { return width_; }
     [[nodiscard]] float GetHeight() const { return height_; }
@@ -48,6 +58,7 @@ public:
 
 protected:
     [[nodiscard]] bool Load(const std::string& path) override;
+    [[nodiscard]] bool LoadFromSurface(const std::string& path, SDL_Surface* surface);
     void ReleaseTexture();
 
 protected:
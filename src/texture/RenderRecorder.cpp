@@ -0,0 +1,435 @@
+#include "RenderRecorder.hpp"
+#include "../utils/Logger.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+    template<typename T>
+    void WriteValue(std::ofstream& stream, const T& value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadValue(std::ifstream& stream, T& value)
+    {
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    float ClippedArea(const SDL_FRect& rect, float width, float height)
+    {
+        const float left = std::max(rect.x, 0.0f);
+        const float top = std::max(rect.y, 0.0f);
+        const float right = std::min(rect.x + rect.w, width);
+        const float bottom = std::min(rect.y + rect.h, height);
+
+        return (right > left && bottom > top) ? (right - left) * (bottom - top) : 0.0f;
+    }
+}
+
+// RenderCapture
+
+std::span<const RenderCommand> RenderCapture::GetFrame(size_t index) const
+{
+    if (index >= frame_offsets.size())
+    {
+        return {};
+    }
+
+    const size_t begin = frame_offsets[index];
+    const size_t end = (index + 1 < frame_offsets.size()) ? frame_offsets[index + 1] : commands.size();
+
+    return std::span<const RenderCommand>(commands.data() + begin, end - begin);
+}
+
+void RenderCapture::Clear()
+{
+    screen_width = 0.0f;
+    screen_height = 0.0f;
+    textures.clear();
+    frame_offsets.clear();
+    commands.clear();
+}
+
+bool RenderCapture::Save(const std::filesystem::path& path) const
+{
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    if (!stream)
+    {
+        LOG_RENDER(Error, "Failed to open render capture for writing: {}", path.string());
+        return false;
+    }
+
+    WriteValue(stream, RenderRecorder::FILE_MAGIC);
+    WriteValue(stream, RenderRecorder::FILE_VERSION);
+    WriteValue(stream, static_cast<uint32_t>(sizeof(RenderCommand)));
+    WriteValue(stream, screen_width);
+    WriteValue(stream, screen_height);
+    WriteValue(stream, static_cast<uint32_t>(textures.size()));
+    WriteValue(stream, static_cast<uint32_t>(frame_offsets.size()));
+    WriteValue(stream, static_cast<uint32_t>(commands.size()));
+
+    for (const auto& texture : textures)
+    {
+        WriteValue(stream, texture.id);
+        WriteValue(stream, texture.flags);
+        WriteValue(stream, texture.width);
+        WriteValue(stream, texture.height);
+        WriteValue(stream, static_cast<uint16_t>(texture.path.size()));
+        stream.write(texture.path.data(), static_cast<std::streamsize>(texture.path.size()));
+    }
+
+    stream.write(reinterpret_cast<const char*>(frame_offsets.data()),
+        static_cast<std::streamsize>(frame_offsets.size() * sizeof(uint32_t)));
+    stream.write(reinterpret_cast<const char*>(commands.data()),
+        static_cast<std::streamsize>(commands.size() * sizeof(RenderCommand)));
+
+    return static_cast<bool>(stream);
+}
+
+bool RenderCapture::Load(const std::filesystem::path& path)
+{
+    Clear();
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        LOG_RENDER(Error, "Failed to open render capture: {}", path.string());
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0, command_size = 0;
+    uint32_t texture_count = 0, frame_count = 0, command_count = 0;
+
+    if (!ReadValue(stream, magic) || !ReadValue(stream, version) || !ReadValue(stream, command_size) ||
+        magic != RenderRecorder::FILE_MAGIC || version != RenderRecorder::FILE_VERSION || command_size != sizeof(RenderCommand))
+    {
+        LOG_RENDER(Error, "Invalid render capture header: {}", path.string());
+        return false;
+    }
+
+    if (!ReadValue(stream, screen_width) || !ReadValue(stream, screen_height) ||
+        !ReadValue(stream, texture_count) || !ReadValue(stream, frame_count) || !ReadValue(stream, command_count))
+    {
+        LOG_RENDER(Error, "Truncated render capture header: {}", path.string());
+        return false;
+    }
+
+    textures.resize(texture_count);
+    for (auto& texture : textures)
+    {
+        uint16_t length = 0;
+        if (!ReadValue(stream, texture.id) || !ReadValue(stream, texture.flags) ||
+            !ReadValue(stream, texture.width) || !ReadValue(stream, texture.height) || !ReadValue(stream, length))
+        {
+            LOG_RENDER(Error, "Truncated render capture texture table: {}", path.string());
+            return false;
+        }
+
+        texture.path.resize(length);
+        stream.read(texture.path.data(), length);
+    }
+
+    frame_offsets.resize(frame_count);
+    commands.resize(command_count);
+
+    stream.read(reinterpret_cast<char*>(frame_offsets.data()), static_cast<std::streamsize>(frame_count * sizeof(uint32_t)));
+    stream.read(reinterpret_cast<char*>(commands.data()), static_cast<std::streamsize>(command_count * sizeof(RenderCommand)));
+
+    if (!stream)
+    {
+        LOG_RENDER(Error, "Truncated render capture body: {}", path.string());
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
+// RenderRecorder
+
+RenderRecorder& RenderRecorder::GetInstance()
+{
+    static RenderRecorder instance;
+    return instance;
+}
+
+void RenderRecorder::DrawTexture(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect* dest,
+    double angle, const SDL_FPoint* center, SDL_FlipMode flip, std::string_view path)
+{
+    if (IsRecording() && texture)
+    {
+        RenderCommand command;
+        command.type = RenderCommandType::DrawTexture;
+        command.texture_id = GetTextureId(texture, path);
+        command.angle = static_cast<float>(angle);
+        command.flip = static_cast<uint8_t>(flip);
+
+        if (source)
+        {
+            command.flags |= RenderCommand::HAS_SOURCE;
+            command.source = *source;
+        }
+
+        if (center)
+        {
+            command.flags |= RenderCommand::HAS_CENTER;
+            command.center = *center;
+        }
+
+        if (dest)
+        {
+            command.dest = *dest;
+        }
+        else
+        {
+            SDL_GetTextureSize(texture, &command.dest.w, &command.dest.h);
+        }
+
+        SDL_BlendMode blend_mode = SDL_BLENDMODE_NONE;
+        SDL_GetTextureColorMod(texture, &command.color.r, &command.color.g, &command.color.b);
+        SDL_GetTextureAlphaMod(texture, &command.color.a);
+        SDL_GetTextureBlendMode(texture, &blend_mode);
+        command.blend_mode = static_cast<uint32_t>(blend_mode);
+
+        capture_.commands.push_back(command);
+    }
+
+    SDL_RenderTextureRotated(renderer, texture, source, dest, angle, center, flip);
+}
+
+void RenderRecorder::FillRect(SDL_Renderer* renderer, const SDL_FRect* rect)
+{
+    if (IsRecording())
+    {
+        RenderCommand command;
+        command.type = RenderCommandType::FillRect;
+
+        if (rect)
+        {
+            command.dest = *rect;
+        }
+        else
+        {
+            command.flags |= RenderCommand::FULL_TARGET;
+        }
+
+        SDL_BlendMode blend_mode = SDL_BLENDMODE_NONE;
+        SDL_GetRenderDrawColor(renderer, &command.color.r, &command.color.g, &command.color.b, &command.color.a);
+        SDL_GetRenderDrawBlendMode(renderer, &blend_mode);
+        command.blend_mode = static_cast<uint32_t>(blend_mode);
+
+        capture_.commands.push_back(command);
+    }
+
+    SDL_RenderFillRect(renderer, rect);
+}
+
+void RenderRecorder::Clear(SDL_Renderer* renderer)
+{
+    if (IsRecording())
+    {
+        RenderCommand command;
+        command.type = RenderCommandType::Clear;
+        SDL_GetRenderDrawColor(renderer, &command.color.r, &command.color.g, &command.color.b, &command.color.a);
+
+        capture_.commands.push_back(command);
+    }
+
+    SDL_RenderClear(renderer);
+}
+
+void RenderRecorder::SetRenderTarget(SDL_Renderer* renderer, SDL_Texture* target)
+{
+    if (IsRecording())
+    {
+        RenderCommand command;
+        command.type = RenderCommandType::SetTarget;
+        command.texture_id = target ? GetTextureId(target, {}) : 0;
+
+        capture_.commands.push_back(command);
+    }
+
+    SDL_SetRenderTarget(renderer, target);
+}
+
+void RenderRecorder::SetViewport(SDL_Renderer* renderer, const SDL_Rect* rect)
+{
+    if (IsRecording())
+    {
+        RenderCommand command;
+        command.type = RenderCommandType::SetViewport;
+
+        if (rect)
+        {
+            command.dest = { static_cast<float>(rect->x), static_cast<float>(rect->y), static_cast<float>(rect->w), static_cast<float>(rect->h) };
+        }
+        else
+        {
+            command.flags |= RenderCommand::FULL_TARGET;
+        }
+
+        capture_.commands.push_back(command);
+    }
+
+    SDL_SetRenderViewport(renderer, rect);
+}
+
+void RenderRecorder::StartCapture(int frameCount, std::filesystem::path path)
+{
+    if (is_capturing_ || frameCount <= 0)
+    {
+        return;
+    }
+
+    pending_frames_ = frameCount;
+    capture_path_ = std::move(path);
+
+    LOG_RENDER(Info, "Render capture scheduled: {} frame(s) -> {}", frameCount, capture_path_.string());
+}
+
+void RenderRecorder::BeginFrame(SDL_Renderer* renderer)
+{
+    if (!is_capturing_ && pending_frames_ > 0)
+    {
+        capture_.Clear();
+        texture_ids_.clear();
+        frame_stats_.clear();
+
+        int width = 0, height = 0;
+        SDL_GetRenderOutputSize(renderer, &width, &height);
+        capture_.screen_width = static_cast<float>(width);
+        capture_.screen_height = static_cast<float>(height);
+
+        remaining_frames_ = pending_frames_;
+        pending_frames_ = 0;
+        is_capturing_ = true;
+    }
+
+    if (is_capturing_)
+    {
+        capture_.frame_offsets.push_back(static_cast<uint32_t>(capture_.commands.size()));
+        is_frame_open_ = true;
+    }
+}
+
+void RenderRecorder::EndFrame()
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    is_frame_open_ = false;
+    frame_stats_.push_back(ComputeStats(capture_.GetFrame(capture_.GetFrameCount() - 1),
+        capture_.screen_width, capture_.screen_height));
+
+    if (--remaining_frames_ <= 0)
+    {
+        FinishCapture();
+    }
+}
+
+void RenderRecorder::FinishCapture()
+{
+    is_capturing_ = false;
+
+    if (!capture_.Save(capture_path_))
+    {
+        return;
+    }
+
+    double commands = 0.0, switches = 0.0, overdraw = 0.0;
+    float max_overdraw = 0.0f;
+    for (const auto& stats : frame_stats_)
+    {
+        commands += stats.command_count;
+        switches += stats.target_switch_count;
+        overdraw += stats.overdraw;
+        max_overdraw = std::max(max_overdraw, stats.overdraw);
+    }
+
+    const double frames = static_cast<double>(std::max<size_t>(frame_stats_.size(), 1));
+    LOG_RENDER(Info, "[RenderCapture] frames={} textures={} avg_commands={:.1f} avg_target_switches={:.1f} avg_overdraw={:.2f}x max_overdraw={:.2f}x -> {}",
+        frame_stats_.size(), capture_.textures.size(), commands / frames, switches / frames, overdraw / frames, max_overdraw,
+        capture_path_.string());
+}
+
+uint16_t RenderRecorder::GetTextureId(SDL_Texture* texture, std::string_view path)
+{
+    // ĸó   ؽó ּҰ Ǹ  ID     ϸ 뵵δ 
+    if (auto it = texture_ids_.find(texture); it != texture_ids_.end())
+    {
+        return it->second;
+    }
+
+    RenderTextureInfo info;
+    info.id = static_cast<uint16_t>(capture_.textures.size() + 1);
+    info.path = path;
+    SDL_GetTextureSize(texture, &info.width, &info.height);
+
+    const auto access = SDL_GetNumberProperty(SDL_GetTextureProperties(texture), SDL_PROP_TEXTURE_ACCESS_NUMBER, SDL_TEXTUREACCESS_STATIC);
+    if (access == SDL_TEXTUREACCESS_TARGET)
+    {
+        info.flags |= RenderTextureInfo::IS_TARGET;
+    }
+
+    capture_.textures.push_back(std::move(info));
+    texture_ids_.emplace(texture, capture_.textures.back().id);
+
+    return capture_.textures.back().id;
+}
+
+RenderFrameStats RenderRecorder::ComputeStats(std::span<const RenderCommand> commands, float screenWidth, float screenHeight)
+{
+    RenderFrameStats stats;
+    stats.command_count = static_cast<uint32_t>(commands.size());
+
+    uint16_t current_target = 0;
+    double drawn_area = 0.0;
+
+    for (const auto& command : commands)
+    {
+        switch (command.type)
+        {
+        case RenderCommandType::Clear:
+            ++stats.clear_count;
+            break;
+
+        case RenderCommandType::FillRect:
+            ++stats.fill_count;
+            if (current_target == 0)
+            {
+                drawn_area += (command.flags & RenderCommand::FULL_TARGET) ?
+                    screenWidth * screenHeight : ClippedArea(command.dest, screenWidth, screenHeight);
+            }
+            break;
+
+        case RenderCommandType::DrawTexture:
+            ++stats.draw_count;
+            if (current_target == 0)
+            {
+                drawn_area += ClippedArea(command.dest, screenWidth, screenHeight);
+            }
+            break;
+
+        case RenderCommandType::SetTarget:
+            if (command.texture_id != current_target)
+            {
+                ++stats.target_switch_count;
+                current_target = command.texture_id;
+            }
+            break;
+
+        case RenderCommandType::SetViewport:
+            break;
+        }
+    }
+
+    const double screen_area = static_cast<double>(screenWidth) * screenHeight;
+    stats.overdraw = screen_area > 0.0 ? static_cast<float>(drawn_area / screen_area) : 0.0f;
+
+    return stats;
+}
@@ -0,0 +1,147 @@
+#pragma once
+/*
+*
+* :    Ŀǵ ϱ
+* 1. ؽó ׸ / 簢 ä / ȭ  /  Ÿ ȯ / Ʈ   Ŭ  ȣ
+* 2. ĸó   Ŀǵ(ؽó ID, 簢, , ,  )  ũ ڵ ۿ 
+* 3. ĸó  Ϸ Ͽ RenderReplay      (鿣 ,  ϸ)
+* 4. Ӹ Ŀǵ ,  Ÿ ȯ Ƚ, ȭ ο(׸  / ȭ ) 
+*
+*/
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+enum class RenderCommandType : uint8_t
+{
+    Clear,
+    FillRect,
+    DrawTexture,
+    SetTarget,
+    SetViewport
+};
+
+struct RenderCommand
+{
+    static constexpr uint8_t HAS_SOURCE = 1 << 0;
+    static constexpr uint8_t HAS_CENTER = 1 << 1;
+    static constexpr uint8_t FULL_TARGET = 1 << 2;   // FillRect/SetViewport(nullptr):  Ÿ ü
+
+    RenderCommandType type{ RenderCommandType::Clear };
+    uint8_t flags{ 0 };
+    uint8_t flip{ 0 };
+    uint8_t reserved{ 0 };
+    uint16_t texture_id{ 0 };       // 0  ؽó  / ⺻  Ÿ(ȭ)
+    uint16_t reserved2{ 0 };
+    SDL_Color color{};              // Clear/FillRect ׸ , DrawTexture ÷/ ̼ⷹ
+    uint32_t blend_mode{ 0 };
+    SDL_FRect source{};
+    SDL_FRect dest{};
+    SDL_FPoint center{};
+    float angle{ 0.0f };
+};
+
+static_assert(std::is_trivially_copyable_v<RenderCommand>);
+
+struct RenderTextureInfo
+{
+    static constexpr uint8_t IS_TARGET = 1 << 0;
+
+    uint16_t id{ 0 };
+    uint8_t flags{ 0 };
+    float width{ 0.0f };
+    float height{ 0.0f };
+    std::string path;               // ImageTexture   (ڿ/Ÿ ؽó  )
+};
+
+struct RenderFrameStats
+{
+    uint32_t command_count{ 0 };
+    uint32_t draw_count{ 0 };
+    uint32_t fill_count{ 0 };
+    uint32_t clear_count{ 0 };
+    uint32_t target_switch_count{ 0 };
+    float overdraw{ 0.0f };         // ȭ Ÿٿ ׸   / ȭ  (Clear )
+};
+
+//     شϴ ĸó  (frame_offsets[i]     i ° )
+struct RenderCapture
+{
+    float screen_width{ 0.0f };
+    float screen_height{ 0.0f };
+    std::vector<RenderTextureInfo> textures;
+    std::vector<uint32_t> frame_offsets;
+    std::vector<RenderCommand> commands;
+
+    [[nodiscard]] size_t GetFrameCount() const { return frame_offsets.size(); }
+    [[nodiscard]] std::span<const RenderCommand> GetFrame(size_t index) const;
+
+    void Clear();
+    [[nodiscard]] bool Save(const std::filesystem::path& path) const;
+    [[nodiscard]] bool Load(const std::filesystem::path& path);
+};
+
+class RenderRecorder
+{
+public:
+
+    static constexpr uint32_t FILE_MAGIC = 0x44435250;   // "PRCD"
+    static constexpr uint32_t FILE_VERSION = 2;
+    static constexpr int DEFAULT_CAPTURE_FRAMES = 120;
+
+    static RenderRecorder& GetInstance();
+
+    RenderRecorder(const RenderRecorder&) = delete;
+    RenderRecorder& operator=(const RenderRecorder&) = delete;
+    RenderRecorder(RenderRecorder&&) = delete;
+    RenderRecorder& operator=(RenderRecorder&&) = delete;
+
+    //  ȣ  (ĸó  ƴϸ SDL ȣ⸸ )
+    void DrawTexture(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect* dest,
+        double angle = 0.0, const SDL_FPoint* center = nullptr, SDL_FlipMode flip = SDL_FLIP_NONE, std::string_view path = {});
+    void FillRect(SDL_Renderer* renderer, const SDL_FRect* rect);
+    void Clear(SDL_Renderer* renderer);
+    void SetRenderTarget(SDL_Renderer* renderer, SDL_Texture* target);
+    void SetViewport(SDL_Renderer* renderer, const SDL_Rect* rect);
+
+    //  Ӻ frameCount  ĸó  path  
+    void StartCapture(int frameCount, std::filesystem::path path);
+    void BeginFrame(SDL_Renderer* renderer);
+    void EndFrame();
+
+    [[nodiscard]] bool IsCapturing() const { return is_capturing_; }
+    [[nodiscard]] const std::vector<RenderFrameStats>& GetFrameStats() const { return frame_stats_; }
+
+    [[nodiscard]] static RenderFrameStats ComputeStats(std::span<const RenderCommand> commands, float screenWidth, float screenHeight);
+
+private:
+
+    RenderRecorder() = default;
+    ~RenderRecorder() = default;
+
+    [[nodiscard]] bool IsRecording() const { return is_capturing_ && is_frame_open_; }
+    [[nodiscard]] uint16_t GetTextureId(SDL_Texture* texture, std::string_view path);
+    void FinishCapture();
+
+private:
+
+    RenderCapture capture_;
+    std::unordered_map<SDL_Texture*, uint16_t> texture_ids_;
+    std::vector<RenderFrameStats> frame_stats_;
+
+    std::filesystem::path capture_path_;
+    int pending_frames_{ 0 };
+    int remaining_frames_{ 0 };
+    bool is_capturing_{ false };
+    bool is_frame_open_{ false };
+};
+
+#define RENDER_RECORDER RenderRecorder::GetInstance()
@@ -0,0 +1,271 @@
+#include "RenderReplay.hpp"
+#include "../resource/AssetPack.hpp"
+#include "../utils/Logger.hpp"
+
+#include <SDL3/SDL_image.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <numeric>
+#include <string_view>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    double Percentile(std::vector<double> values, double p)
+    {
+        if (values.empty())
+        {
+            return 0.0;
+        }
+
+        std::sort(values.begin(), values.end());
+        return values[static_cast<size_t>(p * static_cast<double>(values.size() - 1))];
+    }
+}
+
+RenderReplay::RenderReplay(RenderReplayOptions options)
+    : options_(std::move(options))
+{
+}
+
+RenderReplay::~RenderReplay()
+{
+    Release();
+}
+
+std::optional<RenderReplayOptions> RenderReplay::ParseCommandLine(int argc, char* argv[])
+{
+    RenderReplayOptions options;
+    bool is_replay = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--replay-render" && i + 1 < argc)
+        {
+            options.capture_path = argv[++i];
+            is_replay = true;
+        }
+        else if (arg == "--replay-loops" && i + 1 < argc)
+        {
+            const std::string_view value(argv[++i]);
+            std::from_chars(value.data(), value.data() + value.size(), options.loop_count);
+        }
+    }
+
+    if (!is_replay)
+    {
+        return std::nullopt;
+    }
+
+    options.loop_count = std::max(options.loop_count, 1);
+    return options;
+}
+
+bool RenderReplay::Initialize(SDL_Renderer* renderer)
+{
+    if (!capture_.Load(options_.capture_path) || capture_.GetFrameCount() == 0)
+    {
+        LOG_RENDER(Error, "Render replay has no frames: {}", options_.capture_path.string());
+        return false;
+    }
+
+    const char* renderer_name = SDL_GetRendererName(renderer);
+    renderer_name_ = renderer_name ? renderer_name : "unknown";
+
+    textures_.assign(capture_.textures.size() + 1, nullptr);
+    for (const auto& info : capture_.textures)
+    {
+        if (info.id < textures_.size())
+        {
+            textures_[info.id] = CreateReplayTexture(renderer, info);
+        }
+    }
+
+    const size_t total_frames = capture_.GetFrameCount() * static_cast<size_t>(options_.loop_count);
+    submit_times_.reserve(total_frames);
+    present_times_.reserve(total_frames);
+
+    LOG_RENDER(Info, "Render replay: {} frame(s), {} texture(s), {} loop(s) from {} on {}",
+        capture_.GetFrameCount(), capture_.textures.size(), options_.loop_count, options_.capture_path.string(), renderer_name_);
+
+    return true;
+}
+
+void RenderReplay::Release()
+{
+    for (auto* texture : textures_)
+    {
+        if (texture)
+        {
+            SDL_DestroyTexture(texture);
+        }
+    }
+
+    textures_.clear();
+    capture_.Clear();
+}
+
+SDL_Texture* RenderReplay::CreateReplayTexture(SDL_Renderer* renderer, const RenderTextureInfo& info) const
+{
+    const int width = std::max(1, static_cast<int>(info.width));
+    const int height = std::max(1, static_cast<int>(info.height));
+
+    if (info.flags & RenderTextureInfo::IS_TARGET)
+    {
+        return SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    }
+
+    // ImageTexture::Load    ε ( ÷ Ű)
+    if (!info.path.empty())
+    {
+        if (SDL_Surface* surface = IMG_Load_IO(ASSET_PACK.OpenIO(info.path), true))
+        {
+            if (auto details = SDL_GetPixelFormatDetails(surface->format))
+            {
+                SDL_SetSurfaceColorKey(surface, true, SDL_MapRGB(details, nullptr, 0, 0, 0));
+            }
+
+            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+            SDL_DestroySurface(surface);
+
+            if (texture)
+            {
+                return texture;
+            }
+        }
+
+        LOG_RENDER(Warning, "Render replay: failed to load {}, using placeholder", info.path);
+    }
+
+    // ڿ ؽó    ؽó  ũ ȸ ؽó ü
+    SDL_Surface* surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA8888);
+    if (!surface)
+    {
+        return nullptr;
+    }
+
+    SDL_FillSurfaceRect(surface, nullptr, SDL_MapSurfaceRGBA(surface, 0x80, 0x80, 0x80, 0xFF));
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+
+    return texture;
+}
+
+SDL_Texture* RenderReplay::FindTexture(uint16_t id) const
+{
+    return id < textures_.size() ? textures_[id] : nullptr;
+}
+
+void RenderReplay::RenderFrame(SDL_Renderer* renderer)
+{
+    if (is_finished_)
+    {
+        return;
+    }
+
+    const auto submit_start = Clock::now();
+
+    SDL_SetRenderTarget(renderer, nullptr);
+    for (const auto& command : capture_.GetFrame(frame_index_))
+    {
+        Execute(renderer, command);
+    }
+    SDL_SetRenderTarget(renderer, nullptr);
+
+    submit_times_.push_back(ElapsedMs(submit_start));
+
+    const auto present_start = Clock::now();
+    SDL_RenderPresent(renderer);
+    present_times_.push_back(ElapsedMs(present_start));
+
+    if (++frame_index_ >= capture_.GetFrameCount())
+    {
+        frame_index_ = 0;
+        if (++loop_index_ >= options_.loop_count)
+        {
+            is_finished_ = true;
+            ReportResults();
+        }
+    }
+}
+
+void RenderReplay::Execute(SDL_Renderer* renderer, const RenderCommand& command) const
+{
+    switch (command.type)
+    {
+    case RenderCommandType::Clear:
+        SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+        SDL_RenderClear(renderer);
+        break;
+
+    case RenderCommandType::FillRect:
+        SDL_SetRenderDrawBlendMode(renderer, static_cast<SDL_BlendMode>(command.blend_mode));
+        SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+        SDL_RenderFillRect(renderer, (command.flags & RenderCommand::FULL_TARGET) ? nullptr : &command.dest);
+        break;
+
+    case RenderCommandType::DrawTexture:
+        if (SDL_Texture* texture = FindTexture(command.texture_id))
+        {
+            SDL_SetTextureColorMod(texture, command.color.r, command.color.g, command.color.b);
+            SDL_SetTextureAlphaMod(texture, command.color.a);
+            SDL_SetTextureBlendMode(texture, static_cast<SDL_BlendMode>(command.blend_mode));
+
+            SDL_RenderTextureRotated(renderer, texture,
+                (command.flags & RenderCommand::HAS_SOURCE) ? &command.source : nullptr,
+                &command.dest,
+                command.angle,
+                (command.flags & RenderCommand::HAS_CENTER) ? &command.center : nullptr,
+                static_cast<SDL_FlipMode>(command.flip));
+        }
+        break;
+
+    case RenderCommandType::SetTarget:
+        SDL_SetRenderTarget(renderer, FindTexture(command.texture_id));
+        break;
+
+    case RenderCommandType::SetViewport:
+        if (command.flags & RenderCommand::FULL_TARGET)
+        {
+            SDL_SetRenderViewport(renderer, nullptr);
+        }
+        else
+        {
+            const SDL_Rect viewport{
+                static_cast<int>(command.dest.x), static_cast<int>(command.dest.y),
+                static_cast<int>(command.dest.w), static_cast<int>(command.dest.h) };
+            SDL_SetRenderViewport(renderer, &viewport);
+        }
+        break;
+    }
+}
+
+void RenderReplay::ReportResults() const
+{
+    const auto average = [](const std::vector<double>& values)
+        {
+            return values.empty() ? 0.0 : std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+        };
+
+    LOG_RENDER(Info, "[RenderReplay] driver={} frames={} submit avg={:.3f}ms p50={:.3f}ms p99={:.3f}ms present avg={:.3f}ms",
+        renderer_name_, submit_times_.size(),
+        average(submit_times_), Percentile(submit_times_, 0.5), Percentile(submit_times_, 0.99),
+        average(present_times_));
+
+    for (size_t i = 0; i < capture_.GetFrameCount(); ++i)
+    {
+        const auto stats = RenderRecorder::ComputeStats(capture_.GetFrame(i), capture_.screen_width, capture_.screen_height);
+        LOG_RENDER(Debug, "[RenderReplay] frame={} commands={} draws={} fills={} target_switches={} overdraw={:.2f}x",
+            i, stats.command_count, stats.draw_count, stats.fill_count, stats.target_switch_count, stats.overdraw);
+    }
+}
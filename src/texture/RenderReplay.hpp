@@ -0,0 +1,69 @@
+#pragma once
+/*
+*
+* : RenderRecorder    Ŀǵ带    
+* 1. ̹ ؽó ϵ ο ٽ ε,  Ÿ  ũ , ڿ ؽó ȸ ü ؽó 
+* 2. ĸó ü  Ƚŭ ݺ ϸ Ӻ /Present ð 
+* 3. --render-driver  Բ Ͽ  ũε  鿣带 
+*
+*/
+
+#include "RenderRecorder.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct RenderReplayOptions
+{
+    std::filesystem::path capture_path;
+    int loop_count{ 3 };
+};
+
+class RenderReplay
+{
+public:
+
+    explicit RenderReplay(RenderReplayOptions options);
+    ~RenderReplay();
+
+    RenderReplay(const RenderReplay&) = delete;
+    RenderReplay& operator=(const RenderReplay&) = delete;
+    RenderReplay(RenderReplay&&) = delete;
+    RenderReplay& operator=(RenderReplay&&) = delete;
+
+    // --replay-render <path> [--replay-loops <n>]
+    [[nodiscard]] static std::optional<RenderReplayOptions> ParseCommandLine(int argc, char* argv[]);
+
+    [[nodiscard]] bool Initialize(SDL_Renderer* renderer);
+    void Release();
+
+    //   ϰ Present  
+    void RenderFrame(SDL_Renderer* renderer);
+
+    [[nodiscard]] bool IsFinished() const { return is_finished_; }
+
+private:
+
+    [[nodiscard]] SDL_Texture* CreateReplayTexture(SDL_Renderer* renderer, const RenderTextureInfo& info) const;
+    [[nodiscard]] SDL_Texture* FindTexture(uint16_t id) const;
+    void Execute(SDL_Renderer* renderer, const RenderCommand& command) const;
+    void ReportResults() const;
+
+private:
+
+    RenderReplayOptions options_;
+    RenderCapture capture_;
+    std::vector<SDL_Texture*> textures_;    // ε = ؽó ID (0   )
+    std::string renderer_name_;
+
+    std::vector<double> submit_times_;
+    std::vector<double> present_times_;
+
+    size_t frame_index_{ 0 };
+    int loop_index_{ 0 };
+    bool is_finished_{ false };
+};
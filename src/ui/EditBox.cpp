@@ -1,6 +1,7 @@
 ﻿#include "EditBox.hpp"
 #include "../texture/StringTexture.hpp"
 #include "../core/GameApp.hpp"
+#include "../texture/RenderRecorder.hpp"
 #include "../utils/StringUtils.hpp"
 #include "../core/manager/FontManager.hpp"
 #include "../core/manager/PlayerManager.hpp"
@@ -142,9 +143,9 @@ void EditBox::RenderMessageList()
         return;
     }
 
-    SDL_SetRenderTarget(renderer, render_target_texture_.get());
+    RENDER_RECORDER.SetRenderTarget(renderer, render_target_texture_.get());
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-    SDL_RenderClear(renderer);
+    RENDER_RECORDER.Clear(renderer);
 
     float y_position = render_target_rect_.h;
     constexpr float LINE_HEIGHT = 16.0f;
@@ -159,8 +160,8 @@ void EditBox::RenderMessageList()
         }
     }
 
-    SDL_SetRenderTarget(renderer, nullptr);
-    SDL_RenderTexture(renderer, render_target_texture_.get(), nullptr, &render_target_rect_);
+    RENDER_RECORDER.SetRenderTarget(renderer, nullptr);
+    RENDER_RECORDER.DrawTexture(renderer, render_target_texture_.get(), nullptr, &render_target_rect_);
 }
 
 void EditBox::HandleEvent(const SDL_Event& event)
@@ -1,6 +1,7 @@
 #include "Label.hpp"
 
 #include "../core/GameApp.hpp"
+#include "../texture/RenderRecorder.hpp"
 #include "../utils/Logger.hpp"
 
 #include <stdexcept>
@@ -62,7 +63,7 @@ void Label::Render()
             background_color_.a);
 
         SDL_FRect rect = { GetX(), GetY(), GetWidth(), GetHeight() };
-        SDL_RenderFillRect(renderer, &rect);
+        RENDER_RECORDER.FillRect(renderer, &rect);
     }
 
     // ؽƮ 
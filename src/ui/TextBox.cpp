@@ -1,6 +1,7 @@
 #include "TextBox.hpp"
 #include "../texture/StringTexture.hpp"
 #include "../core/GameApp.hpp"
+#include "../texture/RenderRecorder.hpp"
 #include "../utils/StringUtils.hpp"
 #include "../utils/Logger.hpp"
 
@@ -115,7 +116,7 @@ void TextBox::Render()
 
     // Render title background
     SDL_SetRenderDrawColor(renderer, COLOR_NAVY.r, COLOR_NAVY.g, COLOR_NAVY.b, COLOR_NAVY.a);
-    SDL_RenderFillRect(renderer, &title_rect_);
+    RENDER_RECORDER.FillRect(renderer, &title_rect_);
 
     // Render title text
     if (input_title_texture_) {
@@ -123,19 +124,19 @@ void TextBox::Render()
     }
 
     // Switch to input box render target
-    SDL_SetRenderTarget(renderer, target_render_input_box_texture_.get());
+    RENDER_RECORDER.SetRenderTarget(renderer, target_render_input_box_texture_.get());
     SDL_SetRenderDrawColor(renderer, COLOR_NAVY.r, COLOR_NAVY.g, COLOR_NAVY.b, COLOR_NAVY.a);
-    SDL_RenderClear(renderer);
+    RENDER_RECORDER.Clear(renderer);
 
     // Render cursor or composition text
     const auto alpha_u8 = static_cast<uint8_t>(alpha_);
     SDL_SetRenderDrawColor(renderer, alpha_u8, alpha_u8, alpha_u8, alpha_u8);
 
     if (korean_unicode_text_) {
-        SDL_RenderFillRect(renderer, &composition_rect_);
+        RENDER_RECORDER.FillRect(renderer, &composition_rect_);
     }
     else {
-        SDL_RenderFillRect(renderer, &cursor_rect_);
+        RENDER_RECORDER.FillRect(renderer, &cursor_rect_);
     }
 
     // Render IME composition text
@@ -152,8 +153,8 @@ void TextBox::Render()
     }
 
     // Switch back to main render target and render the input box
-    SDL_SetRenderTarget(renderer, nullptr);
-    SDL_RenderTexture(renderer,
+    RENDER_RECORDER.SetRenderTarget(renderer, nullptr);
+    RENDER_RECORDER.DrawTexture(renderer,
         target_render_input_box_texture_.get(),
         nullptr,
         &input_box_rect_
@@ -0,0 +1,233 @@
+#include "FrameJobSystem.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+}
+
+FrameJobSystem& FrameJobSystem::GetInstance()
+{
+    static FrameJobSystem instance;
+    return instance;
+}
+
+FrameJobSystem::~FrameJobSystem()
+{
+    Release();
+}
+
+void FrameJobSystem::Initialize(size_t workerCount)
+{
+    if (!workers_.empty())
+    {
+        return;
+    }
+
+    if (workerCount == 0)
+    {
+        const size_t hardware = std::thread::hardware_concurrency();
+        workerCount = std::min(MAX_WORKERS, hardware > 1 ? hardware - 1 : 0);
+    }
+
+    is_stopping_ = false;
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        workers_.emplace_back(&FrameJobSystem::WorkerLoop, this);
+    }
+
+    LOGGER.Info("FrameJobSystem initialized with {} worker(s)", workerCount);
+}
+
+void FrameJobSystem::Release()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+    }
+    work_cv_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    workers_.clear();
+    jobs_.clear();
+    stats_.clear();
+    last_timings_.clear();
+}
+
+void FrameJobSystem::Submit(std::string_view name, JobFunction job)
+{
+    if (!job)
+    {
+        return;
+    }
+
+    jobs_.push_back({ name, std::move(job), 0.0 });
+}
+
+void FrameJobSystem::Execute()
+{
+    last_timings_.clear();
+
+    if (jobs_.empty())
+    {
+        last_stage_ms_ = 0.0;
+        return;
+    }
+
+    const auto stage_start = Clock::now();
+
+    next_job_.store(0, std::memory_order_relaxed);
+    remaining_jobs_.store(jobs_.size(), std::memory_order_relaxed);
+
+    if (!workers_.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++generation_;
+            is_executing_ = true;
+        }
+        work_cv_.notify_all();
+    }
+
+    //  嵵  ۾  ó
+    RunJobs();
+
+    if (!workers_.empty())
+    {
+        //  ۾   Ŀ     ܰ踦 ݴ´.
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]()
+            {
+                return remaining_jobs_.load(std::memory_order_acquire) == 0 && active_workers_ == 0;
+            });
+        is_executing_ = false;
+    }
+
+    last_stage_ms_ = ElapsedMs(stage_start);
+
+    for (const auto& job : jobs_)
+    {
+        last_timings_.push_back({ job.name, job.elapsed_ms });
+        AccumulateStats(job.name, job.elapsed_ms);
+    }
+    AccumulateStats("Stage", last_stage_ms_);
+
+    jobs_.clear();
+
+    if (is_report_enabled_ && ++reported_frames_ >= REPORT_INTERVAL_FRAMES)
+    {
+        ReportStats();
+    }
+}
+
+void FrameJobSystem::WorkerLoop()
+{
+    uint64_t seen_generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait(lock, [this, seen_generation]()
+                {
+                    return is_stopping_ || (is_executing_ && generation_ != seen_generation);
+                });
+
+            if (is_stopping_)
+            {
+                return;
+            }
+
+            seen_generation = generation_;
+            ++active_workers_;
+        }
+
+        RunJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --active_workers_;
+        }
+        done_cv_.notify_one();
+    }
+}
+
+void FrameJobSystem::RunJobs()
+{
+    const size_t job_count = jobs_.size();
+
+    while (true)
+    {
+        const size_t index = next_job_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= job_count)
+        {
+            return;
+        }
+
+        auto& job = jobs_[index];
+        const auto start = Clock::now();
+        job.function();
+        job.elapsed_ms = ElapsedMs(start);
+
+        if (remaining_jobs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_cv_.notify_one();
+        }
+    }
+}
+
+void FrameJobSystem::AccumulateStats(std::string_view name, double elapsed_ms)
+{
+    auto it = std::find_if(stats_.begin(), stats_.end(),
+        [name](const JobStats& stats)
+        {
+            return stats.name == name;
+        });
+
+    if (it == stats_.end())
+    {
+        stats_.push_back({ name });
+        it = std::prev(stats_.end());
+    }
+
+    it->total_ms += elapsed_ms;
+    it->max_ms = std::max(it->max_ms, elapsed_ms);
+    ++it->count;
+}
+
+void FrameJobSystem::ReportStats()
+{
+    for (auto& stats : stats_)
+    {
+        if (stats.count == 0)
+        {
+            continue;
+        }
+
+        LOGGER.Info("[FrameJobs] {} calls={} avg={:.3f}ms max={:.3f}ms",
+            stats.name, stats.count, stats.total_ms / stats.count, stats.max_ms);
+
+        stats.total_ms = 0.0;
+        stats.max_ms = 0.0;
+        stats.count = 0;
+    }
+
+    reported_frames_ = 0;
+}
@@ -0,0 +1,104 @@
+#pragma once
+/*
+*
+* :   ȿ  ùķ̼ ۾(ƼŬ/ ƼŬ/źȯ) ķ óϴ  ý
+* 1.   Update ߿ Submit  ۾ ϰ,   Execute  ϰ   շ
+* 2.  嵵 ۾ ó ϸ, Ŀ   
+* 3. ۾ ҿ ð Ͽ  Ӹ /ִ밪 α׷ 
+*
+*/
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+class FrameJobSystem
+{
+public:
+
+    using JobFunction = std::function<void()>;
+
+    static constexpr size_t MAX_WORKERS = 3;
+    static constexpr int REPORT_INTERVAL_FRAMES = 600;
+
+    struct JobTiming
+    {
+        std::string_view name;
+        double elapsed_ms{ 0.0 };
+    };
+
+    static FrameJobSystem& GetInstance();
+
+    FrameJobSystem(const FrameJobSystem&) = delete;
+    FrameJobSystem& operator=(const FrameJobSystem&) = delete;
+    FrameJobSystem(FrameJobSystem&&) = delete;
+    FrameJobSystem& operator=(FrameJobSystem&&) = delete;
+
+    // workerCount == 0 ̸ ϵ    
+    void Initialize(size_t workerCount = 0);
+    void Release();
+
+    // name     ڿ̾ Ѵ ( Ű ״ )
+    void Submit(std::string_view name, JobFunction job);
+    void Execute();
+
+    [[nodiscard]] const std::vector<JobTiming>& GetLastTimings() const { return last_timings_; }
+    [[nodiscard]] double GetLastStageTime() const { return last_stage_ms_; }
+    [[nodiscard]] size_t GetWorkerCount() const { return workers_.size(); }
+
+    void SetReportEnabled(bool enabled) { is_report_enabled_ = enabled; }
+
+private:
+
+    struct Job
+    {
+        std::string_view name;
+        JobFunction function;
+        double elapsed_ms{ 0.0 };
+    };
+
+    struct JobStats
+    {
+        std::string_view name;
+        double total_ms{ 0.0 };
+        double max_ms{ 0.0 };
+        uint32_t count{ 0 };
+    };
+
+    FrameJobSystem() = default;
+    ~FrameJobSystem();
+
+    void WorkerLoop();
+    void RunJobs();
+    void AccumulateStats(std::string_view name, double elapsed_ms);
+    void ReportStats();
+
+private:
+
+    std::vector<std::thread> workers_;
+    std::vector<Job> jobs_;
+    std::vector<JobTiming> last_timings_;
+    std::vector<JobStats> stats_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+
+    std::atomic<size_t> next_job_{ 0 };
+    std::atomic<size_t> remaining_jobs_{ 0 };
+    size_t active_workers_{ 0 };
+    uint64_t generation_{ 0 };
+    bool is_executing_{ false };
+    bool is_stopping_{ false };
+
+    double last_stage_ms_{ 0.0 };
+    int reported_frames_{ 0 };
+    bool is_report_enabled_{ true };
+};
+
+#define FRAME_JOBS FrameJobSystem::GetInstance()
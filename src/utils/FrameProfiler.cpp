@@ -0,0 +1,385 @@
+#include "FrameProfiler.hpp"
+#include "Logger.hpp"
+
+#include <SDL3/SDL_render.h>
+
+#include <algorithm>
+#include <format>
+
+namespace
+{
+    // 帶    ڿ   ڽ Ϳ 
+    thread_local void* tls_thread_data = nullptr;
+
+    constexpr std::array<std::string_view, FrameProfiler::ZONE_COUNT> ZONE_NAMES =
+    {
+        "Frame",
+        "Network",
+        "AssetUpload",
+        "Managers",
+        "Player",
+        "Particle",
+        "FrameJobs",
+        "Packet",
+        "Render",
+        "Present",
+    };
+
+    double ToMs(uint64_t us)
+    {
+        return static_cast<double>(us) / 1000.0;
+    }
+
+    constexpr float OVERLAY_LINE_HEIGHT = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE + 2.0f;
+    constexpr float OVERLAY_MARGIN = 4.0f;
+}
+
+FrameProfiler::ScopedTimer::ScopedTimer(ProfileZone zone)
+    : zone_(zone)
+    , start_us_(FRAME_PROFILER.NowUs())
+{
+}
+
+FrameProfiler::ScopedTimer::~ScopedTimer()
+{
+    auto& profiler = FRAME_PROFILER;
+    profiler.Record(zone_, start_us_, profiler.NowUs() - start_us_);
+}
+
+FrameProfiler& FrameProfiler::GetInstance()
+{
+    static FrameProfiler instance;
+    return instance;
+}
+
+FrameProfiler::FrameProfiler()
+    : origin_(Clock::now())
+{
+}
+
+std::string_view FrameProfiler::GetZoneName(ProfileZone zone)
+{
+    const auto index = static_cast<size_t>(zone);
+    return index < ZONE_NAMES.size() ? ZONE_NAMES[index] : "Unknown";
+}
+
+int64_t FrameProfiler::NowUs() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin_).count();
+}
+
+FrameProfiler::ThreadData& FrameProfiler::GetThreadData()
+{
+    if (tls_thread_data)
+    {
+        return *static_cast<ThreadData*>(tls_thread_data);
+    }
+
+    std::lock_guard lock(threads_mutex_);
+
+    auto data = std::make_unique<ThreadData>();
+    data->thread_index = static_cast<uint32_t>(threads_.size());
+    tls_thread_data = data.get();
+    threads_.push_back(std::move(data));
+
+    return *threads_.back();
+}
+
+void FrameProfiler::Record(ProfileZone zone, int64_t startUs, int64_t durationUs)
+{
+    auto& data = GetThreadData();
+    const auto index = static_cast<size_t>(zone);
+
+    data.histograms[index].Record(static_cast<uint64_t>(std::max<int64_t>(durationUs, 0)));
+
+    if (&data == main_thread_)
+    {
+        frame_zone_us_[index] += durationUs;
+    }
+
+    if (is_capturing_.load(std::memory_order_relaxed))
+    {
+        RecordTrace(data, zone, startUs, durationUs);
+    }
+}
+
+void FrameProfiler::RecordTrace(ThreadData& data, ProfileZone zone, int64_t startUs, int64_t durationUs)
+{
+    //  ĸó ۵Ǿ  尡  ڽ ۸  (  count   )
+    const uint32_t epoch = capture_epoch_.load(std::memory_order_acquire);
+    if (data.capture_epoch.load(std::memory_order_relaxed) != epoch)
+    {
+        data.event_count.store(0, std::memory_order_relaxed);
+        data.capture_epoch.store(epoch, std::memory_order_release);
+    }
+
+    TraceEvent* events = data.events.load(std::memory_order_relaxed);
+    if (!events)
+    {
+        data.event_storage = std::make_unique<TraceEvent[]>(TRACE_EVENTS_PER_THREAD);
+        events = data.event_storage.get();
+        data.events.store(events, std::memory_order_release);
+    }
+
+    const uint32_t count = data.event_count.load(std::memory_order_relaxed);
+    if (count >= TRACE_EVENTS_PER_THREAD)
+    {
+        return;
+    }
+
+    events[count] = { startUs, durationUs, zone };
+    data.event_count.store(count + 1, std::memory_order_release);
+}
+
+void FrameProfiler::BeginFrame()
+{
+    if (!main_thread_)
+    {
+        main_thread_ = &GetThreadData();
+    }
+
+    frame_start_us_ = NowUs();
+    frame_zone_us_.fill(0);
+}
+
+void FrameProfiler::EndFrame()
+{
+    const int64_t frameUs = NowUs() - frame_start_us_;
+    Record(ProfileZone::Frame, frame_start_us_, frameUs);
+
+    //    ߾Ӱ  ũ    Ȯ  ֵ  ð 
+    const double frameMs = ToMs(static_cast<uint64_t>(frameUs));
+    const double typicalMs = ToMs(summaries_[static_cast<size_t>(ProfileZone::Frame)].p50);
+
+    if (typicalMs > 0.0 && frameMs > std::max(typicalMs * SLOW_FRAME_FACTOR, SLOW_FRAME_MIN_MS))
+    {
+        ++slow_frame_count_;
+        ReportSlowFrame(frameMs);
+    }
+
+    ++frame_index_;
+
+    if (++frames_since_summary_ >= SUMMARY_INTERVAL_FRAMES)
+    {
+        frames_since_summary_ = 0;
+        UpdateSummaries();
+    }
+
+    if (is_capturing_.load(std::memory_order_relaxed) && --capture_frames_left_ <= 0)
+    {
+        FinishTraceCapture();
+    }
+}
+
+void FrameProfiler::ReportSlowFrame(double frameMs) const
+{
+    std::array<size_t, ZONE_COUNT> order{};
+    for (size_t i = 0; i < ZONE_COUNT; ++i)
+    {
+        order[i] = i;
+    }
+
+    std::sort(order.begin(), order.end(),
+        [this](size_t a, size_t b)
+        {
+            return frame_zone_us_[a] > frame_zone_us_[b];
+        });
+
+    std::string breakdown;
+    for (size_t index : order)
+    {
+        if (index == static_cast<size_t>(ProfileZone::Frame) || frame_zone_us_[index] <= 0)
+        {
+            continue;
+        }
+
+        breakdown += std::format(" {}={:.2f}", ZONE_NAMES[index], ToMs(static_cast<uint64_t>(frame_zone_us_[index])));
+    }
+
+    LOGGER.Warning("Slow frame {} ({:.2f} ms):{}", frame_index_, frameMs, breakdown);
+}
+
+void FrameProfiler::UpdateSummaries()
+{
+    std::vector<ThreadData*> threads;
+    {
+        std::lock_guard lock(threads_mutex_);
+        threads.reserve(threads_.size());
+        for (const auto& data : threads_)
+        {
+            threads.push_back(data.get());
+        }
+    }
+
+    for (size_t zone = 0; zone < ZONE_COUNT; ++zone)
+    {
+        //  īƮ  ջ    ̷ ̹   Ѵ
+        HdrHistogram::Counts current{};
+        for (auto* data : threads)
+        {
+            data->histograms[zone].AddTo(current);
+        }
+
+        HdrHistogram::Counts window{};
+        for (uint32_t i = 0; i < HdrHistogram::BUCKET_COUNT; ++i)
+        {
+            window[i] = current[i] - previous_counts_[zone][i];
+        }
+
+        previous_counts_[zone] = current;
+        summaries_[zone] = HdrHistogram::Summarize(window);
+
+        if (stats_csv_ && summaries_[zone].count > 0)
+        {
+            const auto& summary = summaries_[zone];
+            stats_csv_ << std::format("{},{},{},{},{},{}\n",
+                frame_index_, ZONE_NAMES[zone], summary.count, summary.p50, summary.p99, summary.max);
+        }
+    }
+
+    if (stats_csv_)
+    {
+        stats_csv_.flush();
+    }
+}
+
+float FrameProfiler::GetOverlayHeight()
+{
+    return OVERLAY_MARGIN * 2 + OVERLAY_LINE_HEIGHT * (ZONE_COUNT + 2);
+}
+
+void FrameProfiler::RenderOverlay(SDL_Renderer* renderer) const
+{
+    if (!is_overlay_visible_ || !renderer)
+    {
+        return;
+    }
+
+    constexpr float LINE_HEIGHT = OVERLAY_LINE_HEIGHT;
+    constexpr float MARGIN = OVERLAY_MARGIN;
+
+    const SDL_FRect background{ 0.0f, 0.0f, 320.0f, GetOverlayHeight() };
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &background);
+
+    //   Ҵ ʵ  ۿ 
+    char line[96];
+    float y = MARGIN;
+
+    auto drawLine = [&](const std::format_to_n_result<char*>& result)
+    {
+        *result.out = '\0';
+        SDL_RenderDebugText(renderer, MARGIN, y, line);
+        y += LINE_HEIGHT;
+    };
+
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    drawLine(std::format_to_n(line, sizeof(line) - 1, "{:<12}{:>9}{:>9}{:>9}", "zone(ms)", "p50", "p99", "max"));
+
+    for (size_t zone = 0; zone < ZONE_COUNT; ++zone)
+    {
+        const auto& summary = summaries_[zone];
+        drawLine(std::format_to_n(line, sizeof(line) - 1, "{:<12}{:>9.2f}{:>9.2f}{:>9.2f}",
+            ZONE_NAMES[zone], ToMs(summary.p50), ToMs(summary.p99), ToMs(summary.max)));
+    }
+
+    drawLine(std::format_to_n(line, sizeof(line) - 1, "slow frames {}{}", slow_frame_count_, IsCapturingTrace() ? "  [trace]" : ""));
+}
+
+bool FrameProfiler::OpenStatsCsv(const std::string& path)
+{
+    stats_csv_.open(path, std::ios::trunc);
+    if (!stats_csv_)
+    {
+        LOGGER.Error("Failed to open frame stats file: {}", path);
+        return false;
+    }
+
+    stats_csv_ << "frame,zone,count,p50_us,p99_us,max_us\n";
+    return true;
+}
+
+void FrameProfiler::StartTraceCapture(int frames, std::string path)
+{
+    if (IsCapturingTrace() || frames <= 0)
+    {
+        return;
+    }
+
+    capture_frames_left_ = frames;
+    capture_path_ = std::move(path);
+
+    capture_epoch_.fetch_add(1, std::memory_order_release);
+    is_capturing_.store(true, std::memory_order_release);
+
+    LOGGER.Info("Frame trace capture started: {} frames -> {}", frames, capture_path_);
+}
+
+void FrameProfiler::FinishTraceCapture()
+{
+    is_capturing_.store(false, std::memory_order_release);
+
+    if (WriteTrace())
+    {
+        LOGGER.Info("Frame trace written to {}", capture_path_);
+    }
+}
+
+bool FrameProfiler::WriteTrace() const
+{
+    std::ofstream stream(capture_path_, std::ios::trunc);
+    if (!stream)
+    {
+        LOGGER.Error("Failed to open frame trace file: {}", capture_path_);
+        return false;
+    }
+
+    const uint32_t epoch = capture_epoch_.load(std::memory_order_acquire);
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    stream << R"({"name":"process_name","ph":"M","pid":1,"tid":0,"args":{"name":"PuyoPuyo"}})";
+
+    std::lock_guard lock(threads_mutex_);
+
+    for (const auto& data : threads_)
+    {
+        const uint32_t tid = data->thread_index;
+        const bool isMain = data.get() == main_thread_;
+
+        stream << std::format(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+            tid, isMain ? std::string("Main") : std::format("Thread {}", tid));
+
+        // ̹ ĸó     ۴  ĸó ̹Ƿ ǳʶ
+        if (data->capture_epoch.load(std::memory_order_acquire) != epoch)
+        {
+            continue;
+        }
+
+        const TraceEvent* events = data->events.load(std::memory_order_acquire);
+        const uint32_t count = data->event_count.load(std::memory_order_acquire);
+
+        for (uint32_t i = 0; events && i < count; ++i)
+        {
+            const auto& event = events[i];
+            stream << std::format(",\n{{\"name\":\"{}\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":1,\"tid\":{}}}",
+                ZONE_NAMES[static_cast<size_t>(event.zone)], event.start_us, event.duration_us, tid);
+        }
+    }
+
+    stream << "\n]}\n";
+    return static_cast<bool>(stream);
+}
+
+void FrameProfiler::Release()
+{
+    if (IsCapturingTrace())
+    {
+        FinishTraceCapture();
+    }
+
+    if (stats_csv_)
+    {
+        stats_csv_.close();
+    }
+}
@@ -0,0 +1,168 @@
+#pragma once
+/*
+*
+* : ýۺ  ð 
+* 1. PROFILE_SCOPE(zone)   ð 庰 HDR ׷  (ù       )
+* 2. SUMMARY_INTERVAL_FRAMES   p50/p99/max  Ͽ (F3) ǥϰ,   CSV  
+* 3.  ð ֱ p50   踦       ð α׷   ý Ȯ
+* 4. StartTraceCapture(F9)        Chrome Trace Event (JSON) 
+*
+*/
+
+#include "HdrHistogram.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct SDL_Renderer;
+
+enum class ProfileZone : uint8_t
+{
+    Frame,
+    NetworkUpdate,
+    AssetUpload,
+    ManagersUpdate,
+    PlayerUpdate,
+    ParticleUpdate,
+    FrameJobs,
+    PacketDispatch,
+    Render,
+    Present,
+    Count
+};
+
+class FrameProfiler
+{
+public:
+
+    static constexpr size_t ZONE_COUNT = static_cast<size_t>(ProfileZone::Count);
+    static constexpr int SUMMARY_INTERVAL_FRAMES = 60;
+    static constexpr double SLOW_FRAME_FACTOR = 2.0;
+    static constexpr double SLOW_FRAME_MIN_MS = 1000.0 / 60.0;
+    static constexpr int DEFAULT_TRACE_FRAMES = 300;
+    static constexpr uint32_t TRACE_EVENTS_PER_THREAD = 1u << 16;
+    static constexpr const char* DEFAULT_TRACE_FILE = "frame_trace.json";
+
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(ProfileZone zone);
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+        ScopedTimer(ScopedTimer&&) = delete;
+        ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+    private:
+        ProfileZone zone_;
+        int64_t start_us_;
+    };
+
+    static FrameProfiler& GetInstance();
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+    FrameProfiler(FrameProfiler&&) = delete;
+    FrameProfiler& operator=(FrameProfiler&&) = delete;
+
+    [[nodiscard]] static std::string_view GetZoneName(ProfileZone zone);
+
+    //  忡 ȣ 
+    void Record(ProfileZone zone, int64_t startUs, int64_t durationUs);
+    [[nodiscard]] int64_t NowUs() const;
+
+    //  忡   ȣ
+    void BeginFrame();
+    void EndFrame();
+    void RenderOverlay(SDL_Renderer* renderer) const;
+
+    void ToggleOverlay() { is_overlay_visible_ = !is_overlay_visible_; }
+    [[nodiscard]] bool IsOverlayVisible() const { return is_overlay_visible_; }
+    [[nodiscard]] static float GetOverlayHeight();
+
+    //    踦 CSV  ߰ 
+    bool OpenStatsCsv(const std::string& path);
+
+    void StartTraceCapture(int frames, std::string path);
+    [[nodiscard]] bool IsCapturingTrace() const { return is_capturing_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] const HdrHistogram::Summary& GetSummary(ProfileZone zone) const { return summaries_[static_cast<size_t>(zone)]; }
+    [[nodiscard]] uint64_t GetSlowFrameCount() const { return slow_frame_count_; }
+
+    void Release();
+
+private:
+
+    using Clock = std::chrono::steady_clock;
+
+    struct TraceEvent
+    {
+        int64_t start_us;
+        int64_t duration_us;
+        ProfileZone zone;
+    };
+
+    struct ThreadData
+    {
+        std::array<HdrHistogram, ZONE_COUNT> histograms;
+        uint32_t thread_index{ 0 };
+
+        // ĸó ۴  常 , count  release     尡 д´
+        std::atomic<TraceEvent*> events{ nullptr };
+        std::unique_ptr<TraceEvent[]> event_storage;
+        std::atomic<uint32_t> event_count{ 0 };
+        std::atomic<uint32_t> capture_epoch{ 0 };
+    };
+
+    FrameProfiler();
+    ~FrameProfiler() = default;
+
+    ThreadData& GetThreadData();
+    void RecordTrace(ThreadData& data, ProfileZone zone, int64_t startUs, int64_t durationUs);
+
+    void UpdateSummaries();
+    void ReportSlowFrame(double frameMs) const;
+    void FinishTraceCapture();
+    bool WriteTrace() const;
+
+private:
+
+    Clock::time_point origin_;
+
+    //   (帶  )
+    mutable std::mutex threads_mutex_;
+    std::vector<std::unique_ptr<ThreadData>> threads_;
+    ThreadData* main_thread_{ nullptr };
+
+    //    
+    int64_t frame_start_us_{ 0 };
+    std::array<int64_t, ZONE_COUNT> frame_zone_us_{};
+    int frames_since_summary_{ 0 };
+    uint64_t frame_index_{ 0 };
+    uint64_t slow_frame_count_{ 0 };
+
+    std::array<HdrHistogram::Counts, ZONE_COUNT> previous_counts_{};
+    std::array<HdrHistogram::Summary, ZONE_COUNT> summaries_{};
+
+    std::ofstream stats_csv_;
+    bool is_overlay_visible_{ false };
+
+    std::atomic<bool> is_capturing_{ false };
+    std::atomic<uint32_t> capture_epoch_{ 0 };
+    int capture_frames_left_{ 0 };
+    std::string capture_path_;
+};
+
+#define FRAME_PROFILER FrameProfiler::GetInstance()
+#define PROFILE_SCOPE_CONCAT_INNER(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(zone) FrameProfiler::ScopedTimer PROFILE_SCOPE_CONCAT(profile_scope_, __LINE__)(zone)
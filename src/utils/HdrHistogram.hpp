@@ -0,0 +1,121 @@
+#pragma once
+/*
+*
+* :  ũ HDR(High Dynamic Range) ׷
+* 1. 2 ŵ  32     ũ   3% е  (1us ~  67)
+* 2.    ϳ ϰ ( load/store,  ), ٸ   īƮ    
+* 3.  īƮ ̷  p50/p99/max  
+*
+*/
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+class HdrHistogram
+{
+public:
+
+    static constexpr uint32_t SUB_BUCKET_BITS = 5;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    static constexpr uint32_t VALUE_BITS = 26;
+    static constexpr uint64_t MAX_VALUE = (1ull << VALUE_BITS) - 1;
+    static constexpr uint32_t BUCKET_COUNT = (VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    using Counts = std::array<uint64_t, BUCKET_COUNT>;
+
+    struct Summary
+    {
+        uint64_t count{ 0 };
+        uint64_t p50{ 0 };
+        uint64_t p99{ 0 };
+        uint64_t max{ 0 };
+    };
+
+    [[nodiscard]] static constexpr uint32_t ToIndex(uint64_t value)
+    {
+        if (value > MAX_VALUE)
+        {
+            value = MAX_VALUE;
+        }
+
+        if (value < 2 * SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint32_t>(value);
+        }
+
+        //  SUB_BUCKET_BITS + 1 Ʈ ,  Ʈ   
+        const uint32_t shift = static_cast<uint32_t>(std::bit_width(value)) - SUB_BUCKET_BITS - 1;
+        return (shift + 1) * SUB_BUCKET_COUNT + static_cast<uint32_t>(value >> shift) - SUB_BUCKET_COUNT;
+    }
+
+    //     ū  (/ִ밪  )
+    [[nodiscard]] static constexpr uint64_t ToValue(uint32_t index)
+    {
+        if (index < 2 * SUB_BUCKET_COUNT)
+        {
+            return index;
+        }
+
+        const uint32_t shift = index / SUB_BUCKET_COUNT - 1;
+        const uint64_t top = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+        return ((top + 1) << shift) - 1;
+    }
+
+    //  忡 ȣ
+    void Record(uint64_t value)
+    {
+        auto& count = counts_[ToIndex(value)];
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // ٸ 忡 ȣ ,  ׷ ջ  ֵ Ѵ
+    void AddTo(Counts& counts) const
+    {
+        for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            counts[i] += counts_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] static Summary Summarize(const Counts& counts)
+    {
+        Summary summary;
+
+        for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            summary.count += counts[i];
+        }
+
+        if (summary.count == 0)
+        {
+            return summary;
+        }
+
+        const uint64_t p50Rank = (summary.count * 50 + 99) / 100;
+        const uint64_t p99Rank = (summary.count * 99 + 99) / 100;
+
+        uint64_t seen = 0;
+        for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            if (counts[i] == 0)
+            {
+                continue;
+            }
+
+            const uint64_t before = seen;
+            seen += counts[i];
+
+            if (before < p50Rank && seen >= p50Rank) summary.p50 = ToValue(i);
+            if (before < p99Rank && seen >= p99Rank) summary.p99 = ToValue(i);
+            summary.max = ToValue(i);
+        }
+
+        return summary;
+    }
+
+private:
+
+    std::array<std::atomic<uint32_t>, BUCKET_COUNT> counts_{};
+};
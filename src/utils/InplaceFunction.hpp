@@ -0,0 +1,120 @@
+#pragma once
+/*
+*
+* :  Ҵ  ü  ۿ ϴ ̵  ݹ (std::function ü)
+* 1. ĸó ũⰡ Capacity     (ū ´ ͷ ĸó)
+* 2. Ÿ̸/۾ ťó ݹ 뷮 ϴ  Ҵ 縦 ϱ  
+*
+*/
+
+#include <cstddef>
+#include <concepts>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, size_t Capacity = 48>
+class InplaceFunction;
+
+template<typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+public:
+
+    InplaceFunction() = default;
+
+    template<typename F>
+        requires (!std::same_as<std::decay_t<F>, InplaceFunction>) && std::invocable<std::decay_t<F>&, Args...>
+    InplaceFunction(F&& function)
+    {
+        using T = std::decay_t<F>;
+
+        static_assert(sizeof(T) <= Capacity, "Callable is too large for InplaceFunction storage");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Callable alignment is not supported");
+        static_assert(std::is_nothrow_move_constructible_v<T>, "Callable must be nothrow move constructible");
+
+        ::new (static_cast<void*>(storage_)) T(std::forward<F>(function));
+        ops_ = &OPS<T>;
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction()
+    {
+        Reset();
+    }
+
+    void Reset() noexcept
+    {
+        if (ops_)
+        {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    R operator()(Args... args)
+    {
+        return ops_->invoke(storage_, std::forward<Args>(args)...);
+    }
+
+private:
+
+    struct Ops
+    {
+        R(*invoke)(void*, Args&&...);
+        void(*move)(void* destination, void* source) noexcept;
+        void(*destroy)(void*) noexcept;
+    };
+
+    template<typename T>
+    static constexpr Ops OPS =
+    {
+        [](void* storage, Args&&... args) -> R
+        {
+            return (*static_cast<T*>(storage))(std::forward<Args>(args)...);
+        },
+        [](void* destination, void* source) noexcept
+        {
+            ::new (destination) T(std::move(*static_cast<T*>(source)));
+            static_cast<T*>(source)->~T();
+        },
+        [](void* storage) noexcept
+        {
+            static_cast<T*>(storage)->~T();
+        }
+    };
+
+    void MoveFrom(InplaceFunction& other) noexcept
+    {
+        if (other.ops_)
+        {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+private:
+
+    alignas(std::max_align_t) std::byte storage_[Capacity];
+    const Ops* ops_{ nullptr };
+};
@@ -0,0 +1,147 @@
+#pragma once
+/*
+*
+* : α  / īװ  Ÿ  
+* 1. LOG_* ũδ  Ÿ ּ    򰡸  ȣ ü ŵ
+* 2. ּ  PUYO_LOG_MIN_LEVEL (0=Trace ~ 5=Critical), īװ PUYO_LOG_MIN_LEVEL_<īװ>  
+* 3. ⺻: Debug  Trace, PUYO_LOG_STAGING  Debug (Ʈũ Trace),  (Release)  Info
+* 4. ϵ ȣ Ÿ īװ (Logger::SetCategoryLevel, log_levels.txt)    ɷ
+*
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+enum class LogLevel : uint8_t {
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Critical
+};
+
+enum class LogCategory : uint8_t {
+    General,
+    Network,
+    Render,
+    Gameplay,
+    Resource,
+    Count
+};
+
+#ifndef PUYO_LOG_MIN_LEVEL
+#if defined(_DEBUG)
+#define PUYO_LOG_MIN_LEVEL 0
+#elif defined(PUYO_LOG_STAGING)
+#define PUYO_LOG_MIN_LEVEL 1
+#else
+#define PUYO_LOG_MIN_LEVEL 2
+#endif
+#endif
+
+#ifndef PUYO_LOG_MIN_LEVEL_NETWORK
+#if defined(PUYO_LOG_STAGING)
+#define PUYO_LOG_MIN_LEVEL_NETWORK 0
+#else
+#define PUYO_LOG_MIN_LEVEL_NETWORK PUYO_LOG_MIN_LEVEL
+#endif
+#endif
+
+#ifndef PUYO_LOG_MIN_LEVEL_RENDER
+#define PUYO_LOG_MIN_LEVEL_RENDER PUYO_LOG_MIN_LEVEL
+#endif
+
+#ifndef PUYO_LOG_MIN_LEVEL_GAMEPLAY
+#define PUYO_LOG_MIN_LEVEL_GAMEPLAY PUYO_LOG_MIN_LEVEL
+#endif
+
+#ifndef PUYO_LOG_MIN_LEVEL_RESOURCE
+#define PUYO_LOG_MIN_LEVEL_RESOURCE PUYO_LOG_MIN_LEVEL
+#endif
+
+namespace LogConfig
+{
+    inline constexpr size_t CATEGORY_COUNT = static_cast<size_t>(LogCategory::Count);
+
+    inline constexpr std::array<LogLevel, CATEGORY_COUNT> COMPILED_MIN_LEVELS =
+    {
+        static_cast<LogLevel>(PUYO_LOG_MIN_LEVEL),
+        static_cast<LogLevel>(PUYO_LOG_MIN_LEVEL_NETWORK),
+        static_cast<LogLevel>(PUYO_LOG_MIN_LEVEL_RENDER),
+        static_cast<LogLevel>(PUYO_LOG_MIN_LEVEL_GAMEPLAY),
+        static_cast<LogLevel>(PUYO_LOG_MIN_LEVEL_RESOURCE)
+    };
+
+    // Ÿ ⺻  (īװ )
+    inline constexpr LogLevel DEFAULT_RUNTIME_LEVEL = LogLevel::Info;
+
+    [[nodiscard]] constexpr bool IsCompiledIn(LogCategory category, LogLevel level)
+    {
+        return level >= COMPILED_MIN_LEVELS[static_cast<size_t>(category)];
+    }
+
+    [[nodiscard]] constexpr std::string_view GetCategoryName(LogCategory category)
+    {
+        switch (category)
+        {
+        case LogCategory::General: return "GENERAL";
+        case LogCategory::Network: return "NETWORK";
+        case LogCategory::Render: return "RENDER";
+        case LogCategory::Gameplay: return "GAMEPLAY";
+        case LogCategory::Resource: return "RESOURCE";
+        default: return "UNKNOWN";
+        }
+    }
+
+    [[nodiscard]] constexpr bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            const auto lower = [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; };
+            if (lower(lhs[i]) != lower(rhs[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] constexpr std::optional<LogCategory> ParseCategory(std::string_view name)
+    {
+        for (size_t i = 0; i < CATEGORY_COUNT; ++i)
+        {
+            const auto category = static_cast<LogCategory>(i);
+            if (EqualsIgnoreCase(name, GetCategoryName(category)))
+            {
+                return category;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] constexpr std::optional<LogLevel> ParseLevel(std::string_view name)
+    {
+        constexpr std::array<std::string_view, 6> names = { "trace", "debug", "info", "warning", "error", "critical" };
+
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            if (EqualsIgnoreCase(name, names[i]))
+            {
+                return static_cast<LogLevel>(i);
+            }
+        }
+
+        return std::nullopt;
+    }
+}
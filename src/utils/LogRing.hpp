@@ -0,0 +1,287 @@
+#pragma once
+/*
+*
+* : 񵿱 ΰſ 庰  / Һ(SPSC)   ۿ ڵ ڵ
+* 1. α׸  帶  ϳ ϸ, ȣ   ڿ  +  ڸ 
+* 2. ڿ ڴ  + Ʈ ϰ, ڸϰ    ״ memcpy
+* 3.   Ÿ(std::filesystem::path ) ȣ 忡 "{}"  ̸ ڿȭϿ 
+* 4.  std::format  ׶ 尡 ڵ忡   Լ  
+*
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "LogConfig.hpp"
+
+// ׶ 忡  Ʈ ؼϿ out  ޽ δ.
+using LogFormatFunction = void(*)(std::string& out, std::string_view fmt, const std::byte* args);
+
+struct LogRecordHeader
+{
+    static constexpr uint32_t PADDING_FLAG = 0x80000000u;
+
+    uint32_t size;                  //  + , 8 Ʈ  (PADDING_FLAG    ä ڵ)
+    uint32_t line;
+    int64_t timestamp;              // system_clock ƽ
+    const char* format;             //    ڿ ( ID )
+    const char* file;
+    LogFormatFunction formatter;
+    uint32_t format_size;
+    LogLevel level;
+    LogCategory category;
+};
+
+namespace LogArg
+{
+    inline constexpr size_t ALIGNMENT = 8;
+
+    [[nodiscard]] constexpr size_t Align(size_t size)
+    {
+        return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    template<typename T>
+    inline constexpr bool IS_STRING =
+        std::is_same_v<T, std::string> ||
+        std::is_same_v<T, std::string_view> ||
+        std::is_same_v<T, const char*> ||
+        std::is_same_v<T, char*>;
+
+    template<typename T>
+    inline constexpr bool IS_RAW = !IS_STRING<T> && std::is_trivially_copyable_v<T>;
+
+    // ȣ 忡 ڸ   · ȯ (ڿ ,   ,  ܴ ̸ )
+    template<typename T>
+    [[nodiscard]] decltype(auto) Prepare(const T& value)
+    {
+        if constexpr (IS_STRING<T>)
+        {
+            if constexpr (std::is_pointer_v<T>)
+            {
+                return value ? std::string_view(value) : std::string_view("(null)");
+            }
+            else
+            {
+                return std::string_view(value);
+            }
+        }
+        else if constexpr (IS_RAW<T>)
+        {
+            return (value);
+        }
+        else
+        {
+            return std::format("{}", value);
+        }
+    }
+
+    // ׶ 忡 Ǵ Ÿ
+    template<typename T>
+    using DecodedType = std::conditional_t<IS_RAW<T>, T, std::string_view>;
+
+    template<typename P>
+    [[nodiscard]] size_t EncodedSize(const P& value)
+    {
+        if constexpr (std::is_trivially_copyable_v<P> && !std::is_same_v<P, std::string_view>)
+        {
+            return sizeof(P);
+        }
+        else
+        {
+            return sizeof(uint32_t) + std::string_view(value).size();
+        }
+    }
+
+    template<typename P>
+    void Encode(std::byte*& dst, const P& value)
+    {
+        if constexpr (std::is_trivially_copyable_v<P> && !std::is_same_v<P, std::string_view>)
+        {
+            std::memcpy(dst, &value, sizeof(P));
+            dst += sizeof(P);
+        }
+        else
+        {
+            const std::string_view text(value);
+            const auto length = static_cast<uint32_t>(text.size());
+            std::memcpy(dst, &length, sizeof(length));
+            std::memcpy(dst + sizeof(length), text.data(), text.size());
+            dst += sizeof(length) + text.size();
+        }
+    }
+
+    template<typename T>
+    [[nodiscard]] DecodedType<T> Decode(const std::byte*& src)
+    {
+        if constexpr (IS_RAW<T>)
+        {
+            T value;
+            std::memcpy(&value, src, sizeof(T));
+            src += sizeof(T);
+            return value;
+        }
+        else
+        {
+            uint32_t length = 0;
+            std::memcpy(&length, src, sizeof(length));
+            const auto* text = reinterpret_cast<const char*>(src + sizeof(length));
+            src += sizeof(length) + length;
+            return std::string_view(text, length);
+        }
+    }
+
+    template<typename... Args>
+    void FormatRecord(std::string& out, std::string_view fmt, const std::byte* args)
+    {
+        // ߰ȣ ʱȭ ʺ 򰡵ǹǷ ڵ  ȴ.
+        std::tuple<DecodedType<Args>...> values{ Decode<Args>(args)... };
+
+        std::apply([&](auto&... decoded)
+            {
+                std::vformat_to(std::back_inserter(out), fmt, std::make_format_args(decoded...));
+            }, values);
+    }
+}
+
+class LogRing
+{
+public:
+
+    static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+    explicit LogRing(size_t capacity = DEFAULT_CAPACITY)
+        : capacity_(capacity)
+        , mask_(capacity - 1)
+        , buffer_(new (std::align_val_t{ LogArg::ALIGNMENT }) std::byte[capacity])
+    {
+    }
+
+    ~LogRing()
+    {
+        ::operator delete[](buffer_, std::align_val_t{ LogArg::ALIGNMENT });
+    }
+
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+    LogRing(LogRing&&) = delete;
+    LogRing& operator=(LogRing&&) = delete;
+
+    [[nodiscard]] size_t GetCapacity() const { return capacity_; }
+
+    //  ڵ尡   ִ ִ ũ (  ä ڵ带 Ͽ )
+    [[nodiscard]] size_t GetMaxRecordSize() const { return capacity_ / 2; }
+
+    // ---  ( ) ---
+
+    // size  8 Ʈ ĵ ̾ Ѵ.   nullptr.
+    [[nodiscard]] std::byte* TryReserve(size_t size)
+    {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        const size_t offset = static_cast<size_t>(head & mask_);
+        const size_t contiguous = capacity_ - offset;
+        const size_t padding = contiguous < size ? contiguous : 0;
+
+        if (head + padding + size - cached_tail_ > capacity_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head + padding + size - cached_tail_ > capacity_)
+            {
+                return nullptr;
+            }
+        }
+
+        if (padding > 0)
+        {
+            // ڵ尡   ߸ ʵ   ä ڵ ǳʶڴ.
+            const auto marker = static_cast<uint32_t>(padding) | LogRecordHeader::PADDING_FLAG;
+            std::memcpy(buffer_ + offset, &marker, sizeof(marker));
+        }
+
+        reserved_head_ = head + padding;
+        return buffer_ + static_cast<size_t>(reserved_head_ & mask_);
+    }
+
+    void Commit(size_t size)
+    {
+        head_.store(reserved_head_ + size, std::memory_order_release);
+    }
+
+    [[nodiscard]] size_t GetUsedSize() const
+    {
+        return static_cast<size_t>(head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_relaxed));
+    }
+
+    // --- Һ (ΰ ) ---
+
+    [[nodiscard]] uint64_t GetReadPosition() const { return tail_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t GetWritePosition() const { return head_.load(std::memory_order_acquire); }
+
+    // position ġ ڵ带 ȯϰ  ڵ ̵ (ä ڵ ǳʶ), end  ϸ nullptr
+    [[nodiscard]] const LogRecordHeader* Read(uint64_t& position, uint64_t end) const
+    {
+        while (position < end)
+        {
+            const std::byte* data = buffer_ + static_cast<size_t>(position & mask_);
+
+            uint32_t size = 0;
+            std::memcpy(&size, data, sizeof(size));
+
+            if (size & LogRecordHeader::PADDING_FLAG)
+            {
+                position += size & ~LogRecordHeader::PADDING_FLAG;
+                continue;
+            }
+
+            position += size;
+            return reinterpret_cast<const LogRecordHeader*>(data);
+        }
+
+        return nullptr;
+    }
+
+    void ReleaseTo(uint64_t position)
+    {
+        tail_.store(position, std::memory_order_release);
+    }
+
+    // ---  /  ---
+
+    void AddDropped() { dropped_.fetch_add(1, std::memory_order_relaxed); }
+    void AddBlocked() { blocked_.fetch_add(1, std::memory_order_relaxed); }
+    void AddEnqueued() { enqueued_.fetch_add(1, std::memory_order_relaxed); }
+
+    [[nodiscard]] uint64_t GetDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t GetBlockedCount() const { return blocked_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t GetEnqueuedCount() const { return enqueued_.load(std::memory_order_relaxed); }
+
+    //  尡 Ǹ ǥ, ΰ 尡  ڵ带   Ͽ 
+    void MarkAbandoned() { is_abandoned_.store(true, std::memory_order_release); }
+    [[nodiscard]] bool IsAbandoned() const { return is_abandoned_.load(std::memory_order_acquire); }
+
+private:
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::byte* buffer_;
+
+    alignas(64) std::atomic<uint64_t> head_{ 0 };
+    uint64_t reserved_head_{ 0 };
+    uint64_t cached_tail_{ 0 };
+    std::atomic<uint64_t> enqueued_{ 0 };
+    std::atomic<uint64_t> dropped_{ 0 };
+    std::atomic<uint64_t> blocked_{ 0 };
+
+    alignas(64) std::atomic<uint64_t> tail_{ 0 };
+    std::atomic<bool> is_abandoned_{ false };
+};
@@ -1,15 +1,47 @@
 #include "Logger.hpp"
 #include <Windows.h>
+#include <algorithm>
 #include <format>
+#include <fstream>
 #include <iostream>
 #include <SDL3/SDL_log.h>
 #include <SDL3/SDL_oldnames.h>
 
+namespace
+{
+    //      · ǥ ( ڵ ΰ 尡   )
+    struct ThreadRingHolder
+    {
+        std::shared_ptr<LogRing> ring;
+
+        ~ThreadRingHolder()
+        {
+            if (ring)
+            {
+                ring->MarkAbandoned();
+            }
+        }
+    };
+}
+
 Logger& Logger::GetInstance() {
     static Logger instance;
     return instance;
 }
 
+Logger::Logger()
+{
+    for (auto& level : category_levels_)
+    {
+        level.store(LogConfig::DEFAULT_RUNTIME_LEVEL, std::memory_order_relaxed);
+    }
+}
+
+Logger::~Logger()
+{
+    StopAsync();
+}
+
 bool Logger::Initialize(const std::filesystem::path& logDir) 
 {
     try
@@ -29,6 +61,8 @@ bool Logger::Initialize(const std::filesystem::path& logDir)
 
         InitializeSDLLogging();
 
+        StartAsync();
+
         return true;
     }
     catch (const std::exception& e)
@@ -40,11 +74,455 @@ bool Logger::Initialize(const std::filesystem::path& logDir)
 
 void Logger::Shutdown() 
 {
+    const bool was_async = IsAsync();
+    StopAsync();
+
+    if (was_async)
+    {
+        const auto stats = GetStats();
+        Info("Logger stats: enqueued={} written={} dropped={} blocked={} sync={}",
+            stats.enqueued, stats.written, stats.dropped, stats.blocked, stats.synchronous);
+    }
+
+    std::lock_guard lock(output_mutex_);
     if (current_log_file_) {
         current_log_file_.reset();
     }
 }
 
+void Logger::StartAsync()
+{
+    if (is_async_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    stop_requested_ = false;
+    writer_thread_ = std::thread(&Logger::WriterThread, this);
+    is_async_.store(true, std::memory_order_release);
+}
+
+void Logger::StopAsync()
+{
+    if (!is_async_.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    //  α״  , ׶   ڵ带    
+    stop_requested_ = true;
+    Wake();
+
+    if (writer_thread_.joinable())
+    {
+        writer_thread_.join();
+    }
+
+    flush_cv_.notify_all();
+}
+
+void Logger::Flush()
+{
+    if (!IsAsync())
+    {
+        FlushOutput();
+        return;
+    }
+
+    const uint64_t target = flush_requested_.fetch_add(1) + 1;
+    Wake();
+
+    std::unique_lock lock(wake_mutex_);
+    flush_cv_.wait_for(lock, FLUSH_TIMEOUT, [this, target]()
+        {
+            return flush_completed_.load() >= target || !IsAsync();
+        });
+}
+
+void Logger::SetLogLevel(LogLevel level)
+{
+    for (auto& category_level : category_levels_)
+    {
+        category_level.store(level, std::memory_order_relaxed);
+    }
+}
+
+void Logger::SetCategoryLevel(LogCategory category, LogLevel level)
+{
+    category_levels_[static_cast<size_t>(category)].store(level, std::memory_order_relaxed);
+}
+
+LogLevel Logger::GetCategoryLevel(LogCategory category) const
+{
+    return category_levels_[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+}
+
+bool Logger::ApplyLevelSpec(std::string_view spec)
+{
+    const auto trim = [](std::string_view text)
+        {
+            const auto first = text.find_first_not_of(" \t\r\n");
+            if (first == std::string_view::npos)
+            {
+                return std::string_view{};
+            }
+            const auto last = text.find_last_not_of(" \t\r\n");
+            return text.substr(first, last - first + 1);
+        };
+
+    bool is_valid = true;
+
+    while (!spec.empty())
+    {
+        const auto separator = spec.find_first_of(",;\n");
+        const auto entry = trim(spec.substr(0, separator));
+        spec = separator == std::string_view::npos ? std::string_view{} : spec.substr(separator + 1);
+
+        if (entry.empty() || entry.front() == '#')
+        {
+            continue;
+        }
+
+        // "level" ̸ܵ ü īװ, "category=level" ̸ ش īװ
+        const auto equal = entry.find('=');
+        const auto name = equal == std::string_view::npos ? std::string_view("*") : trim(entry.substr(0, equal));
+        const auto level_name = equal == std::string_view::npos ? entry : trim(entry.substr(equal + 1));
+
+        const auto level = LogConfig::ParseLevel(level_name);
+        if (!level)
+        {
+            Warning("Unknown log level '{}' in level spec", level_name);
+            is_valid = false;
+            continue;
+        }
+
+        if (name == "*")
+        {
+            SetLogLevel(*level);
+        }
+        else if (const auto category = LogConfig::ParseCategory(name))
+        {
+            SetCategoryLevel(*category, *level);
+        }
+        else
+        {
+            Warning("Unknown log category '{}' in level spec", name);
+            is_valid = false;
+        }
+    }
+
+    return is_valid;
+}
+
+LoggerStats Logger::GetStats() const
+{
+    std::lock_guard lock(rings_mutex_);
+
+    LoggerStats stats = retired_stats_;
+    for (const auto& ring : rings_)
+    {
+        stats.enqueued += ring->GetEnqueuedCount();
+        stats.dropped += ring->GetDroppedCount();
+        stats.blocked += ring->GetBlockedCount();
+    }
+
+    stats.written = written_.load(std::memory_order_relaxed);
+    stats.synchronous = synchronous_.load(std::memory_order_relaxed);
+    stats.thread_count = rings_.size();
+    return stats;
+}
+
+LogRing& Logger::GetThreadRing()
+{
+    thread_local ThreadRingHolder holder;
+
+    if (!holder.ring)
+    {
+        holder.ring = std::make_shared<LogRing>();
+
+        std::lock_guard lock(rings_mutex_);
+        rings_.push_back(holder.ring);
+    }
+
+    return *holder.ring;
+}
+
+std::byte* Logger::ReserveRecord(LogRing& ring, LogLevel level, size_t size)
+{
+    if (std::byte* data = ring.TryReserve(size))
+    {
+        return data;
+    }
+
+    if (level < BLOCKING_LEVEL)
+    {
+        ring.AddDropped();
+        Wake();
+        return nullptr;
+    }
+
+    //  ̻  ʰ ΰ 尡    
+    ring.AddBlocked();
+    while (IsAsync())
+    {
+        Wake();
+        std::this_thread::yield();
+
+        if (std::byte* data = ring.TryReserve(size))
+        {
+            return data;
+        }
+    }
+
+    ring.AddDropped();
+    return nullptr;
+}
+
+void Logger::OnRecordCommitted(LogRing& ring, LogLevel level)
+{
+    ring.AddEnqueued();
+
+    if (level >= LogLevel::Error || ring.GetUsedSize() > ring.GetCapacity() / 2)
+    {
+        Wake();
+    }
+
+    // ũ  αװ ǵ ʵ Critical  ± 
+    if (level == LogLevel::Critical)
+    {
+        Flush();
+    }
+}
+
+void Logger::LogSync(LogLevel level, LogCategory category, const std::source_location& location, std::string_view message)
+{
+    TimestampCache cache;
+    std::string line;
+    line.reserve(message.size() + 96);
+
+    AppendLinePrefix(line, cache, level, category, std::chrono::system_clock::now(), location.file_name(), location.line());
+    line.append(message);
+    line.push_back('\n');
+
+    synchronous_.fetch_add(1, std::memory_order_relaxed);
+    WriteOutput(line);
+    FlushOutput();
+}
+
+void Logger::Wake()
+{
+    if (!wake_pending_.exchange(true))
+    {
+        {
+            std::lock_guard lock(wake_mutex_);
+        }
+        wake_cv_.notify_one();
+    }
+}
+
+void Logger::WriterThread()
+{
+    std::string batch;
+    batch.reserve(64 * 1024);
+    std::vector<PendingRecord> pending;
+
+    auto last_flush = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(wake_mutex_);
+            wake_cv_.wait_for(lock, FLUSH_INTERVAL, [this]()
+                {
+                    return wake_pending_.load() || stop_requested_.load();
+                });
+        }
+
+        wake_pending_ = false;
+
+        const bool is_stopping = stop_requested_.load();
+        const uint64_t flush_target = flush_requested_.load();
+
+        DrainRings(batch, pending);
+
+        const auto now = std::chrono::steady_clock::now();
+
+        if (now >= next_level_poll_)
+        {
+            PollLevelFile();
+            next_level_poll_ = now + LEVEL_FILE_POLL_INTERVAL;
+        }
+
+        const bool is_flush_requested = flush_target != flush_completed_.load();
+
+        if (is_stopping || is_flush_requested || now - last_flush >= FLUSH_INTERVAL)
+        {
+            FlushOutput();
+            last_flush = now;
+        }
+
+        if (is_flush_requested)
+        {
+            {
+                std::lock_guard lock(wake_mutex_);
+                flush_completed_ = flush_target;
+            }
+            flush_cv_.notify_all();
+        }
+
+        if (is_stopping)
+        {
+            break;
+        }
+    }
+}
+
+void Logger::DrainRings(std::string& batch, std::vector<PendingRecord>& pending)
+{
+    {
+        std::lock_guard lock(rings_mutex_);
+        drain_rings_.assign(rings_.begin(), rings_.end());
+    }
+
+    pending.clear();
+    std::vector<uint64_t> read_ends(drain_rings_.size());
+    uint64_t dropped = retired_stats_.dropped;
+
+    for (size_t i = 0; i < drain_rings_.size(); ++i)
+    {
+        auto& ring = *drain_rings_[i];
+        const uint64_t end = ring.GetWritePosition();
+        uint64_t position = ring.GetReadPosition();
+
+        while (const auto* record = ring.Read(position, end))
+        {
+            pending.push_back({ record, i });
+        }
+
+        read_ends[i] = end;
+        dropped += ring.GetDroppedCount();
+    }
+
+    //    Ÿӽ  (  ȿ   )
+    std::stable_sort(pending.begin(), pending.end(), [](const PendingRecord& lhs, const PendingRecord& rhs)
+        {
+            return lhs.record->timestamp < rhs.record->timestamp;
+        });
+
+    batch.clear();
+    for (const auto& entry : pending)
+    {
+        AppendRecord(batch, *entry.record);
+    }
+
+    if (dropped > reported_dropped_)
+    {
+        AppendLinePrefix(batch, writer_timestamp_, LogLevel::Warning, LogCategory::General, std::chrono::system_clock::now(), __FILE__, __LINE__);
+        std::format_to(std::back_inserter(batch), "Logger dropped {} record(s) (ring full)\n", dropped - reported_dropped_);
+        reported_dropped_ = dropped;
+    }
+
+    if (!batch.empty())
+    {
+        WriteOutput(batch);
+        written_.fetch_add(pending.size(), std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < drain_rings_.size(); ++i)
+    {
+        drain_rings_[i]->ReleaseTo(read_ends[i]);
+    }
+
+    //      踸  
+    std::lock_guard lock(rings_mutex_);
+    std::erase_if(rings_, [this](const std::shared_ptr<LogRing>& ring)
+        {
+            if (!ring->IsAbandoned() || ring->GetUsedSize() != 0)
+            {
+                return false;
+            }
+
+            retired_stats_.enqueued += ring->GetEnqueuedCount();
+            retired_stats_.dropped += ring->GetDroppedCount();
+            retired_stats_.blocked += ring->GetBlockedCount();
+            return true;
+        });
+    drain_rings_.clear();
+}
+
+void Logger::AppendRecord(std::string& batch, const LogRecordHeader& record)
+{
+    const std::chrono::system_clock::time_point time{ std::chrono::system_clock::duration{ record.timestamp } };
+    AppendLinePrefix(batch, writer_timestamp_, record.level, record.category, time, record.file, record.line);
+
+    try
+    {
+        const auto* args = reinterpret_cast<const std::byte*>(&record) + sizeof(LogRecordHeader);
+        record.formatter(batch, std::string_view(record.format, record.format_size), args);
+    }
+    catch (const std::exception& e)
+    {
+        batch.append("(log format failed: ").append(e.what()).append(")");
+    }
+
+    batch.push_back('\n');
+}
+
+void Logger::WriteOutput(const std::string& text)
+{
+    std::lock_guard lock(output_mutex_);
+
+    // ܼ 
+    if (log_to_console_)
+    {
+        std::fwrite(text.data(), 1, text.size(), stdout);
+        std::fflush(stdout);
+    }
+
+    //   (flush  ֱ)
+    if (log_to_file_ && current_log_file_)
+    {
+        std::fwrite(text.data(), 1, text.size(), current_log_file_.get());
+    }
+
+    //  
+    if (log_to_debugger_)
+    {
+        OutputDebugStringA(text.c_str());
+    }
+}
+
+void Logger::PollLevelFile()
+{
+    std::error_code error;
+    const auto path = log_directory_ / LEVEL_FILE_NAME;
+    const auto write_time = std::filesystem::last_write_time(path, error);
+
+    if (error || write_time == level_file_time_)
+    {
+        return;
+    }
+
+    level_file_time_ = write_time;
+
+    std::ifstream file(path);
+    const std::string spec((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    //  ٲ    īװ  
+    ApplyLevelSpec(spec);
+    Info("Log levels reloaded from {}", path.string());
+}
+
+void Logger::FlushOutput()
+{
+    std::lock_guard lock(output_mutex_);
+
+    if (current_log_file_)
+    {
+        std::fflush(current_log_file_.get());
+    }
+}
+
 void Logger::RotateLogFiles() 
 {
     try 
@@ -80,22 +558,35 @@ std::filesystem::path Logger::GetCurrentLogFilePath() const
         tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour);
 }
 
-std::string Logger::GetTimestamp() 
+void Logger::AppendLinePrefix(std::string& out, TimestampCache& cache, LogLevel level, LogCategory category,
+    std::chrono::system_clock::time_point time, std::string_view file, uint32_t line)
 {
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    std::tm tm;
-    localtime_s(&tm, &time);
+    const auto since_epoch = time.time_since_epoch();
+    const int64_t second = std::chrono::duration_cast<std::chrono::seconds>(since_epoch).count();
+    const auto millisecond = std::chrono::duration_cast<std::chrono::milliseconds>(since_epoch).count() % 1000;
+
+    // localtime ȯ ʰ ٲ  
+    if (second != cache.second)
+    {
+        const std::time_t seconds_time = static_cast<std::time_t>(second);
+        std::tm tm;
+        localtime_s(&tm, &seconds_time);
+
+        cache.second = second;
+        cache.text = std::format("{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}",
+            tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+            tm.tm_hour, tm.tm_min, tm.tm_sec);
+    }
 
-    return std::format("{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}",
-        tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
-        tm.tm_hour, tm.tm_min, tm.tm_sec);
+    std::format_to(std::back_inserter(out), "[{}.{:03d}] [{}] [{}] [{}:{}] ",
+        cache.text, millisecond, LogLevelToString(level), LogConfig::GetCategoryName(category), file, line);
 }
 
 std::string_view Logger::LogLevelToString(LogLevel level) 
 {
     switch (level) 
     {
+    case LogLevel::Trace: return "TRACE";
     case LogLevel::Debug: return "DEBUG";
     case LogLevel::Info: return "INFO";
     case LogLevel::Warning: return "WARNING";
@@ -113,6 +604,8 @@ void Logger::SDLLogOutputFunction(void* userdata, int category, SDL_LogPriority
     LogLevel level;
     switch (priority) {
     case SDL_LOG_PRIORITY_VERBOSE:
+        level = LogLevel::Trace;
+        break;
     case SDL_LOG_PRIORITY_DEBUG:
         level = LogLevel::Debug;
         break;
@@ -133,6 +626,14 @@ void Logger::SDLLogOutputFunction(void* userdata, int category, SDL_LogPriority
         break;
     }
 
+    const LogCategory log_category = (category == SDL_LOG_CATEGORY_RENDER || category == SDL_LOG_CATEGORY_VIDEO) ?
+        LogCategory::Render : LogCategory::General;
+
+    if (!LogConfig::IsCompiledIn(log_category, level) || !logger.IsEnabled(log_category, level))
+    {
+        return;
+    }
+
     // īװ ̸ 
     std::string categoryName;
     switch (category) {
@@ -150,26 +651,7 @@ void Logger::SDLLogOutputFunction(void* userdata, int category, SDL_LogPriority
 
     std::string formattedMessage = std::format("[SDL-{}] {}", categoryName, message);
 
-    auto location = std::source_location::current();
-
-    switch (level) 
-    {
-    case LogLevel::Debug:
-        logger.Debug("{}", formattedMessage);
-        break;
-    case LogLevel::Info:
-        logger.Info("{}", formattedMessage);
-        break;
-    case LogLevel::Warning:
-        logger.Warning("{}", formattedMessage);
-        break;
-    case LogLevel::Error:
-        logger.Error("{}", formattedMessage);
-        break;
-    case LogLevel::Critical:
-        logger.Critical("{}", formattedMessage);
-        break;
-    }
+    logger.Write(log_category, level, "{}", formattedMessage);
 }
 
 
@@ -1,4 +1,15 @@
 #pragma once
+/*
+*
+* : 񵿱 ΰ
+* 1. ȣ   ڿ , ȣ ġ, Ÿӽ,  ڸ 庰  (LogRing) 
+* 2. ׶ 尡    ð   ܼ//ſ ϰ , ֱ flush
+* 3.    Warning ̸ ( īƮ), Warning ̻    ( īƮ)
+* 4. Initialize ̳ Shutdown Ŀ ȣ 忡  
+* 5. īװ(LogCategory) Ÿ , <α >/log_levels.txt     ݿ
+*    (: "network=trace, render=warning" Ǵ "*=debug",  Ÿ ʹ LogConfig.hpp )
+*
+*/
 #include <string>
 #include <string_view>
 #include <filesystem>
@@ -8,20 +19,54 @@
 #include <chrono>
 #include <cstdio>
 #include <stdexcept>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include <Windows.h>
 
 #include <SDL3/SDL_log.h>
 
-enum class LogLevel {
-    Debug,
-    Info,
-    Warning,
-    Error,
-    Critical
+#include "LogRing.hpp"
+
+//  ڿ Բ ȣ ġ ĸó (⺻ ڰ ȣ ʿ 򰡵)
+template<typename... Args>
+struct LogFormatString
+{
+    template<typename T>
+        requires std::convertible_to<const T&, std::string_view>
+    consteval LogFormatString(const T& text, std::source_location location = std::source_location::current())
+        : format(text)
+        , location(location)
+    {
+    }
+
+    std::format_string<Args...> format;
+    std::source_location location;
+};
+
+struct LoggerStats
+{
+    uint64_t enqueued{ 0 };         //   ڵ
+    uint64_t written{ 0 };          // ׶ 尡  ڵ
+    uint64_t dropped{ 0 };          //     ڵ
+    uint64_t blocked{ 0 };          //    ȣ 尡  Ƚ
+    uint64_t synchronous{ 0 };      // ȣ 忡 ٷ  ڵ (񵿱  , ū ڵ)
+    size_t thread_count{ 0 };       //  ϵ   
 };
 
 class Logger {
 public:
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{ 100 };
+    static constexpr std::chrono::milliseconds FLUSH_TIMEOUT{ 1000 };
+    static constexpr LogLevel BLOCKING_LEVEL = LogLevel::Warning;
+    static constexpr std::chrono::seconds LEVEL_FILE_POLL_INTERVAL{ 1 };
+    static constexpr std::string_view LEVEL_FILE_NAME = "log_levels.txt";
+
     static Logger& GetInstance();
 
     Logger(const Logger&) = delete;
@@ -32,30 +77,58 @@ public:
     static void SDLLogOutputFunction(void* userdata, int category, SDL_LogPriority priority, const char* message);
     void InitializeSDLLogging();
 
+    // General īװ (ȣ ڴ ׻ 򰡵,  򰡱 Ϸ LOG_* ũ )
+    template<typename... Args>
+    void Trace(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args);
+
+    template<typename... Args>
+    void Debug(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args);
+
     template<typename... Args>
-    void Debug(std::format_string<Args...> fmt, Args&&... args);
+    void Info(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args);
 
     template<typename... Args>
-    void Info(std::format_string<Args...> fmt, Args&&... args);
+    void Warning(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args);
 
     template<typename... Args>
-    void Warning(std::format_string<Args...> fmt, Args&&... args);
+    void Error(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args);
 
     template<typename... Args>
-    void Error(std::format_string<Args...> fmt, Args&&... args);
+    void Critical(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args);
 
+    // īװ/   (LOG_AT ũο )
     template<typename... Args>
-    void Critical(std::format_string<Args...> fmt, Args&&... args);
+    void Write(LogCategory category, LogLevel level, LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args);
+
+    [[nodiscard]] bool IsEnabled(LogCategory category, LogLevel level) const
+    {
+        return level >= category_levels_[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+    }
 
     // ʱȭ  
     bool Initialize(const std::filesystem::path& logDir = "logs");
     void Shutdown();
 
+    // ׶   / ( ¿  )
+    void StartAsync();
+    void StopAsync();
+    [[nodiscard]] bool IsAsync() const { return is_async_.load(std::memory_order_acquire); }
+
+    // ݱ  ڵ尡 µǰ  flush   
+    void Flush();
+
+    [[nodiscard]] LoggerStats GetStats() const;
+
     // 
     void SetLogToConsole(bool enable) { log_to_console_ = enable; }
     void SetLogToFile(bool enable) { log_to_file_ = enable; }
     void SetLogToDebugger(bool enable) { log_to_debugger_ = enable; }
-    void SetLogLevel(LogLevel level) { log_level_ = level; }
+    void SetLogLevel(LogLevel level);     //  īװ
+    void SetCategoryLevel(LogCategory category, LogLevel level);
+    [[nodiscard]] LogLevel GetCategoryLevel(LogCategory category) const;
+
+    // "network=trace, render=warning", "*=debug", "info" , ߸ ׸   
+    bool ApplyLevelSpec(std::string_view spec);
 
     // SDL α  ´ Լ
     void SDLLogVerbose(int category, const char* fmt, ...);
@@ -66,32 +139,89 @@ public:
     void SDLLogCritical(int category, const char* fmt, ...);
 
 private:
-    Logger() = default;
-    ~Logger() = default;
+    Logger();
+    ~Logger();
+
+    struct PendingRecord
+    {
+        const LogRecordHeader* record;
+        size_t ring_index;
+    };
+
+    struct TimestampCache
+    {
+        int64_t second{ -1 };
+        std::string text;
+    };
 
     //  α 
     template<typename... Args>
     void Log(LogLevel level,
+        LogCategory category,
         const std::source_location& location,
         std::format_string<Args...> fmt,
         Args&&... args);
 
+    template<typename... Args>
+    void Enqueue(LogLevel level, LogCategory category, const std::source_location& location, std::string_view fmt, const Args&... args);
+
+    [[nodiscard]] LogRing& GetThreadRing();
+    [[nodiscard]] std::byte* ReserveRecord(LogRing& ring, LogLevel level, size_t size);
+    void OnRecordCommitted(LogRing& ring, LogLevel level);
+    void LogSync(LogLevel level, LogCategory category, const std::source_location& location, std::string_view message);
+    void Wake();
+
+    // ׶ 
+    void WriterThread();
+    void DrainRings(std::string& batch, std::vector<PendingRecord>& pending);
+    void AppendRecord(std::string& batch, const LogRecordHeader& record);
+    void WriteOutput(const std::string& text);
+    void FlushOutput();
+    void PollLevelFile();
+
     // α  
     void RotateLogFiles();
     [[nodiscard]] std::filesystem::path GetCurrentLogFilePath() const;
 
     // ƿƼ Լ
-    [[nodiscard]] static std::string GetTimestamp();
+    static void AppendLinePrefix(std::string& out, TimestampCache& cache, LogLevel level, LogCategory category,
+        std::chrono::system_clock::time_point time, std::string_view file, uint32_t line);
     [[nodiscard]] static std::string_view LogLevelToString(LogLevel level);
 
     //  
     std::filesystem::path log_directory_;
     std::unique_ptr<std::FILE, decltype(&std::fclose)> current_log_file_{ nullptr, std::fclose };
 
-    LogLevel log_level_{ LogLevel::Info };
-    bool log_to_console_{ true };
-    bool log_to_file_{ true };
-    bool log_to_debugger_{ true };
+    std::array<std::atomic<LogLevel>, LogConfig::CATEGORY_COUNT> category_levels_{};
+    std::atomic<bool> log_to_console_{ true };
+    std::atomic<bool> log_to_file_{ true };
+    std::atomic<bool> log_to_debugger_{ true };
+
+    //    (  α  )
+    mutable std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<LogRing>> rings_;
+    LoggerStats retired_stats_;
+
+    // ׶  
+    std::thread writer_thread_;
+    std::atomic<bool> is_async_{ false };
+    std::atomic<bool> stop_requested_{ false };
+    std::atomic<bool> wake_pending_{ false };
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable flush_cv_;
+    std::atomic<uint64_t> flush_requested_{ 0 };
+    std::atomic<uint64_t> flush_completed_{ 0 };
+
+    std::vector<std::shared_ptr<LogRing>> drain_rings_;    // ׶  
+    TimestampCache writer_timestamp_;                      // ׶  
+    uint64_t reported_dropped_{ 0 };                       // ׶  
+    std::filesystem::file_time_type level_file_time_{};    // ׶  
+    std::chrono::steady_clock::time_point next_level_poll_{};
+
+    std::mutex output_mutex_;
+    std::atomic<uint64_t> written_{ 0 };
+    std::atomic<uint64_t> synchronous_{ 0 };
 
     static constexpr size_t MAX_LOG_FILES = 5;
     static constexpr size_t MAX_LOG_SIZE = 10 * 1024 * 1024; // 10MB
@@ -99,74 +229,85 @@ private:
 
 // ø 
 template<typename... Args>
-void Logger::Debug(std::format_string<Args...> fmt, Args&&... args) 
+void Logger::Trace(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args) 
 {
-    Log(LogLevel::Debug, std::source_location::current(), fmt, std::forward<Args>(args)...);
+    if constexpr (LogConfig::IsCompiledIn(LogCategory::General, LogLevel::Trace))
+    {
+        Log<Args...>(LogLevel::Trace, LogCategory::General, fmt.location, fmt.format, std::forward<Args>(args)...);
+    }
 }
 
 template<typename... Args>
-void Logger::Info(std::format_string<Args...> fmt, Args&&... args) 
+void Logger::Debug(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args) 
 {
-    Log(LogLevel::Info, std::source_location::current(), fmt, std::forward<Args>(args)...);
+    if constexpr (LogConfig::IsCompiledIn(LogCategory::General, LogLevel::Debug))
+    {
+        Log<Args...>(LogLevel::Debug, LogCategory::General, fmt.location, fmt.format, std::forward<Args>(args)...);
+    }
 }
 
 template<typename... Args>
-void Logger::Warning(std::format_string<Args...> fmt, Args&&... args) 
+void Logger::Info(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args) 
 {
-    Log(LogLevel::Warning, std::source_location::current(), fmt, std::forward<Args>(args)...);
+    if constexpr (LogConfig::IsCompiledIn(LogCategory::General, LogLevel::Info))
+    {
+        Log<Args...>(LogLevel::Info, LogCategory::General, fmt.location, fmt.format, std::forward<Args>(args)...);
+    }
 }
 
 template<typename... Args>
-void Logger::Error(std::format_string<Args...> fmt, Args&&... args) 
+void Logger::Warning(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args) 
 {
-    Log(LogLevel::Error, std::source_location::current(), fmt, std::forward<Args>(args)...);
+    if constexpr (LogConfig::IsCompiledIn(LogCategory::General, LogLevel::Warning))
+    {
+        Log<Args...>(LogLevel::Warning, LogCategory::General, fmt.location, fmt.format, std::forward<Args>(args)...);
+    }
 }
 
 template<typename... Args>
-void Logger::Critical(std::format_string<Args...> fmt, Args&&... args) 
+void Logger::Error(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args) 
 {
-    Log(LogLevel::Critical, std::source_location::current(), fmt, std::forward<Args>(args)...);
+    if constexpr (LogConfig::IsCompiledIn(LogCategory::General, LogLevel::Error))
+    {
+        Log<Args...>(LogLevel::Error, LogCategory::General, fmt.location, fmt.format, std::forward<Args>(args)...);
+    }
+}
+
+template<typename... Args>
+void Logger::Critical(LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args) 
+{
+    if constexpr (LogConfig::IsCompiledIn(LogCategory::General, LogLevel::Critical))
+    {
+        Log<Args...>(LogLevel::Critical, LogCategory::General, fmt.location, fmt.format, std::forward<Args>(args)...);
+    }
+}
+
+template<typename... Args>
+void Logger::Write(LogCategory category, LogLevel level, LogFormatString<std::type_identity_t<Args>...> fmt, Args&&... args)
+{
+    Log<Args...>(level, category, fmt.location, fmt.format, std::forward<Args>(args)...);
 }
 
 template<typename... Args>
 void Logger::Log(LogLevel level,
+    LogCategory category,
     const std::source_location& location,
     std::format_string<Args...> fmt,
     Args&&... args) 
 {
-    if (level < log_level_)
+    if (!IsEnabled(category, level))
     {
         return;
     }
 
     try {
-        // α ޽ 
-        std::string message = std::format("[{}] [{}] [{}:{}] {}\n",
-            GetTimestamp(),
-            LogLevelToString(level),
-            location.file_name(),
-            location.line(),
-            std::format(fmt, std::forward<Args>(args)...));
-
-        // ܼ 
-        if (log_to_console_) 
+        if (!is_async_.load(std::memory_order_acquire))
         {
-            std::printf("%s", message.c_str());
-            std::fflush(stdout);
+            LogSync(level, category, location, std::format(fmt, std::forward<Args>(args)...));
+            return;
         }
 
-        //  
-        if (log_to_file_ && current_log_file_) 
-        {
-            std::fprintf(current_log_file_.get(), "%s", message.c_str());
-            std::fflush(current_log_file_.get());
-        }
-
-        //  
-        if (log_to_debugger_) 
-        {
-            OutputDebugStringA(message.c_str());
-        }
+        Enqueue<std::decay_t<Args>...>(level, category, location, fmt.get(), args...);
     }
     catch (const std::exception& e) 
     {
@@ -175,15 +316,77 @@ void Logger::Log(LogLevel level,
     }
 }
 
+template<typename... Args>
+void Logger::Enqueue(LogLevel level, LogCategory category, const std::source_location& location, std::string_view fmt, const Args&... args)
+{
+    // ڿ ƴ ڸ ŸԸ ⼭ ڿȭǰ,  / ״ ڵ
+    const std::tuple<decltype(LogArg::Prepare(args))...> prepared{ LogArg::Prepare(args)... };
+
+    size_t size = sizeof(LogRecordHeader);
+    std::apply([&size](const auto&... value) { ((size += LogArg::EncodedSize(value)), ...); }, prepared);
+    size = LogArg::Align(size);
+
+    LogRing& ring = GetThreadRing();
+
+    if (size > ring.GetMaxRecordSize())
+    {
+        LogSync(level, category, location, std::vformat(fmt, std::make_format_args(args...)));
+        return;
+    }
+
+    std::byte* data = ReserveRecord(ring, level, size);
+    if (!data)
+    {
+        return;
+    }
+
+    auto* header = reinterpret_cast<LogRecordHeader*>(data);
+    header->size = static_cast<uint32_t>(size);
+    header->line = static_cast<uint32_t>(location.line());
+    header->timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+    header->format = fmt.data();
+    header->file = location.file_name();
+    header->formatter = &LogArg::FormatRecord<Args...>;
+    header->format_size = static_cast<uint32_t>(fmt.size());
+    header->level = level;
+    header->category = category;
+
+    std::byte* cursor = data + sizeof(LogRecordHeader);
+    std::apply([&cursor](const auto&... value) { (LogArg::Encode(cursor, value), ...); }, prepared);
+
+    ring.Commit(size);
+    OnRecordCommitted(ring, level);
+}
+
 // ۷ι ׼ ũ
 #define LOGGER Logger::GetInstance()
 
-// Ǽ ũ
-#define LOG_DEBUG(...) LOGGER.Debug(__VA_ARGS__)
-#define LOG_INFO(...) LOGGER.Info(__VA_ARGS__)
-#define LOG_WARNING(...) LOGGER.Warning(__VA_ARGS__)
-#define LOG_ERROR(...) LOGGER.Error(__VA_ARGS__)
-#define LOG_CRITICAL(...) LOGGER.Critical(__VA_ARGS__)
+//  Ÿ  ũ: Ȱ   򰡸   ŵǰ, Ȱ  Ÿ  Ȯ   
+#define LOG_AT(category, level, ...) \
+    do \
+    { \
+        if constexpr (LogConfig::IsCompiledIn(category, level)) \
+        { \
+            if (LOGGER.IsEnabled(category, level)) \
+            { \
+                LOGGER.Write(category, level, __VA_ARGS__); \
+            } \
+        } \
+    } while (false)
+
+// īװ ũ (: LOG_NETWORK(Trace, "recv type={} size={}", type, size))
+#define LOG_NETWORK(level, ...) LOG_AT(LogCategory::Network, LogLevel::level, __VA_ARGS__)
+#define LOG_RENDER(level, ...) LOG_AT(LogCategory::Render, LogLevel::level, __VA_ARGS__)
+#define LOG_GAMEPLAY(level, ...) LOG_AT(LogCategory::Gameplay, LogLevel::level, __VA_ARGS__)
+#define LOG_RESOURCE(level, ...) LOG_AT(LogCategory::Resource, LogLevel::level, __VA_ARGS__)
+
+// Ǽ ũ (General īװ)
+#define LOG_TRACE(...) LOG_AT(LogCategory::General, LogLevel::Trace, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LogCategory::General, LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT(LogCategory::General, LogLevel::Info, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_AT(LogCategory::General, LogLevel::Warning, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LogCategory::General, LogLevel::Error, __VA_ARGS__)
+#define LOG_CRITICAL(...) LOG_AT(LogCategory::General, LogLevel::Critical, __VA_ARGS__)
 
 #define SDL_LOG_VERBOSE(category, ...) LOGGER.SDLLogVerbose(category, __VA_ARGS__)
 #define SDL_LOG_DEBUG(category, ...) LOGGER.SDLLogDebug(category, __VA_ARGS__)
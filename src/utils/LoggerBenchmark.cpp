@@ -0,0 +1,125 @@
+#include "LoggerBenchmark.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <thread>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    //  忡 callCount  α׸  ȣ⸶ ɸ ð 
+    std::vector<double> MeasureCalls(int callCount)
+    {
+        std::vector<double> samples;
+        samples.reserve(callCount);
+
+        const std::string name = "puyo";
+
+        for (int i = 0; i < callCount; ++i)
+        {
+            const auto start = Clock::now();
+            LOGGER.Info("bench frame={} value={:.3f} name={} ok={}", i, static_cast<float>(i) * 0.5f, name, (i & 1) == 0);
+            samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+
+            if ((i + 1) % LoggerBenchmark::BURST_SIZE == 0)
+            {
+                LOGGER.Flush();
+            }
+        }
+
+        return samples;
+    }
+
+    LoggerBenchmark::Result Measure(std::string_view mode, int threadCount, int callsPerThread)
+    {
+        const uint64_t dropped_before = LOGGER.GetStats().dropped;
+
+        std::vector<std::vector<double>> thread_samples(threadCount);
+        std::vector<std::thread> threads;
+
+        for (int i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back([&thread_samples, i, callsPerThread]()
+                {
+                    thread_samples[i] = MeasureCalls(callsPerThread);
+                });
+        }
+
+        thread_samples[0] = MeasureCalls(callsPerThread);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        LOGGER.Flush();
+
+        std::vector<double> samples;
+        for (auto& values : thread_samples)
+        {
+            samples.insert(samples.end(), values.begin(), values.end());
+        }
+        std::sort(samples.begin(), samples.end());
+
+        LoggerBenchmark::Result result;
+        result.mode = mode;
+        result.thread_count = threadCount;
+        result.call_count = samples.size();
+
+        if (!samples.empty())
+        {
+            result.avg_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+            result.p50_ns = samples[samples.size() / 2];
+            result.p99_ns = samples[static_cast<size_t>(static_cast<double>(samples.size() - 1) * 0.99)];
+            result.max_ns = samples.back();
+        }
+
+        result.dropped = LOGGER.GetStats().dropped - dropped_before;
+        return result;
+    }
+}
+
+namespace LoggerBenchmark
+{
+    std::vector<Result> Run(int callsPerThread)
+    {
+        std::vector<Result> results;
+
+        LOGGER.Initialize();
+
+        // ܼ/     ƴϹǷ Ͽ 
+        LOGGER.SetLogToConsole(false);
+        LOGGER.SetLogToDebugger(false);
+
+        LOGGER.StopAsync();
+        results.push_back(Measure("sync", 1, callsPerThread));
+
+        LOGGER.StartAsync();
+        results.push_back(Measure("async", 1, callsPerThread));
+        results.push_back(Measure("async", 4, callsPerThread));
+
+        LOGGER.SetLogToConsole(true);
+        LOGGER.SetLogToDebugger(true);
+
+        return results;
+    }
+
+    void LogResults(std::span<const Result> results)
+    {
+        for (const auto& result : results)
+        {
+            LOGGER.Info("[LoggerBenchmark] mode={} threads={} calls={} avg={:.0f}ns p50={:.0f}ns p99={:.0f}ns max={:.0f}ns dropped={}",
+                result.mode,
+                result.thread_count,
+                result.call_count,
+                result.avg_ns,
+                result.p50_ns,
+                result.p99_ns,
+                result.max_ns,
+                result.dropped);
+        }
+    }
+}
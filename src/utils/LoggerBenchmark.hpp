@@ -0,0 +1,35 @@
+#pragma once
+/*
+*
+* : Logger ȣ   ð(ns/call) 
+* 1.   --bench-logger  ϸ â  ʰ     
+* 2.  () / 񵿱 1  / 񵿱 4    ޽ 
+* 3.  ġ ʵ Ʈ Flush ϸ, Flush  ð  
+*
+*/
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace LoggerBenchmark
+{
+    inline constexpr int DEFAULT_CALLS = 100'000;
+    inline constexpr int BURST_SIZE = 256;
+
+    struct Result
+    {
+        std::string_view mode;
+        int thread_count{ 1 };
+        size_t call_count{ 0 };
+        double avg_ns{ 0.0 };
+        double p50_ns{ 0.0 };
+        double p99_ns{ 0.0 };
+        double max_ns{ 0.0 };
+        uint64_t dropped{ 0 };
+    };
+
+    [[nodiscard]] std::vector<Result> Run(int callsPerThread = DEFAULT_CALLS);
+    void LogResults(std::span<const Result> results);
+}
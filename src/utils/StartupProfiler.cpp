@@ -0,0 +1,165 @@
+#include "StartupProfiler.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+
+namespace
+{
+    std::string EscapeJson(std::string_view text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                escaped.push_back('\\');
+            }
+            escaped.push_back(c);
+        }
+
+        return escaped;
+    }
+}
+
+StartupProfiler::ScopedEvent::ScopedEvent(std::string name, std::string_view category)
+    : name_(std::move(name))
+    , category_(category)
+    , start_us_(STARTUP_PROFILER.NowUs())
+{
+}
+
+StartupProfiler::ScopedEvent::~ScopedEvent()
+{
+    auto& profiler = STARTUP_PROFILER;
+    profiler.AddEvent(std::move(name_), category_, start_us_, profiler.NowUs() - start_us_);
+}
+
+StartupProfiler& StartupProfiler::GetInstance()
+{
+    static StartupProfiler instance;
+    return instance;
+}
+
+StartupProfiler::StartupProfiler()
+    : origin_(Clock::now())
+{
+}
+
+int64_t StartupProfiler::NowUs() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin_).count();
+}
+
+void StartupProfiler::AddEvent(std::string name, std::string_view category, int64_t startUs, int64_t durationUs)
+{
+    std::lock_guard lock(mutex_);
+
+    const uint32_t threadId = GetThreadIndex(std::this_thread::get_id());
+    events_.push_back({ std::move(name), category, startUs, durationUs, threadId });
+    is_dirty_ = true;
+}
+
+uint32_t StartupProfiler::GetThreadIndex(std::thread::id id)
+{
+    //  尡 0  ǵ ó   ȣ ο
+    auto it = std::find(threads_.begin(), threads_.end(), id);
+    if (it != threads_.end())
+    {
+        return static_cast<uint32_t>(it - threads_.begin());
+    }
+
+    threads_.push_back(id);
+    return static_cast<uint32_t>(threads_.size() - 1);
+}
+
+void StartupProfiler::MarkFirstFrame()
+{
+    if (IsFirstFrameMarked())
+    {
+        return;
+    }
+
+    first_frame_us_ = NowUs();
+
+    LogSummary();
+    Flush();
+}
+
+void StartupProfiler::Flush()
+{
+    if (output_path_.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        if (!is_dirty_)
+        {
+            return;
+        }
+        is_dirty_ = false;
+    }
+
+    if (WriteTrace())
+    {
+        LOGGER.Info("Startup trace written to {}", output_path_);
+    }
+}
+
+void StartupProfiler::LogSummary() const
+{
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard lock(mutex_);
+        events = events_;
+    }
+
+    //    ϵǹǷ   Ͽ ø  ٱ ̵ 
+    std::stable_sort(events.begin(), events.end(),
+        [](const TraceEvent& a, const TraceEvent& b)
+        {
+            return a.start_us < b.start_us;
+        });
+
+    LOGGER.Info("Time to first frame: {:.2f} ms", first_frame_us_ / 1000.0);
+
+    for (const auto& event : events)
+    {
+        LOGGER.Info("  [{}] {}: {:.2f} ms", event.category, event.name, event.duration_us / 1000.0);
+    }
+}
+
+bool StartupProfiler::WriteTrace() const
+{
+    std::lock_guard lock(mutex_);
+
+    std::ofstream stream(output_path_, std::ios::trunc);
+    if (!stream)
+    {
+        LOGGER.Error("Failed to open startup trace file: {}", output_path_);
+        return false;
+    }
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    stream << R"({"name":"process_name","ph":"M","pid":1,"tid":0,"args":{"name":"PuyoPuyo"}})";
+
+    for (const auto& event : events_)
+    {
+        stream << std::format(",\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":1,\"tid\":{}}}",
+            EscapeJson(event.name), event.category, event.start_us, event.duration_us, event.thread_id);
+    }
+
+    if (IsFirstFrameMarked())
+    {
+        stream << std::format(",\n{{\"name\":\"FirstFrame\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":{},\"pid\":1,\"tid\":0}}",
+            first_frame_us_);
+    }
+
+    stream << "\n]}\n";
+    return static_cast<bool>(stream);
+}
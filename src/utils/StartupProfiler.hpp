@@ -0,0 +1,100 @@
+#pragma once
+/*
+*
+* : α׷ ۺ ù  ± ʱȭ  
+* 1. ScopedEvent  Ŵ/ ʱȭ    (ø ,  )
+* 2. ù  Present  MarkFirstFrame  ȣϸ ù ӱ ð  ð α׷ 
+* 3.  ΰ Ǿ  Chrome Trace Event (JSON)  (chrome://tracing, Perfetto)
+* 4. ù  Ŀ ʱȭǴ  ʱȭ  Ͽ Release     
+*
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+class StartupProfiler
+{
+public:
+
+    static constexpr const char* DEFAULT_TRACE_FILE = "startup_trace.json";
+
+    class ScopedEvent
+    {
+    public:
+        ScopedEvent(std::string name, std::string_view category);
+        ~ScopedEvent();
+
+        ScopedEvent(const ScopedEvent&) = delete;
+        ScopedEvent& operator=(const ScopedEvent&) = delete;
+        ScopedEvent(ScopedEvent&&) = delete;
+        ScopedEvent& operator=(ScopedEvent&&) = delete;
+
+    private:
+        std::string name_;
+        std::string_view category_;
+        int64_t start_us_;
+    };
+
+    static StartupProfiler& GetInstance();
+
+    StartupProfiler(const StartupProfiler&) = delete;
+    StartupProfiler& operator=(const StartupProfiler&) = delete;
+    StartupProfiler(StartupProfiler&&) = delete;
+    StartupProfiler& operator=(StartupProfiler&&) = delete;
+
+    //   Ϸ  ʰ α׷θ 
+    void SetOutputPath(std::string path) { output_path_ = std::move(path); }
+
+    // category     ڿ̾ Ѵ
+    void AddEvent(std::string name, std::string_view category, int64_t startUs, int64_t durationUs);
+
+    void MarkFirstFrame();
+    void Flush();
+
+    [[nodiscard]] bool IsFirstFrameMarked() const { return first_frame_us_ >= 0; }
+    [[nodiscard]] int64_t GetTimeToFirstFrameUs() const { return first_frame_us_; }
+
+    // μ  ð(ù GetInstance ȣ)  ð
+    [[nodiscard]] int64_t NowUs() const;
+
+private:
+
+    using Clock = std::chrono::steady_clock;
+
+    struct TraceEvent
+    {
+        std::string name;
+        std::string_view category;
+        int64_t start_us{ 0 };
+        int64_t duration_us{ 0 };
+        uint32_t thread_id{ 0 };
+    };
+
+    StartupProfiler();
+    ~StartupProfiler() = default;
+
+    void LogSummary() const;
+    bool WriteTrace() const;
+    uint32_t GetThreadIndex(std::thread::id id);
+
+private:
+
+    Clock::time_point origin_;
+    int64_t first_frame_us_{ -1 };
+    std::string output_path_;
+
+    mutable std::mutex mutex_;
+    std::vector<TraceEvent> events_;
+    std::vector<std::thread::id> threads_;
+    bool is_dirty_{ false };
+};
+
+#define STARTUP_PROFILER StartupProfiler::GetInstance()
+#define STARTUP_SCOPE_CONCAT_INNER(a, b) a##b
+#define STARTUP_SCOPE_CONCAT(a, b) STARTUP_SCOPE_CONCAT_INNER(a, b)
+#define STARTUP_SCOPE(name, category) StartupProfiler::ScopedEvent STARTUP_SCOPE_CONCAT(startup_scope_, __LINE__)(name, category)
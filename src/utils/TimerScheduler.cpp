@@ -0,0 +1,393 @@
+#include "TimerScheduler.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    constexpr size_t INITIAL_NODE_CAPACITY = 64;
+}
+
+TimerScheduler& TimerScheduler::GetInstance()
+{
+    static TimerScheduler instance(TimeSource::Manual);
+    return instance;
+}
+
+TimerScheduler::TimerScheduler(TimeSource source)
+    : source_(source)
+    , origin_(Clock::now())
+{
+    list_heads_.fill(INVALID_INDEX);
+    nodes_.reserve(INITIAL_NODE_CAPACITY);
+}
+
+uint64_t TimerScheduler::ToTick(Clock::time_point time) const
+{
+    if (time <= origin_)
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time - origin_).count());
+}
+
+TimerScheduler::TimerId TimerScheduler::MakeId(uint32_t index, uint32_t generation)
+{
+    // 0  INVALID_TIMER_ID    ε 1 
+    return (static_cast<uint64_t>(generation) << 32) | (static_cast<uint64_t>(index) + 1);
+}
+
+TimerScheduler::TimerNode* TimerScheduler::FindNode(TimerId id, uint32_t& index)
+{
+    const uint32_t low = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+    if (low == 0 || low > nodes_.size())
+    {
+        return nullptr;
+    }
+
+    index = low - 1;
+    auto& node = nodes_[index];
+
+    if (node.generation != static_cast<uint32_t>(id >> 32) || node.list == INVALID_INDEX)
+    {
+        return nullptr;
+    }
+
+    return &node;
+}
+
+TimerScheduler::TimerId TimerScheduler::ScheduleTask(float delayInSeconds, Callback callback, const void* owner)
+{
+    const auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<float>(std::max(delayInSeconds, 0.0f)));
+
+    std::lock_guard lock(mutex_);
+
+    const uint64_t baseTick = (source_ == TimeSource::Manual) ? current_tick_ : ToTick(Clock::now());
+    const uint64_t requestTick = baseTick + static_cast<uint64_t>(delay.count());
+
+    // ̹  ð  ƽ ϰ,  ǥ  ִ  
+    const uint64_t expireTick = std::clamp(requestTick, current_tick_ + 1, current_tick_ + MAX_DELAY_TICKS);
+
+    const uint32_t index = AllocateNode();
+    auto& node = nodes_[index];
+    node.callback = std::move(callback);
+    node.owner = owner;
+    node.expire_tick = expireTick;
+
+    AddToWheel(index);
+    LinkToOwner(index);
+    ++active_count_;
+
+    return MakeId(index, node.generation);
+}
+
+bool TimerScheduler::CancelTask(TimerId id)
+{
+    Callback released;
+    {
+        std::lock_guard lock(mutex_);
+
+        uint32_t index = INVALID_INDEX;
+        auto* node = FindNode(id, index);
+        if (!node)
+        {
+            return false;
+        }
+
+        // ĸó ü Ҹڰ ٷ ٽ ȣص ǵ  ۿ 
+        released = std::move(node->callback);
+
+        UnlinkFromList(index);
+        UnlinkFromOwner(index);
+        FreeNode(index);
+        --active_count_;
+    }
+
+    return true;
+}
+
+size_t TimerScheduler::CancelOwner(const void* owner)
+{
+    if (!owner)
+    {
+        return 0;
+    }
+
+    std::vector<Callback> released;
+    {
+        std::lock_guard lock(mutex_);
+
+        auto it = owner_heads_.find(owner);
+        if (it == owner_heads_.end())
+        {
+            return 0;
+        }
+
+        uint32_t index = it->second;
+        owner_heads_.erase(it);
+
+        while (index != INVALID_INDEX)
+        {
+            auto& node = nodes_[index];
+            const uint32_t next = node.owner_next;
+
+            released.push_back(std::move(node.callback));
+
+            node.owner_prev = INVALID_INDEX;
+            node.owner_next = INVALID_INDEX;
+            node.owner = nullptr;
+
+            UnlinkFromList(index);
+            FreeNode(index);
+            --active_count_;
+
+            index = next;
+        }
+    }
+
+    return released.size();
+}
+
+void TimerScheduler::Update()
+{
+    Update(Clock::now());
+}
+
+void TimerScheduler::Update(Clock::time_point now)
+{
+    {
+        std::lock_guard lock(mutex_);
+        AdvanceTo(ToTick(now));
+    }
+
+    RunExpired();
+}
+
+void TimerScheduler::Advance(float seconds)
+{
+    {
+        std::lock_guard lock(mutex_);
+        manual_seconds_ += std::max(seconds, 0.0f);
+        AdvanceTo(static_cast<uint64_t>(manual_seconds_ * 1000.0));
+    }
+
+    RunExpired();
+}
+
+void TimerScheduler::RunExpired()
+{
+    //  Ͽ ϳ   ۿ  (ݹ ȿ / ,   ҵ ۾ ǳʶ)
+    while (true)
+    {
+        Callback callback;
+        {
+            std::lock_guard lock(mutex_);
+
+            const uint32_t index = list_heads_[EXPIRED_LIST];
+            if (index == INVALID_INDEX)
+            {
+                break;
+            }
+
+            callback = std::move(nodes_[index].callback);
+
+            UnlinkFromList(index);
+            UnlinkFromOwner(index);
+            FreeNode(index);
+            --active_count_;
+        }
+
+        if (callback)
+        {
+            callback();
+        }
+    }
+}
+
+size_t TimerScheduler::GetActiveCount() const
+{
+    std::lock_guard lock(mutex_);
+    return active_count_;
+}
+
+uint32_t TimerScheduler::AllocateNode()
+{
+    if (free_head_ != INVALID_INDEX)
+    {
+        const uint32_t index = free_head_;
+        free_head_ = nodes_[index].next;
+        nodes_[index].next = INVALID_INDEX;
+        return index;
+    }
+
+    nodes_.emplace_back();
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+void TimerScheduler::FreeNode(uint32_t index)
+{
+    auto& node = nodes_[index];
+    node.callback.Reset();
+    node.owner = nullptr;
+    node.list = INVALID_INDEX;
+    node.prev = INVALID_INDEX;
+    ++node.generation;
+
+    node.next = free_head_;
+    free_head_ = index;
+}
+
+void TimerScheduler::AddToWheel(uint32_t index)
+{
+    const uint64_t expireTick = nodes_[index].expire_tick;
+
+    //  ƽ ޶   ڸ(8Ʈ ) ܰ迡 ġϸ,
+    //  ƽ  ڸ ش Կ ϴ   ܰ   ƽ Ȯ ȴ
+    const uint64_t difference = expireTick ^ current_tick_;
+
+    uint32_t level = 0;
+    while (level + 1 < LEVEL_COUNT && (difference >> (LEVEL_BITS * (level + 1))) != 0)
+    {
+        ++level;
+    }
+
+    const uint32_t slot = static_cast<uint32_t>(expireTick >> (LEVEL_BITS * level)) & (SLOTS_PER_LEVEL - 1);
+    LinkToList(index, level * SLOTS_PER_LEVEL + slot);
+}
+
+void TimerScheduler::LinkToList(uint32_t index, uint32_t list)
+{
+    auto& node = nodes_[index];
+    node.list = list;
+    node.prev = INVALID_INDEX;
+    node.next = list_heads_[list];
+
+    if (node.next != INVALID_INDEX)
+    {
+        nodes_[node.next].prev = index;
+    }
+
+    list_heads_[list] = index;
+}
+
+void TimerScheduler::UnlinkFromList(uint32_t index)
+{
+    auto& node = nodes_[index];
+
+    if (node.prev != INVALID_INDEX)
+    {
+        nodes_[node.prev].next = node.next;
+    }
+    else
+    {
+        list_heads_[node.list] = node.next;
+    }
+
+    if (node.next != INVALID_INDEX)
+    {
+        nodes_[node.next].prev = node.prev;
+    }
+
+    node.list = INVALID_INDEX;
+    node.prev = INVALID_INDEX;
+    node.next = INVALID_INDEX;
+}
+
+void TimerScheduler::LinkToOwner(uint32_t index)
+{
+    auto& node = nodes_[index];
+    if (!node.owner)
+    {
+        return;
+    }
+
+    auto [it, inserted] = owner_heads_.try_emplace(node.owner, index);
+    if (!inserted)
+    {
+        node.owner_next = it->second;
+        nodes_[it->second].owner_prev = index;
+        it->second = index;
+    }
+}
+
+void TimerScheduler::UnlinkFromOwner(uint32_t index)
+{
+    auto& node = nodes_[index];
+    if (!node.owner)
+    {
+        return;
+    }
+
+    if (node.owner_prev != INVALID_INDEX)
+    {
+        nodes_[node.owner_prev].owner_next = node.owner_next;
+    }
+    else if (node.owner_next != INVALID_INDEX)
+    {
+        owner_heads_[node.owner] = node.owner_next;
+    }
+    else
+    {
+        owner_heads_.erase(node.owner);
+    }
+
+    if (node.owner_next != INVALID_INDEX)
+    {
+        nodes_[node.owner_next].owner_prev = node.owner_prev;
+    }
+
+    node.owner_prev = INVALID_INDEX;
+    node.owner_next = INVALID_INDEX;
+}
+
+void TimerScheduler::AdvanceTo(uint64_t targetTick)
+{
+    while (current_tick_ < targetTick)
+    {
+        //   ۾  ƽ ϳ  ʿ  ٷ ̵
+        if (active_count_ == 0)
+        {
+            current_tick_ = targetTick;
+            return;
+        }
+
+        ++current_tick_;
+
+        //  ܰ谡      ܰ    ܰ  
+        for (uint32_t level = 1; level < LEVEL_COUNT; ++level)
+        {
+            if ((current_tick_ & ((1ull << (LEVEL_BITS * level)) - 1)) != 0)
+            {
+                break;
+            }
+
+            Cascade(level, static_cast<uint32_t>(current_tick_ >> (LEVEL_BITS * level)) & (SLOTS_PER_LEVEL - 1));
+        }
+
+        //  ƽ 0ܰ   
+        const uint32_t slot = static_cast<uint32_t>(current_tick_) & (SLOTS_PER_LEVEL - 1);
+        uint32_t index = list_heads_[slot];
+
+        while (index != INVALID_INDEX)
+        {
+            const uint32_t next = nodes_[index].next;
+            UnlinkFromList(index);
+            LinkToList(index, EXPIRED_LIST);
+            index = next;
+        }
+    }
+}
+
+void TimerScheduler::Cascade(uint32_t level, uint32_t slot)
+{
+    const uint32_t list = level * SLOTS_PER_LEVEL + slot;
+    uint32_t index = list_heads_[list];
+
+    while (index != INVALID_INDEX)
+    {
+        const uint32_t next = nodes_[index].next;
+        UnlinkFromList(index);
+        AddToWheel(index);
+        index = next;
+    }
+}
@@ -1,26 +1,49 @@
 #pragma once
-
-#include <functional>
-#include <vector>
+/*
+*
+* :  Ÿ̹   Ÿ̸ ٷ
+* 1. 1ms ƽ, 4ܰ x 256 ٷ / O(1),    ܰ   ܰ  
+* 2. Ÿ̸  Ǯ ϰ ݹ InplaceFunction  Ͽ   Ҵ 
+* 3. (owner)  Ͽ  Leave  CancelOwner    
+* 4. ScheduleTask/Cancel   忡 ȣ , Update/Advance  νϽ  忡 ȣ
+* 5. TIMER_SCHEDULER   尡  ܸ ùķ̼ ð(Manual) Ͽ 帮/÷̿  ,
+*    Ʈũ  SteadyClock νϽ   ŸӾƿ/ۿ 
+*
+*/
+
+#include "InplaceFunction.hpp"
+
+#include <array>
 #include <chrono>
-#include <utility>
-#include <algorithm>
-#include <memory>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
-class TimerScheduler 
+class TimerScheduler
 {
+public:
 
-    using TimerId = size_t;
+    using TimerId = uint64_t;
+    using Callback = InplaceFunction<void(), 48>;
+    using Clock = std::chrono::steady_clock;
 
-private:
-    struct Task
+    static constexpr TimerId INVALID_TIMER_ID = 0;
+
+    enum class TimeSource
     {
-        TimerId id;
-        std::chrono::steady_clock::time_point executeTime;
-        std::function<void()> callback;
+        SteadyClock,    // Update   ð 
+        Manual          // Advance   ð 
     };
 
-    TimerScheduler() : next_timer_id_(1) {}
+    static constexpr uint32_t LEVEL_BITS = 8;
+    static constexpr uint32_t SLOTS_PER_LEVEL = 1u << LEVEL_BITS;
+    static constexpr uint32_t LEVEL_COUNT = 4;
+    static constexpr uint64_t MAX_DELAY_TICKS = 1ull << 31;       //  24
+
+    static TimerScheduler& GetInstance();
+
+    explicit TimerScheduler(TimeSource source = TimeSource::SteadyClock);
     ~TimerScheduler() = default;
 
     TimerScheduler(const TimerScheduler&) = delete;
@@ -28,75 +51,81 @@ private:
     TimerScheduler(TimerScheduler&&) = delete;
     TimerScheduler& operator=(TimerScheduler&&) = delete;
 
-public:
-    
+    //  ð() Ŀ ݹ  , owner  ϸ CancelOwner  Բ 
+    TimerId ScheduleTask(float delayInSeconds, Callback callback, const void* owner = nullptr);
 
-    static TimerScheduler& GetInstance() 
-    {
-        static TimerScheduler instance;
-        return instance;
-    }
+    //  ۾  (̹ Ǿų ҵ ID  false)
+    bool CancelTask(TimerId id);
 
-    //  ð() Ŀ ݹ  
-    TimerId ScheduleTask(float delayInSeconds, std::function<void()> callback) 
-    {
-        auto executeTime = std::chrono::steady_clock::now() +
-            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
-                std::chrono::duration<float>(delayInSeconds));
+    // owner    ۾ ,   ȯ
+    size_t CancelOwner(const void* owner);
 
-        TimerId newId = next_timer_id_++;
+    // SteadyClock:  ð  ۾ 
+    void Update();
+    void Update(Clock::time_point now);
 
-        scheduled_tasks_.push_back({ newId, executeTime, std::move(callback) });
+    // Manual: ð seconds ŭ ϰ  ۾ 
+    void Advance(float seconds);
 
-        return newId;
-    }
+    [[nodiscard]] size_t GetActiveCount() const;
 
-    //  ۾ 
-    bool CancelTask(TimerId id) 
-    {
-        auto it = std::find_if(scheduled_tasks_.begin(), scheduled_tasks_.end(),
-            [id](const Task& task) 
-            {
-                return task.id == id; 
-            });
-
-        if (it != scheduled_tasks_.end()) 
-        {
-            scheduled_tasks_.erase(it);
-            return true;
-        }
-
-        return false;
-    }
-
-    void Update() 
+private:
+
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+    static constexpr uint32_t EXPIRED_LIST = LEVEL_COUNT * SLOTS_PER_LEVEL;
+    static constexpr uint32_t LIST_COUNT = EXPIRED_LIST + 1;
+
+    struct TimerNode
     {
-        auto now = std::chrono::steady_clock::now();
+        Callback callback;
+        const void* owner{ nullptr };
+        uint64_t expire_tick{ 0 };
 
-        std::vector<std::function<void()>> tasksToExecute;
+        //  (Ǵ  )   
+        uint32_t list{ INVALID_INDEX };
+        uint32_t prev{ INVALID_INDEX };
+        uint32_t next{ INVALID_INDEX };
+
+        //  owner   
+        uint32_t owner_prev{ INVALID_INDEX };
+        uint32_t owner_next{ INVALID_INDEX };
+
+        //    ID   ʵ   
+        uint32_t generation{ 1 };
+    };
 
-        auto newEnd = std::remove_if(scheduled_tasks_.begin(), scheduled_tasks_.end(),
-            [&](const Task& task) 
-            {
-                if (task.executeTime <= now) 
-                {
-                    tasksToExecute.push_back(task.callback);
-                    return true;
-                }
-                return false;
-            });
+    [[nodiscard]] uint64_t ToTick(Clock::time_point time) const;
+    void RunExpired();
+    [[nodiscard]] static TimerId MakeId(uint32_t index, uint32_t generation);
+    [[nodiscard]] TimerNode* FindNode(TimerId id, uint32_t& index);
 
-        scheduled_tasks_.erase(newEnd, scheduled_tasks_.end());
+    uint32_t AllocateNode();
+    void FreeNode(uint32_t index);
 
-        for (const auto& callback : tasksToExecute) 
-        {
-            callback();
-        }
-    }
+    void AddToWheel(uint32_t index);
+    void LinkToList(uint32_t index, uint32_t list);
+    void UnlinkFromList(uint32_t index);
+    void LinkToOwner(uint32_t index);
+    void UnlinkFromOwner(uint32_t index);
+
+    void AdvanceTo(uint64_t targetTick);
+    void Cascade(uint32_t level, uint32_t slot);
 
 private:
-    std::vector<Task> scheduled_tasks_;
-    TimerId next_timer_id_;
+
+    mutable std::mutex mutex_;
+
+    TimeSource source_;
+    Clock::time_point origin_;
+    double manual_seconds_{ 0.0 };
+    uint64_t current_tick_{ 0 };
+
+    std::vector<TimerNode> nodes_;
+    uint32_t free_head_{ INVALID_INDEX };
+    size_t active_count_{ 0 };
+
+    std::array<uint32_t, LIST_COUNT> list_heads_;
+    std::unordered_map<const void*, uint32_t> owner_heads_;
 };
 
-#define TIMER_SCHEDULER TimerScheduler::GetInstance()
\ No newline at end of file
+#define TIMER_SCHEDULER TimerScheduler::GetInstance()